@@ -20,6 +20,7 @@
 #include "default-verification-ids.h"
 #include "verification-rule.h"
 
+#include <core/config-changes.h>
 #include <core/main-config.h>
 #include <errors/error-types.h>
 #include <traits/class-traits.h>
@@ -83,12 +84,18 @@ constexpr auto is_any_trigger_enabled(TriggerConfig const& config) -> bool {
  * @details Each verification rule consists of a verification identifier and an invocable
  * verify action. When adding a new default verification rule, ensure it is provided with
  * a new corresponding default verification identifier as well.
+ * 
+ * Each rule declares the parts of the main configuration object that it reads, so that
+ * only the affected rules have to be verified again after a change. The rules are
+ * verified in order, so the rules that others build upon are listed first. That way, a
+ * verification that stops at the first error reports the most fundamental one.
  *
  * @return Array of verification rules.
  */
 [[nodiscard]]
 constexpr auto get_default_verification_rules() {
     using id = verification_identifier;
+    using part = config_change;
 
     constexpr auto verification_rules = std::array{
         verification_rule{
@@ -98,28 +105,47 @@ constexpr auto get_default_verification_rules() {
                 return is_any_trigger_enabled(config.framework.trigger)
                     ? status{std::nullopt}
                     : status{verification_error::no_trigger_enabled};
-            }},
+            },
+            config_changes{part::time_trigger, part::light_trigger,
+                part::acceleration_trigger, part::orientation_trigger}},
         verification_rule{
             id::time_trigger,
             +[](main_config const& config)
-            { return verify_data_destination(config.framework.trigger.time); }},
+            { return verify_data_destination(config.framework.trigger.time); },
+            config_changes{part::time_trigger}},
         verification_rule{
             id::light_trigger,
             +[](main_config const& config)
-            { return verify_data_destination(config.framework.trigger.light); }},
+            { return verify_data_destination(config.framework.trigger.light); },
+            config_changes{part::light_trigger}},
         verification_rule{
             id::acceleration_trigger,
             +[](main_config const& config)
-            { return verify_data_destination(config.framework.trigger.acceleration); }},
+            { return verify_data_destination(config.framework.trigger.acceleration); },
+            config_changes{part::acceleration_trigger}},
         verification_rule{
             id::orientation_trigger,
             +[](main_config const& config)
-            { return verify_data_destination(config.framework.trigger.orientation); }
+            { return verify_data_destination(config.framework.trigger.orientation); },
+            config_changes{part::orientation_trigger}
         }
     };
     return verification_rules;
 }
 
+/**
+ * @remark Ensures the default main configuration object to pass the default
+ * verification rules, so that a configuration derived from it only has to be verified
+ * by the rules that are affected by its changes.
+ */
+static_assert([] {
+    auto const config = main_config{};
+    for (auto const& rule : get_default_verification_rules()) {
+        if (rule.verify(config)) return false;
+    }
+    return true;
+}());
+
 } // namespace cfg
 
 #endif
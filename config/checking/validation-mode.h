@@ -38,12 +38,14 @@ namespace cfg {
 enum class validation_mode {
     config_file,    /**< Indicates to perform validation on config file values. */
     config_message, /**< Indicates to perform validation on config message values. */
+    config_delta,   /**< Indicates to perform validation on delta message values. */
 };
 
 /**
  * @brief Invokes one of the given validators based on the given validation mode.
  * 
- * @details This function is used to map a validator to a validation mode. If the given
+ * @details This function is used to map a validator to a validation mode. The values of
+ * delta messages are validated the same way as those of config messages. If the given
  * validation mode is not recognized, the validator for config file values is used.
  * 
  * @tparam FileFunc Callable type used for validating config file values.
@@ -66,6 +68,7 @@ constexpr auto invoke_validator(
     switch (mode) {
     case validation_mode::config_file:    return file_action();
     case validation_mode::config_message: return message_action();
+    case validation_mode::config_delta:   return message_action();
     default: return file_action();
     }
 }
@@ -27,7 +27,6 @@
 #include <cctype>
 #include <charconv>
 #include <cstdint>
-#include <cstdlib>
 #include <limits>
 #include <optional>
 #include <string_view>
@@ -60,7 +59,7 @@ struct validate_result {
     template<typename U>
     [[nodiscard]]
     constexpr operator validate_result<U>() const
-    { return {std::optional<U>{data}, error}; }
+    { return {data ? std::optional<U>{*data} : std::optional<U>{}, error}; }
 
     /**
      * @brief Compares two validation results for (in)equality.
@@ -128,6 +127,9 @@ constexpr auto validate_value_range(
  * error is returned. When validating a boolean value, the @p min and @p max arguments
  * are ignored.
  * 
+ * Integral values are converted with @ref decimal_from_chars, which validates and
+ * converts up to eight digits at once.
+ * 
  * @tparam T Type which indicates how the string-view value should be interpreted. This
  * type is required to be an arithmetic type.
  * 
@@ -152,7 +154,13 @@ constexpr auto validate_value(
 
     auto const is_type_bool = std::is_same_v<T, bool>;
     auto result = std::conditional_t<is_type_bool, std::uint8_t, T>{};
-    auto [ptr, error] = from_chars(value, result);
+    auto const [ptr, error] = [&] {
+        if constexpr (std::is_integral_v<decltype(result)>) {
+            return decimal_from_chars(value, result);
+        } else {
+            return from_chars(value, result);
+        }
+    }();
 
     if (error == std::errc::invalid_argument)
         return {std::nullopt, validation_error::contains_invalid_character};
@@ -176,7 +184,7 @@ constexpr auto validate_value(
  * @return An optional validation error.
  */
 [[nodiscard]]
-inline auto validate_name(std::string_view name)
+constexpr auto validate_name(std::string_view name)
 -> validate_result<std::string_view> {
     if (name.empty())
         return {std::nullopt, validation_error::missing_value};
@@ -245,7 +253,7 @@ constexpr auto validate_bool(zstring_view value)
  * 
  * @details If the string-value contains a number that fits within the range specified by
  * the @p min and @p max arguments, the validation is successful and no error is
- * returned.
+ * returned. The number is converted with @ref decimal_from_chars.
  * 
  * @param[in] value String that contains a possible unsigned integer value.
  * @param[in] min Threshold for the minimum value of the converted result.
@@ -254,21 +262,19 @@ constexpr auto validate_bool(zstring_view value)
  * @return An optional validation error.
  */
 [[deprecated, nodiscard]]
-inline auto validate_uint32(
+constexpr auto validate_uint32(
     zstring_view value,
     std::uint32_t min = 0,
     std::uint32_t max = 99'999'999
 ) -> std::optional<validation_error> {
     if (value.empty()) return validation_error::missing_value;
 
-    // note: errno is a macro defined in <cerrno>
-    errno = 0;
-    char* value_end;
-    auto const result = std::uint32_t{std::strtoul(value.data(), &value_end, 10)};
+    auto result = std::uint32_t{};
+    auto const [value_end, error] = decimal_from_chars({value.data(), value.size()}, result);
 
-    if (value_end == value.data() or *value_end != '\0')
+    if (error == std::errc::invalid_argument or value_end != value.data() + value.size())
         return validation_error::contains_invalid_character;
-    if (errno == ERANGE)
+    if (error == std::errc::result_out_of_range)
         return validation_error::above_type_range;
 
     if (result < min) return validation_error::below_min_threshold;
@@ -284,7 +290,7 @@ inline auto validate_uint32(
  * 
  * @details If the string-value contains a number that fits within the range specified by
  * the @p min and @p max arguments, the validation is successful and no error is
- * returned.
+ * returned. The number is converted with @ref decimal_from_chars.
  * 
  * @param[in] value String that contains a possible signed integer value.
  * @param[in] min Threshold for the minimum value of the converted result.
@@ -293,22 +299,20 @@ inline auto validate_uint32(
  * @return An optional validation error.
  */
 [[deprecated, nodiscard]]
-inline auto validate_int32(
+constexpr auto validate_int32(
     zstring_view value,
     std::int32_t min = -99'999'999,
     std::int32_t max = +99'999'999
 ) -> std::optional<validation_error> {
     if (value.empty()) return validation_error::missing_value;
 
-    // note: errno is a macro defined in <cerrno>
-    errno = 0;
-    char* value_end;
-    auto const result = std::int32_t{std::strtol(value.data(), &value_end, 10)};
+    auto result = std::int32_t{};
+    auto const [value_end, error] = decimal_from_chars({value.data(), value.size()}, result);
 
-    if (value_end == value.data() or *value_end != '\0')
+    if (error == std::errc::invalid_argument or value_end != value.data() + value.size())
         return validation_error::contains_invalid_character;
-    if (errno == ERANGE)
-        return result < 0
+    if (error == std::errc::result_out_of_range)
+        return value.front() == '-'
             ? validation_error::below_type_range
             : validation_error::above_type_range;
 
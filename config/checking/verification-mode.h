@@ -0,0 +1,44 @@
+/**
+ * @file verification-mode.h
+ * @brief Verification modes used for controlling the behavior of the verification of
+ * main configuration objects.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_CONFIG_CHECKING_VERIFICATION_MODE_H
+#define CFG_CONFIG_CHECKING_VERIFICATION_MODE_H
+
+/**
+ * @namespace cfg
+ * 
+ * @brief Contains everything related to the processing of configuration files.
+ */
+namespace cfg {
+
+/**
+ * @enum verification_mode
+ * 
+ * @brief Enumeration of the verification modes.
+ * 
+ * @details Every verification error causes the main configuration object to be reset,
+ * so a single error is sufficient to know that a configuration is rejected. Collecting
+ * all of the errors is only useful for reporting them.
+ */
+enum class verification_mode {
+    complete,  /**< Indicates to run every rule and collect all of the errors. */
+    fail_fast, /**< Indicates to stop at the first rule that reports an error. */
+};
+
+} // namespace cfg
+
+#endif
@@ -19,6 +19,7 @@
 
 #include "verification-identifiers.h"
 
+#include <core/config-changes.h>
 #include <errors/error-types.h>
 #include <traits/class-traits.h>
 
@@ -38,6 +39,10 @@ namespace cfg {
  *
  * @brief Verifies a main configuration object with the use of a given verifier-function.
  * 
+ * @details A rule declares which parts of the main configuration object its verifier
+ * reads. If none of those parts changed since the object was last verified, the rule
+ * does not have to be verified again. By default, a rule reads every part.
+ * 
  * @tparam Verifier Type of the verifier-function.
  */
 template<typename Verifier>
@@ -54,13 +59,16 @@ public:
      * @param[in] id Identifier of the verification rule.
      * @param[in] verifier Function that performs the verification of a verification
      * rule.
+     * @param[in] reads Parts of the main configuration object read by the verifier.
      */
     constexpr verification_rule(
         verification_identifier id,
-        Verifier const& verifier
+        Verifier const& verifier,
+        config_changes const& reads = config_changes::all()
     ):
         id_{id},
-        verifier_fn{verifier}
+        verifier_fn{verifier},
+        reads_{reads}
     {}
 
     /**
@@ -91,6 +99,24 @@ public:
     constexpr auto id() const -> verification_identifier
     { return id_; }
 
+    /**
+     * @brief Gets the parts of the main configuration object read by the verifier.
+     */
+    [[nodiscard]]
+    constexpr auto reads() const -> config_changes const&
+    { return reads_; }
+
+    /**
+     * @brief Checks if the outcome of the rule can be affected by a set of changes.
+     * 
+     * @param[in] changes Parts of the main configuration object that changed.
+     * 
+     * @return True if the verifier reads any of the changed parts, false otherwise.
+     */
+    [[nodiscard]]
+    constexpr auto is_affected_by(config_changes const& changes) const -> bool
+    { return reads_.intersects(changes); }
+
     /**
      * @brief Compares two validation rules for (in)equality.
      * 
@@ -116,6 +142,7 @@ public:
 private:
     verification_identifier id_; /**< Identifier of a verification rule. */
     Verifier verifier_fn;        /**< Verifier-function that does the verification. */
+    config_changes reads_;       /**< Parts read by the verifier-function. */
 };
 
 } // namespace cfg
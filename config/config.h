@@ -17,22 +17,40 @@
 #ifndef CFG_CONFIG_H
 #define CFG_CONFIG_H
 
+#include "core/config-cache.h"
+#include "core/config-changes.h"
+#include "core/config-footprint.h"
 #include "core/config-handler.h"
+#include "core/config-profiler.h"
+#include "core/config-slots.h"
+#include "core/device-config.h"
+#include "core/embedded-config.h"
 #include "core/main-config.h"
 #include "errors/error-handler.h"
 #include "errors/error-messages.h"
+#include "logging/logger.h"
+#include "parsing/delta-parser.h"
+#include "parsing/downlink-planner.h"
+#include "parsing/image-parser.h"
+#include "parsing/json-parser.h"
 #include "parsing/xml-parser.h"
 #include "parsing/message-parser.h"
+#include "parsing/packed-parser.h"
+#include "strings/string-formatting.h"
 #include "strings/zstring-view.h"
+#include "traits/class-traits.h"
 #include "utilities/file-io.h"
 
 // warning: implicitly includes 'all.h'
 #include <logger.hpp>
 #include <Framework/AEtherData.h>
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstdio>
 #include <string_view>
+#include <type_traits>
 
 /**
  * @namespace cfg
@@ -41,6 +59,108 @@
  */
 namespace cfg {
 
+/**
+ * @brief Checks the outcome of the processing of a configuration file or message.
+ * 
+ * @details Checks the config-handler for errors that occurred while its configuration
+ * data was processed, and verifies the resulting main-config object. If either failed,
+ * the status indicator of the main-config object is set to indicate the failure. Refer
+ * to the @ref process_config function for more details.
+ * 
+ * Only the verification rules that are affected by the given changes are verified. The
+ * main-config object is thus required to have passed verification before it was
+ * changed, which holds for the default main-config object.
+ * 
+ * @tparam ConfigHandler Type of the config-handler.
+ * 
+ * @param[in] cfg_handler Config-handler that has processed a config file or message.
+ * @param[in] changes Parts of the main-config object that changed during processing.
+ * 
+ * @return True if the main-config object is fit for use, false otherwise.
+ */
+template<typename ConfigHandler>
+auto check_processed_config(
+    ConfigHandler& cfg_handler,
+    config_changes const& changes = config_changes::all()
+) -> bool {
+    auto const logging = get_config_profiler().time_stage(config_stage::log);
+    if (cfg_handler.has_config_errors()) {
+        get_default_log().log_text("[ERROR]Config could not be fully processed.\n");
+        cfg_handler.report_config_errors();
+        cfg_handler.set_status_indicator(StatusIndicator::failure);
+        return false;
+    }
+    get_default_log().log_text("[INFO]Config processed successfully!\n");
+    auto const verification = [&cfg_handler, &changes] {
+        auto const verifying = get_config_profiler().time_stage(config_stage::verify);
+        return cfg_handler.verify_main_config(changes);
+    }();
+    if (verification.contains_errors()) {
+        verification.log_errors("[ERROR]Active config did not pass verification:\n");
+        cfg_handler.set_status_indicator(StatusIndicator::failure);
+        return false;
+    }
+    get_default_log().log_text("[INFO]Active config passed verification!\n");
+    return true;
+}
+
+/**
+ * @brief Concludes the processing of a configuration file or message.
+ * 
+ * @details Checks the outcome of the processing with @ref check_processed_config. If the
+ * main-config object did not pass verification, it is reset to its default values, so
+ * that it can still be used safely.
+ * 
+ * @tparam ConfigHandler Type of the config-handler.
+ * 
+ * @param[in] cfg_handler Config-handler that has processed a config file or message.
+ * @param[in] changes Parts of the main-config object that changed during processing.
+ * 
+ * @return Main-config object used for controlling various internal systems.
+ */
+template<typename ConfigHandler>
+auto conclude_processing(
+    ConfigHandler& cfg_handler,
+    config_changes const& changes = config_changes::all()
+) -> main_config {
+    auto const passed = check_processed_config(cfg_handler, changes);
+    if (not passed and not cfg_handler.has_config_errors()) {
+        cfg_handler.reset_main_config();
+        cfg_handler.set_status_indicator(StatusIndicator::failure);
+    }
+    return cfg_handler.get_main_config();
+}
+
+/**
+ * @brief Logs the measurements of the config processing stages in a single line.
+ * 
+ * @details The line lists the cycles and the peak stack depth (in bytes) of each stage.
+ * Nothing is logged unless the @ref CFG_CONFIG_PROFILING macro is enabled.
+ * 
+ * @param[in] profile Measurements of the config processing stages.
+ */
+inline auto log_config_profile(config_profile const& profile) -> void {
+    if constexpr (not config_profiling) return;
+
+    auto const cycles = [&profile](config_stage stage)
+    { return static_cast<unsigned long>(profile[stage].cycles); };
+    auto const stack = [&profile](config_stage stage)
+    { return static_cast<unsigned long>(profile[stage].stack_bytes); };
+
+    static constexpr char format[] =
+        "[INFO]Config stages (cycles/stack): load=%lu/%lu parse=%lu/%lu "
+        "apply=%lu/%lu verify=%lu/%lu log=%lu/%lu\n";
+    std::array<char, max_formatted_size(format, 0)> message;
+    std::sprintf(message.data(), format,
+        cycles(config_stage::load), stack(config_stage::load),
+        cycles(config_stage::parse), stack(config_stage::parse),
+        cycles(config_stage::apply), stack(config_stage::apply),
+        cycles(config_stage::verify), stack(config_stage::verify),
+        cycles(config_stage::log), stack(config_stage::log)
+    );
+    aether_log << message.data();
+}
+
 /**
  * @brief Processes configuration files or messages.
  * 
@@ -56,11 +176,19 @@ namespace cfg {
  * (potentially converted) value is then applied to the main-config object. Any potential
  * parsing or validation error is written a log file.
  * 
+ * The log records are gathered in the default log-buffer while the configuration is
+ * processed, and are only formatted and written at once afterwards.
+ * 
  * To ensure that no misconfiguration will render the device useless (e.g. having no
  * destination selected for its accumalated data), the main-config object will be
  * verified as a final step. If the main-config object did not pass verification, it will
  * be reset to its default values. Matching verification errors will be logged and the
- * status indicator will be used to indicate some failure occurred.
+ * status indicator will be used to indicate some failure occurred. Only the verification
+ * rules that read any of the parts of the main-config object that changed are verified.
+ * 
+ * If the @ref CFG_CONFIG_PROFILING macro is enabled, the cycles and the peak stack depth
+ * of each processing stage are measured and logged. The measurements can also be
+ * obtained from the @ref get_config_profiler function afterwards.
  * 
  * @tparam ConfigHandler Type of the config-handler.
  * @tparam ConfigData Type of the config file or message.
@@ -72,23 +200,79 @@ namespace cfg {
  */
 template<typename ConfigHandler, typename ConfigData>
 auto process_config(ConfigHandler&& cfg_handler, ConfigData const& data) -> main_config {
-    cfg_handler.process_config(data);
-    if (cfg_handler.has_config_errors()) {
-        aether_log << "[ERROR]Config could not be fully processed.\n";
-        cfg_handler.report_config_errors();
-        cfg_handler.set_status_indicator(StatusIndicator::failure);
-    } else {
-        aether_log << "[INFO]Config processed successfully!\n";
-        auto const verification = cfg_handler.verify_main_config();
-        if (verification.contains_errors()) {
-            verification.log_errors("[ERROR]Active config did not pass verification:\n");
-            cfg_handler.reset_main_config();
-            cfg_handler.set_status_indicator(StatusIndicator::failure);
-        } else {
-            aether_log << "[INFO]Active config passed verification!\n";
-        }
+    get_config_profiler().reset();
+    auto const changes = cfg_handler.process_config(data);
+    auto const main_cfg = conclude_processing(cfg_handler, changes);
+    flush_default_log();
+    log_config_profile(get_config_profiler().get_profile());
+    return main_cfg;
+}
+
+/**
+ * @brief Processes a batch of configuration files or messages at once.
+ * 
+ * @details Works similarly to @ref process_config, except that the batch is processed
+ * with @ref config_handler::process_config_batch. As such, the resulting main-config
+ * object is only validated, verified and logged once for the whole batch.
+ * 
+ * @tparam ConfigHandler Type of the config-handler.
+ * @tparam ConfigBatch Container type of the config files or messages.
+ * 
+ * @param[in] cfg_handler Config-handler that processes config files or messages.
+ * @param[in] batch Config files or messages that need to be processed, in order.
+ * 
+ * @return Main-config object used for controlling various internal systems.
+ */
+template<typename ConfigHandler, typename ConfigBatch>
+auto process_config_batch(ConfigHandler&& cfg_handler, ConfigBatch const& batch)
+-> main_config {
+    get_config_profiler().reset();
+    auto const changes = cfg_handler.process_config_batch(batch);
+    auto const main_cfg = conclude_processing(cfg_handler, changes);
+    flush_default_log();
+    log_config_profile(get_config_profiler().get_profile());
+    return main_cfg;
+}
+
+/**
+ * @brief Processes configuration files or messages into the candidate slot.
+ * 
+ * @details Works similarly to @ref process_config, except that the framework can keep
+ * using the active main-config object of the slots while a new one is processed. Only
+ * once the new main-config object has been processed and verified without any error,
+ * is it written to the candidate slot and made active by an atomic pointer flip. If it
+ * is rejected instead, the active main-config object simply stays in place, rather than
+ * being replaced by the default main-config object, as in:
+ * 
+ * if (not process_config_candidate(slots, cfg_handler, message)) {
+ *     // keep running with slots.active(), and report the failure
+ * }
+ * 
+ * @tparam ConfigHandler Type of the config-handler.
+ * @tparam ConfigData Type of the config file or message.
+ * 
+ * @param[in,out] slots Active and candidate main-config objects.
+ * @param[in] cfg_handler Config-handler that processes config files or messages.
+ * @param[in] data Config file or message that needs to be processed.
+ * 
+ * @return True if the new main-config object was made active, false otherwise.
+ */
+template<typename ConfigHandler, typename ConfigData>
+auto process_config_candidate(
+    config_slots<>& slots,
+    ConfigHandler&& cfg_handler,
+    ConfigData const& data
+) -> bool {
+    get_config_profiler().reset();
+    auto const changes = cfg_handler.process_config(data);
+    auto const passed = check_processed_config(cfg_handler, changes);
+    if (passed) {
+        slots.candidate() = cfg_handler.get_main_config();
+        slots.commit_candidate();
     }
-    return cfg_handler.get_main_config();
+    flush_default_log();
+    log_config_profile(get_config_profiler().get_profile());
+    return passed;
 }
 
 /**
@@ -99,6 +283,9 @@ auto process_config(ConfigHandler&& cfg_handler, ConfigData const& data) -> main
  * them to the corresponding value of each setting. For more details, refer to the @ref
  * process_config function.
  * 
+ * The message parser uses the @ref default_message_decoder, so that the bitspans of the
+ * default settings are extracted by code that is generated in compile time.
+ * 
  * The functions lora::wait_for_message and lora::receive could be used to obtain data
  * from LoRaWAN. At least, it appears that way, we haven't actually tested anything that
  * is related to receiving data via LoRaWAN due to time constraints. The data can then be
@@ -113,47 +300,291 @@ auto process_config(ConfigHandler&& cfg_handler, ConfigData const& data) -> main
  * 
  * @return Main-config object used for controlling various internal systems.
  */
-inline auto process_config_message(message_data message) -> main_config
-{ return process_config(config_handler<message_parser>{}, message); }
+inline auto process_config_message(message_data message) -> main_config {
+    auto cfg_handler = config_handler<message_parser>{};
+    cfg_handler.get_parser().set_decoder(default_message_decoder{});
+    return process_config(cfg_handler, message);
+}
+
+/**
+ * @brief Processes configuration messages that are split across multiple frames.
+ * 
+ * @details Works similarly to @ref process_config_message, except that the message is
+ * decoded directly from the fragments it has been reassembled from. The frames are
+ * added to the reassembly as they are received, and the message is only processed once
+ * all of the fragments have arrived and the checksum matches, as in:
+ * 
+ * if (fragments.add_fragment(frame) == fragment_status::complete) {
+ *     main_cfg = process_config_fragments(fragments);
+ * }
+ * 
+ * An incomplete reassembly fails to process with a parsing error. For more details
+ * about the format of the frames, refer to the @ref message_fragments class.
+ * 
+ * @tparam MaxFragments Maximum number of fragments of the config message.
+ * 
+ * @param[in] fragments Reassembled config message.
+ * 
+ * @return Main-config object used for controlling various internal systems.
+ */
+template<std::size_t MaxFragments>
+auto process_config_fragments(message_fragments<MaxFragments> const& fragments)
+-> main_config
+{ return process_config(config_handler<message_parser>{}, fragments); }
+
+/**
+ * @brief Processes a batch of configuration messages that arrived back to back.
+ * 
+ * @details The messages are decoded into one set of settings, in order, so that a later
+ * message overrides the values of an earlier one. The settings are then validated and
+ * verified only once, which is cheaper than processing each message separately and
+ * spares the framework from being reconfigured for every message. This is useful when
+ * the network server sends several downlinks in quick succession, such as corrections.
+ * For more details, refer to the @ref process_config_message function.
+ * 
+ * @tparam MessageBatch Container type of the config messages.
+ * 
+ * @param[in] messages Container of config messages stored in a contiguous sequence, in
+ * the order in which they were received.
+ * 
+ * @return Main-config object used for controlling various internal systems.
+ */
+template<typename MessageBatch,
+    typename = std::enable_if_t<is_contiguous_container_v<MessageBatch>>>
+auto process_config_messages(MessageBatch const& messages) -> main_config {
+    auto cfg_handler = config_handler<message_parser>{};
+    cfg_handler.get_parser().set_decoder(default_message_decoder{});
+    return process_config_batch(cfg_handler, messages);
+}
+
+/**
+ * @brief Processes delta config messages.
+ * 
+ * @details This function creates a config-handler that consists of a delta parser. A
+ * delta message only contains the values of the settings that change, so the given
+ * main-config object is used as the starting point. Settings that are not part of the
+ * delta message keep their current values. For more details about the format of delta
+ * messages, refer to the @ref delta_parser class.
+ * 
+ * The active and the returned main-config object can be passed to @ref diff_main_config
+ * to find out which drivers and triggers have to be restarted.
+ * 
+ * The active main-config object is required to have passed verification, since only the
+ * verification rules that are affected by the delta are verified again.
+ * 
+ * @param[in] active Main-config object that is currently in use.
+ * @param[in] delta Contains a pointer to an array of bytes that resembles a delta config
+ * message, and a message size.
+ * 
+ * @return Main-config object used for controlling various internal systems.
+ */
+inline auto process_config_delta(main_config const& active, message_data delta) -> main_config {
+    auto cfg_handler = config_handler<delta_parser>{};
+    cfg_handler.set_main_config(active);
+    return process_config(cfg_handler, delta);
+}
+
+/**
+ * @brief Processes delta config messages into the candidate slot.
+ * 
+ * @details Works similarly to the other overload of this function, except that the
+ * active main-config object of the slots is used as the starting point, and that the
+ * result is processed with @ref process_config_candidate. The active main-config object
+ * thus stays in place if the delta message is rejected.
+ * 
+ * @param[in,out] slots Active and candidate main-config objects.
+ * @param[in] delta Contains a pointer to an array of bytes that resembles a delta config
+ * message, and a message size.
+ * 
+ * @return True if the new main-config object was made active, false otherwise.
+ */
+inline auto process_config_delta(config_slots<>& slots, message_data delta) -> bool {
+    auto cfg_handler = config_handler<delta_parser>{};
+    cfg_handler.set_main_config(slots.active());
+    return process_config_candidate(slots, cfg_handler, delta);
+}
+
+/**
+ * @brief Processes packed config messages.
+ * 
+ * @details This function creates a config-handler that consists of a packed parser. A
+ * packed message holds a presence mask and compactly encoded values, so that even a full
+ * reconfiguration fits in the smallest LoRaWAN payload. Like a delta message, the
+ * settings that are not present keep their current values. Packed messages are created
+ * with the @ref write_packed_message function. For more details about their format,
+ * refer to the @ref packed_format struct.
+ * 
+ * The active main-config object is required to have passed verification, since only the
+ * verification rules that are affected by the message are verified again.
+ * 
+ * @param[in] active Main-config object that is currently in use.
+ * @param[in] packed Contains a pointer to an array of bytes that resembles a packed
+ * config message, and a message size.
+ * 
+ * @return Main-config object used for controlling various internal systems.
+ */
+inline auto process_config_packed(main_config const& active, message_data packed)
+-> main_config {
+    auto cfg_handler = config_handler<packed_parser>{};
+    cfg_handler.set_main_config(active);
+    return process_config(cfg_handler, packed);
+}
+
+/**
+ * @brief Processes packed config messages into the candidate slot.
+ * 
+ * @details Works similarly to the other overload of this function, except that the
+ * active main-config object of the slots is used as the starting point, and that the
+ * result is processed with @ref process_config_candidate. The active main-config object
+ * thus stays in place if the packed message is rejected.
+ * 
+ * @param[in,out] slots Active and candidate main-config objects.
+ * @param[in] packed Contains a pointer to an array of bytes that resembles a packed
+ * config message, and a message size.
+ * 
+ * @return True if the new main-config object was made active, false otherwise.
+ */
+inline auto process_config_packed(config_slots<>& slots, message_data packed) -> bool {
+    auto cfg_handler = config_handler<packed_parser>{};
+    cfg_handler.set_main_config(slots.active());
+    return process_config_candidate(slots, cfg_handler, packed);
+}
+
+/**
+ * @brief Processes binary config images.
+ * 
+ * @details This function creates a config-handler that consists of an image parser. A
+ * config image is a pre-compiled form of an XML config file, which can be created with
+ * the @ref write_config_image function. Its values are validated and applied the same
+ * way, but no text has to be tokenized. The image is read in place, so it can be mapped
+ * into memory directly. For more details, refer to the @ref process_config function.
+ * 
+ * @param[in] image Contains a pointer to the bytes of the config image and its size.
+ * 
+ * @return Main-config object used for controlling various internal systems.
+ */
+inline auto process_config_image(image_data image) -> main_config
+{ return process_config(config_handler<image_parser>{}, image); }
 
 /**
  * @brief Processes configuration files.
  * 
  * @details This function loads the given configuration file from disk and uses a config-
- * handler that consists of an XML parser to parse its contents. For more details, refer
- * to the @ref process_config function.
+ * handler that consists of an XML parser to parse its contents. The parser resolves the
+ * tag-names of the default settings with a tag-table that is made in compile time. For
+ * more details, refer to the @ref process_config function.
+ * 
+ * The file is streamed from disk in small blocks that are parsed as soon as they are
+ * read, so the stack usage of this function does not depend on the size of the file.
+ * 
+ * If the config file is unchanged since it was last processed successfully, the cached
+ * main-config object is restored without parsing the file at all. A file is considered
+ * unchanged when both its stamp and the CRC-32 checksum of its contents match. Only if
+ * the stamp matches, the file is streamed to compute its checksum. Otherwise, the
+ * checksum is computed from the same blocks that are parsed, so a changed file is only
+ * streamed once.
  * 
- * @warning This function consumes a large chunk of available stack space to be able to
- * load the given config file. Be aware of invoking it when most of the stack is already
- * being used for some other purpose.
+ * The SD-card is kept awake by a single @ref sd_session for the whole of this function,
+ * from looking up the stamp of the file up to writing the log entries of the result.
  * 
  * @param[in] filename Name of the configuration file to process.
+ * @param[in,out] cache Cache of the main-config object that was last applied.
  * 
  * @return Main-config object used for controlling various internal systems.
  */
-inline auto process_config_file(zstring_view filename) -> main_config {
-    auto const max_size = 3'072;
-    std::array<char, max_size> config_file;
-    auto const [bytes_read, file_error] = load_file(filename, max_size, config_file);
+inline auto process_config_file(zstring_view filename, config_cache cache) -> main_config {
+    auto const session = sd_session{};
+    auto& profiler = get_config_profiler();
+    profiler.reset();
 
-    if (file_error) {
-        std::array<char, 128> message;
-        std::sprintf(message.data(),
-            "[ERROR]Config-file '%s' could not be loaded: %s\n",
-            filename.size() > 32 ? "" : filename.data(),
-            get_error_message(*file_error)
+    auto const log_file_error = [filename](io_error file_error) {
+        flush_default_log();
+        constexpr auto max_filename_length = std::size_t{32};
+        static constexpr char format[] =
+            "[ERROR]Config-file '%s' could not be loaded: %s\n";
+        std::array<char, max_formatted_size(format,
+            std::max(max_filename_length, max_io_error_message_length()))> message;
+        std::sprintf(message.data(), format,
+            filename.size() > max_filename_length ? "" : filename.data(),
+            get_error_message(file_error)
         );
         aether_log << message.data();
         auto main_cfg = main_config{};
         main_cfg.framework.status = StatusIndicator::failure;
         return main_cfg;
+    };
+
+    auto stamp = file_stamp{};
+    auto const stamp_error = [&] {
+        auto const loading = profiler.time_stage(config_stage::load);
+        return get_file_stamp(filename, stamp);
+    }();
+    if (stamp_error) {
+        return log_file_error(*stamp_error);
     }
-    return process_config(
-        config_handler<xml_parser>{},
-        std::string_view{config_file.data(), bytes_read}
-    );
+
+    if (cache.matches(stamp)) {
+        auto file_hash = std::uint32_t{};
+        auto const hash_error = [&] {
+            auto const loading = profiler.time_stage(config_stage::load);
+            return stream_file(filename, [&file_hash](std::string_view block) {
+                file_hash = crc32(reinterpret_cast<std::byte const*>(block.data()),
+                    block.size(), file_hash);
+            }).error;
+        }();
+        if (hash_error) {
+            return log_file_error(*hash_error);
+        }
+        if (cache.matches(stamp, file_hash)) {
+            get_default_log().log_text(
+                "[INFO]Config-file is unchanged, restored the cached config.\n");
+            flush_default_log();
+            return cache.get_main_config();
+        }
+    }
+
+    auto cfg_handler = config_handler<xml_parser>{};
+    cfg_handler.get_parser().set_tag_lookup(get_default_tag_table().lookup());
+
+    auto file_hash = std::uint32_t{};
+    auto const file_error = cfg_handler.process_config_blocks(
+        [&](auto&& handle_block) {
+            auto const loading = profiler.time_stage(config_stage::load);
+            return stream_file(filename, [&](std::string_view block) {
+                file_hash = crc32(reinterpret_cast<std::byte const*>(block.data()),
+                    block.size(), file_hash);
+                handle_block(block);
+            });
+        }
+    ).error;
+
+    if (file_error) {
+        return log_file_error(*file_error);
+    }
+
+    auto const main_cfg = conclude_processing(cfg_handler);
+    if (main_cfg.framework.status == StatusIndicator::failure) {
+        cache.invalidate();
+    } else {
+        cache.store(stamp, file_hash, main_cfg);
+    }
+    flush_default_log();
+    log_config_profile(profiler.get_profile());
+    return main_cfg;
 }
 
+/**
+ * @brief Processes configuration files, with the use of the default config cache.
+ * 
+ * @details Refer to the other overload of this function for more details.
+ * 
+ * @param[in] filename Name of the configuration file to process.
+ * 
+ * @return Main-config object used for controlling various internal systems.
+ */
+inline auto process_config_file(zstring_view filename) -> main_config
+{ return process_config_file(filename, get_default_config_cache()); }
+
 } // namespace cfg
 
 #endif
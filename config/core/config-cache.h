@@ -0,0 +1,303 @@
+/**
+ * @file config-cache.h
+ * @brief Caches the last applied main configuration across resets.
+ * 
+ * @version 1.0
+ * @date December 2021
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_CONFIG_CORE_CONFIG_CACHE_H
+#define CFG_CONFIG_CORE_CONFIG_CACHE_H
+
+#include "main-config.h"
+
+#include <checking/default-verification-rules.h>
+#include <settings/default-settings.h>
+#include <strings/string-hashing.h>
+#include <utilities/checksum.h>
+#include <utilities/enum.h>
+#include <utilities/file-io.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * @def CFG_CONFIG_CACHE_SECTION
+ * 
+ * @brief Name of the linker section that holds the default config cache.
+ * 
+ * @details The section is required to survive a reset without being initialized by the
+ * startup code, such as backup RAM or a no-init section of the internal RAM.
+ */
+#ifndef CFG_CONFIG_CACHE_SECTION
+#define CFG_CONFIG_CACHE_SECTION ".noinit"
+#endif
+
+/**
+ * @def CFG_CONFIG_SCHEMA_VERSION
+ * 
+ * @brief Version of the meaning of the values of the settings.
+ * 
+ * @details Is to be raised whenever a validator or action is changed in a way that a
+ * config file results in a different main configuration object, since the schema of
+ * the settings does not reflect such a change. This invalidates the config caches that
+ * have been written by an earlier build.
+ */
+#ifndef CFG_CONFIG_SCHEMA_VERSION
+#define CFG_CONFIG_SCHEMA_VERSION 1
+#endif
+
+/**
+ * @namespace cfg
+ * 
+ * @brief Contains everything related to the processing of configuration files.
+ */
+namespace cfg {
+
+/**
+ * @namespace detail
+ * 
+ * @brief Provides helper/meta functions/types local to this header file.
+ */
+namespace detail {
+
+/**
+ * @brief Folds the bytes of a 32-bit word into a hash value.
+ * 
+ * @param[in] word Word to fold into the hash value.
+ * @param[in] seed Hash value to fold the word into.
+ * 
+ * @return New hash value.
+ */
+[[nodiscard]]
+constexpr auto hash_word(std::uint32_t word, std::uint32_t seed) -> std::uint32_t {
+    auto const bytes = std::array<char, 4>{
+        static_cast<char>(word & 0xFFu), static_cast<char>((word >> 8u) & 0xFFu),
+        static_cast<char>((word >> 16u) & 0xFFu), static_cast<char>(word >> 24u)};
+    return hash_string({bytes.data(), bytes.size()}, seed);
+}
+
+} // namespace detail
+
+/**
+ * @brief Computes the schema of a set of settings and verification rules.
+ * 
+ * @details The schema covers the identifier, type, tag-names, bitspan and flag-setting
+ * of each setting, the identifier of each verification rule and the version given by
+ * @ref CFG_CONFIG_SCHEMA_VERSION. A config cache that was written with a different
+ * schema is not trusted, as the same config file may result in a different main
+ * configuration object.
+ * 
+ * @tparam Settings Container type that stores its contents in a contiguous sequence.
+ * @tparam VerifyRules Container type of the verification rules.
+ * 
+ * @param[in] settings Container with the settings.
+ * @param[in] rules Container of verification rules stored in a contiguous sequence.
+ * 
+ * @return Hash value of the schema.
+ */
+template<typename Settings, typename VerifyRules>
+[[nodiscard]]
+constexpr auto make_config_schema(Settings const& settings, VerifyRules const& rules)
+-> std::uint32_t {
+    auto schema = detail::hash_word(CFG_CONFIG_SCHEMA_VERSION, hash_string({}));
+    for (auto const& setting_obj : settings) {
+        schema = detail::hash_word(to_underlying(setting_obj.id()), schema);
+        schema = detail::hash_word(to_underlying(setting_obj.type()), schema);
+        for (auto depth = 0; depth < setting_obj.max_tag_depth; ++depth) {
+            if (setting_obj.is_tag_empty(depth)) break;
+            schema = hash_string(setting_obj.tag(depth), schema);
+            schema = detail::hash_word(static_cast<std::uint32_t>(depth), schema);
+        }
+        auto const bits = setting_obj.config_bits();
+        schema = detail::hash_word((std::uint32_t{bits.pos()} << 8u) | bits.size(), schema);
+        schema = detail::hash_word(to_underlying(setting_obj.dependency()), schema);
+        schema = detail::hash_word(setting_obj.is_gated(), schema);
+    }
+    for (auto const& rule : rules) {
+        schema = detail::hash_word(to_underlying(rule.id()), schema);
+    }
+    return schema;
+}
+
+/**
+ * @var default_config_schema
+ * 
+ * @brief Schema of the default settings and verification rules.
+ */
+inline constexpr auto default_config_schema
+    = make_config_schema(get_default_settings(), get_default_verification_rules());
+
+/**
+ * @struct config_cache_entry
+ * 
+ * @brief Storage of a cached main configuration object, along with the stamp and hash
+ * of the config file it resulted from.
+ * 
+ * @details An entry is trivially default-constructible, so a statically stored entry
+ * is neither initialized on first use nor by the startup code, if it is placed in memory
+ * that the startup code leaves untouched. That is why the main configuration object,
+ * which has default member initializers, is stored as raw bytes. The contents of an
+ * entry are only trusted if its marker, schema and checksum are all correct.
+ */
+struct config_cache_entry {
+    std::uint32_t marker;    /**< Identifies a written entry of this exact layout. */
+    std::uint32_t schema;    /**< Schema of the settings that made the entry. */
+    file_stamp stamp;        /**< Stamp of the cached config file. */
+    std::uint32_t file_hash; /**< CRC-32 checksum of the cached config file. */
+    alignas(main_config)
+    std::byte main_cfg[sizeof(main_config)]; /**< Bytes of the main config object. */
+    std::uint32_t checksum;  /**< CRC-32 checksum of all the preceding members. */
+};
+
+static_assert(std::is_trivially_default_constructible_v<config_cache_entry>,
+    "a cache entry may not be initialized when it is placed in no-init memory");
+static_assert(std::is_trivially_copyable_v<main_config>,
+    "a main config object is stored as bytes within a cache entry");
+
+/**
+ * @class config_cache
+ * 
+ * @brief Caches the main configuration object that was last applied from a config file.
+ * 
+ * @details If the config file is unchanged since it was last processed, its cached main
+ * configuration object can be restored. This way, the validation and verification of
+ * the config file can be skipped. An entry that was written by a build with a different
+ * schema of the settings is never restored.
+ */
+class config_cache {
+public:
+    /**
+     * @var marker
+     * 
+     * @brief Marks an entry as written. Changes whenever the layout of an entry does.
+     */
+    static constexpr auto marker
+        = std::uint32_t{0xCAC4'0000u + sizeof(config_cache_entry)};
+
+    /**
+     * @brief Constructs a config cache that operates on some storage.
+     * 
+     * @param[in,out] storage Storage of the cache entry, which may contain garbage.
+     * @param[in] schema Schema of the settings that the cached configuration results
+     * from, such as made by @ref make_config_schema.
+     */
+    constexpr explicit config_cache(
+        config_cache_entry& storage,
+        std::uint32_t schema = default_config_schema
+    ) : entry{storage}, schema_{schema} {}
+
+    /**
+     * @brief Checks if the cache holds a main configuration object of a file with the
+     * given stamp.
+     * 
+     * @details This check is cheap, as it does not involve the contents of the file.
+     * 
+     * @param[in] stamp Stamp of the config file.
+     */
+    [[nodiscard]]
+    auto matches(file_stamp stamp) const -> bool
+    { return is_valid() and entry.stamp == stamp; }
+
+    /**
+     * @brief Checks if the cache holds a main configuration object of a file with the
+     * given stamp and hash.
+     * 
+     * @param[in] stamp Stamp of the config file.
+     * @param[in] file_hash CRC-32 checksum of the contents of the config file.
+     */
+    [[nodiscard]]
+    auto matches(file_stamp stamp, std::uint32_t file_hash) const -> bool
+    { return matches(stamp) and entry.file_hash == file_hash; }
+
+    /**
+     * @brief Gets the cached main configuration object.
+     * 
+     * @warning Only use the returned object if the cache @ref matches the config file.
+     * 
+     * @return Copy of the cached main configuration object.
+     */
+    [[nodiscard]]
+    auto get_main_config() const -> main_config {
+        auto main_cfg = main_config{};
+        std::memcpy(&main_cfg, entry.main_cfg, sizeof(main_config));
+        return main_cfg;
+    }
+
+    /**
+     * @brief Stores a main configuration object into the cache.
+     * 
+     * @param[in] stamp Stamp of the config file.
+     * @param[in] file_hash CRC-32 checksum of the contents of the config file.
+     * @param[in] main_cfg Main configuration object that resulted from the config file.
+     */
+    auto store(file_stamp stamp, std::uint32_t file_hash, main_config const& main_cfg)
+    -> void {
+        entry.marker = marker;
+        entry.schema = schema_;
+        entry.stamp = stamp;
+        entry.file_hash = file_hash;
+        std::memcpy(entry.main_cfg, &main_cfg, sizeof(main_config));
+        entry.checksum = compute_checksum();
+    }
+
+    /**
+     * @brief Invalidates the cached main configuration object, if any.
+     */
+    auto invalidate() -> void
+    { entry.marker = 0; }
+
+private:
+    /**
+     * @brief Checks if the cache entry has been written and is not corrupted.
+     */
+    [[nodiscard]]
+    auto is_valid() const -> bool {
+        return entry.marker == marker and entry.schema == schema_
+            and entry.checksum == compute_checksum();
+    }
+
+    /**
+     * @brief Computes the checksum of all the members of the entry before its checksum.
+     */
+    [[nodiscard]]
+    auto compute_checksum() const -> std::uint32_t {
+        return crc32(reinterpret_cast<std::byte const*>(&entry),
+            offsetof(config_cache_entry, checksum));
+    }
+
+    config_cache_entry& entry; /**< Storage of the cache entry. */
+    std::uint32_t schema_;     /**< Schema of the settings of this build. */
+};
+
+/**
+ * @brief Gets the default config cache.
+ * 
+ * @details The cache entry is placed in the linker section defined by the @ref
+ * CFG_CONFIG_CACHE_SECTION macro, so that it is retained across resets. Since the entry
+ * is trivially default-constructible, getting the cache does not initialize it.
+ * 
+ * @return Config cache that operates on the default cache entry.
+ */
+[[nodiscard]]
+inline auto get_default_config_cache() -> config_cache {
+    __attribute__((section(CFG_CONFIG_CACHE_SECTION)))
+    static config_cache_entry entry;
+    return config_cache{entry};
+}
+
+} // namespace cfg
+
+#endif
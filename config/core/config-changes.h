@@ -0,0 +1,273 @@
+/**
+ * @file config-changes.h
+ * @brief Change-sets between two main configuration objects.
+ * 
+ * @details A change-set indicates which parts of the main configuration object differ,
+ * so that only the drivers and triggers of which the configuration changed have to be
+ * restarted.
+ * 
+ * @version 1.0
+ * @date December 2021
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_CONFIG_CORE_CONFIG_CHANGES_H
+#define CFG_CONFIG_CORE_CONFIG_CHANGES_H
+
+#include "main-config.h"
+
+#include <utilities/enum.h>
+
+#include <cstdint>
+#include <initializer_list>
+
+/**
+ * @namespace cfg
+ * 
+ * @brief Contains everything related to the processing of configuration files.
+ */
+namespace cfg {
+
+/**
+ * @enum config_change
+ * 
+ * @brief Enumeration of the parts of a main configuration object that can change
+ * independently of each other.
+ * 
+ * @details Each part corresponds to something that the framework has to restart or
+ * re-initialize when its configuration changes, such as a sensor driver or a trigger.
+ */
+enum class config_change : std::uint16_t {
+    none                 = 0,       /**< Indicates that nothing changed. */
+    device_name          = 1 << 0,  /**< Device name changed. */
+    status               = 1 << 1,  /**< Status indicator changed. */
+    usb_detection        = 1 << 2,  /**< USB detection mode or interval changed. */
+    bmx160               = 1 << 3,  /**< BMX160 driver configuration changed. */
+    bme280               = 1 << 4,  /**< BME280 driver configuration changed. */
+    veml6030             = 1 << 5,  /**< VEML6030 driver configuration changed. */
+    time_trigger         = 1 << 6,  /**< Time trigger configuration changed. */
+    light_trigger        = 1 << 7,  /**< Light trigger configuration changed. */
+    acceleration_trigger = 1 << 8,  /**< Acceleration trigger configuration changed. */
+    orientation_trigger  = 1 << 9   /**< Orientation trigger configuration changed. */
+};
+
+/**
+ * @class config_changes
+ * 
+ * @brief Set of the parts of a main configuration object that changed.
+ */
+class config_changes {
+public:
+    /**
+     * @brief Default constructs an empty change-set.
+     */
+    constexpr config_changes() = default;
+
+    /**
+     * @brief Constructs a change-set that contains the given parts.
+     * 
+     * @param[in] parts Parts of the main configuration object to add to the change-set.
+     */
+    constexpr config_changes(std::initializer_list<config_change> parts) {
+        for (auto const part : parts) add(part);
+    }
+
+    /**
+     * @brief Makes a change-set that contains every part of the main configuration
+     * object.
+     */
+    [[nodiscard]]
+    static constexpr auto all() -> config_changes {
+        // note: the orientation trigger is the part with the highest bit
+        auto const last = to_underlying(config_change::orientation_trigger);
+        auto all_changes = config_changes{};
+        all_changes.changes = (std::uint_fast16_t{last} << 1) - 1;
+        return all_changes;
+    }
+
+    /**
+     * @brief Adds a changed part to the change-set.
+     * 
+     * @param[in] change Part of the main configuration object that changed.
+     */
+    constexpr auto add(config_change change) -> void
+    { changes |= change; }
+
+    /**
+     * @brief Checks if a part of the main configuration object changed.
+     * 
+     * @param[in] change Part of the main configuration object to check.
+     * 
+     * @return True if the part is contained within the change-set, false otherwise.
+     */
+    [[nodiscard]]
+    constexpr auto contains(config_change change) const -> bool
+    { return (changes & change) != 0; }
+
+    /**
+     * @brief Checks if any part of another change-set is contained within this one.
+     * 
+     * @param[in] other Change-set of the parts to check.
+     * 
+     * @return True if both change-sets have at least one part in common, false otherwise.
+     */
+    [[nodiscard]]
+    constexpr auto intersects(config_changes const& other) const -> bool
+    { return (changes & other.changes) != 0; }
+
+    /**
+     * @brief Checks if nothing changed.
+     */
+    [[nodiscard]]
+    constexpr auto empty() const -> bool
+    { return changes == 0; }
+
+    /**
+     * @brief Gets the changed parts as a bitmask of @ref config_change values.
+     */
+    [[nodiscard]]
+    constexpr auto bits() const -> std::uint_fast16_t
+    { return changes; }
+
+    /**
+     * @brief Compares two change-sets for (in)equality.
+     * 
+     * @param[in] lhs Change-set on the left-hand side of the operator.
+     * @param[in] rhs Change-set on the right-hand side of the operator.
+     * 
+     * @return Two change-sets are considered to be equal when they contain the same
+     * changed parts.
+     * 
+     * @{
+     */
+    [[nodiscard]]
+    friend constexpr auto operator!=(
+        config_changes const& lhs, config_changes const& rhs) -> bool
+    { return not (lhs == rhs); }
+
+    [[nodiscard]]
+    friend constexpr auto operator==(
+        config_changes const& lhs, config_changes const& rhs) -> bool
+    { return lhs.changes == rhs.changes; }
+    /** @} */
+
+private:
+    std::uint_fast16_t changes{}; /**< Bitmask of the changed parts. */
+};
+
+/**
+ * @namespace detail
+ * 
+ * @brief Provides helper/meta functions/types local to this header file.
+ */
+namespace detail {
+
+/**
+ * @brief Compares the options that all trigger configurations have in common.
+ * 
+ * @details The options are compared one by one, since the framework does not provide
+ * comparison operators for the individual trigger configurations.
+ * 
+ * @tparam TriggerConfig Type of the trigger configuration.
+ * 
+ * @param[in] lhs Trigger configuration on the left-hand side.
+ * @param[in] rhs Trigger configuration on the right-hand side.
+ * 
+ * @return True if all of the common options match, false otherwise.
+ */
+template<typename TriggerConfig>
+[[nodiscard]]
+constexpr auto common_trigger_options_match(
+    TriggerConfig const& lhs,
+    TriggerConfig const& rhs
+) -> bool {
+    return lhs.enable == rhs.enable
+        and lhs.measure.thp == rhs.measure.thp
+        and lhs.measure.accel_gyro == rhs.measure.accel_gyro
+        and lhs.measure.magnet == rhs.measure.magnet
+        and lhs.measure.light == rhs.measure.light
+        and lhs.lorawan_priority == rhs.lorawan_priority
+        and lhs.write_to.lora == rhs.write_to.lora
+        and lhs.write_to.sd == rhs.write_to.sd;
+}
+
+} // namespace detail
+
+/**
+ * @brief Determines which parts of a main configuration object changed.
+ * 
+ * @details The framework can use the resulting change-set to restart only the drivers
+ * and triggers of which the configuration changed, rather than re-initializing all of
+ * them whenever a new main configuration object is applied.
+ * 
+ * @tparam FrameworkConfig Type of the framework configuration object.
+ * 
+ * @param[in] previous Main configuration object that was in use before.
+ * @param[in] current Main configuration object that is to be used from now on.
+ * 
+ * @return Change-set of the parts that differ between both configuration objects.
+ */
+template<typename FrameworkConfig>
+[[nodiscard]]
+auto diff_main_config(
+    main_configuration<FrameworkConfig> const& previous,
+    main_configuration<FrameworkConfig> const& current
+) -> config_changes {
+    auto const& lhs = previous.framework;
+    auto const& rhs = current.framework;
+    auto changes = config_changes{};
+
+    if (previous.device_name != current.device_name) {
+        changes.add(config_change::device_name);
+    }
+    if (lhs.status != rhs.status) {
+        changes.add(config_change::status);
+    }
+    if (lhs.usb_detection != rhs.usb_detection
+        or lhs.usb_detection_interval_ms != rhs.usb_detection_interval_ms)
+    {
+        changes.add(config_change::usb_detection);
+    }
+    if (lhs.bmx160 != rhs.bmx160) {
+        changes.add(config_change::bmx160);
+    }
+    if (lhs.bme280 != rhs.bme280) {
+        changes.add(config_change::bme280);
+    }
+    if (lhs.veml6030 != rhs.veml6030) {
+        changes.add(config_change::veml6030);
+    }
+    if (not detail::common_trigger_options_match(lhs.trigger.time, rhs.trigger.time)
+        or lhs.trigger.time.interval_ms != rhs.trigger.time.interval_ms)
+    {
+        changes.add(config_change::time_trigger);
+    }
+    if (not detail::common_trigger_options_match(lhs.trigger.light, rhs.trigger.light)
+        or lhs.trigger.light.low_threshold != rhs.trigger.light.low_threshold
+        or lhs.trigger.light.high_threshold != rhs.trigger.light.high_threshold)
+    {
+        changes.add(config_change::light_trigger);
+    }
+    if (not detail::common_trigger_options_match(
+        lhs.trigger.acceleration, rhs.trigger.acceleration))
+    {
+        changes.add(config_change::acceleration_trigger);
+    }
+    if (not detail::common_trigger_options_match(
+        lhs.trigger.orientation, rhs.trigger.orientation))
+    {
+        changes.add(config_change::orientation_trigger);
+    }
+    return changes;
+}
+
+} // namespace cfg
+
+#endif
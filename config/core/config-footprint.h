@@ -0,0 +1,148 @@
+/**
+ * @file config-footprint.h
+ * @brief Compile time report of the memory that processing a config file occupies.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_CONFIG_CORE_CONFIG_FOOTPRINT_H
+#define CFG_CONFIG_CORE_CONFIG_FOOTPRINT_H
+
+#include "config-handler.h"
+#include "main-config.h"
+
+#include <errors/error-handler.h>
+#include <parsing/tag-pool.h>
+#include <parsing/xml-parser.h>
+#include <settings/default-settings.h>
+#include <traits/class-traits.h>
+#include <utilities/file-io.h>
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+/**
+ * @def CFG_CONFIG_RAM_BUDGET
+ * 
+ * @brief Maximum number of bytes that the buffers used for processing a config file may
+ * occupy in total, or zero to not enforce any budget.
+ * 
+ * @details The budget is checked against the @ref default_config_footprint in compile
+ * time, so that exceeding it is reported by the build rather than by a stack overflow.
+ */
+#ifndef CFG_CONFIG_RAM_BUDGET
+#define CFG_CONFIG_RAM_BUDGET 0
+#endif
+
+/**
+ * @namespace cfg
+ * 
+ * @brief Contains everything related to the processing of configuration files.
+ */
+namespace cfg {
+
+/**
+ * @struct config_footprint
+ * 
+ * @brief Describes the worst-case sizes of the buffers that are used for processing a
+ * config file.
+ * 
+ * @details All of the sizes follow from the container of settings in compile time, so
+ * none of the buffers has to be sized by hand.
+ */
+struct config_footprint {
+    std::size_t setting_count;         /**< Number of settings to process. */
+    std::size_t max_tag_length;        /**< Characters of the longest tag-name. */
+    std::size_t max_value_size;        /**< Characters of the largest value. */
+    std::size_t parser_string_size;    /**< Bytes of the SAXML string buffer. */
+    std::size_t max_parsing_errors;    /**< Parsing-errors that can be stored. */
+    std::size_t max_validation_errors; /**< Validation-errors that can be stored. */
+    std::size_t error_bytes;           /**< Bytes of all the error-handlers. */
+    std::size_t file_block_size;       /**< Bytes of a streamed block of a file. */
+    std::size_t main_config_size;      /**< Bytes of a main configuration object. */
+    std::size_t main_config_log_size;  /**< Bytes of the main-config log buffer. */
+    std::size_t handler_size;          /**< Bytes of the config-handler. */
+
+    /**
+     * @brief Gets the number of bytes that the buffers used for processing a config
+     * file occupy together.
+     * 
+     * @details The config-handler, the block that is being parsed and the buffer that
+     * the resulting main-config is logged with are counted as if they were all in use at
+     * the same time. The call frames of the functions involved are not included.
+     */
+    [[nodiscard]]
+    constexpr auto file_processing_bytes() const -> std::size_t
+    { return handler_size + file_block_size + main_config_log_size; }
+};
+
+/**
+ * @brief Computes the footprint of processing a config file in compile time.
+ * 
+ * @tparam Settings Container type that stores the settings in a contiguous sequence.
+ * @tparam MainConfig Configuration-object type that controls various internal systems.
+ * 
+ * @return Footprint of the config-handler that parses config files into the settings.
+ */
+template<typename Settings = default_setting_table, typename MainConfig = main_config,
+    typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
+[[nodiscard]]
+constexpr auto make_config_footprint() -> config_footprint {
+    using setting_t = typename Settings::value_type;
+    constexpr auto setting_count = int{std::tuple_size<Settings>{}};
+    using parser_t = xml_parser<typename Settings::iterator, setting_count>;
+
+    auto footprint = config_footprint{};
+    footprint.setting_count = std::size_t{setting_count};
+    if constexpr (has_max_tag_length_v<setting_t>) {
+        footprint.max_tag_length = setting_t::max_tag_length;
+    }
+    footprint.max_value_size = setting_t::max_value_size;
+    footprint.parser_string_size = parser_t::string_size;
+    footprint.max_parsing_errors = std::size_t{setting_count};
+    footprint.max_validation_errors = std::size_t{setting_count} * 2;
+    footprint.error_bytes = sizeof(error_handler<setting_count>) * 3;
+    footprint.file_block_size = file_block_size;
+    footprint.main_config_size = sizeof(MainConfig);
+    footprint.main_config_log_size = main_config_log_size;
+    footprint.handler_size = sizeof(config_handler<xml_parser, MainConfig, Settings>);
+    return footprint;
+}
+
+/**
+ * @var default_config_footprint
+ * 
+ * @brief Footprint of processing a config file into the default settings.
+ */
+inline constexpr auto default_config_footprint = make_config_footprint<>();
+
+/**
+ * @remark Ensures that a tag-name or value that is too long is never stored in the SAXML
+ * string buffer as if it fits.
+ */
+static_assert(default_config_footprint.parser_string_size
+    > default_config_footprint.max_tag_length + 2
+    and default_config_footprint.parser_string_size
+    > default_config_footprint.max_value_size + 2,
+    "The SAXML string buffer is too small for the tag-names and values of the settings");
+
+/**
+ * @remark Ensures that processing a config file fits within the RAM budget, if any.
+ */
+static_assert(CFG_CONFIG_RAM_BUDGET == 0
+    or default_config_footprint.file_processing_bytes() <= CFG_CONFIG_RAM_BUDGET,
+    "Processing a config file exceeds the budget set by CFG_CONFIG_RAM_BUDGET");
+
+} // namespace cfg
+
+#endif
@@ -17,10 +17,13 @@
 #ifndef CFG_CONFIG_CORE_CONFIG_HANDLER_H
 #define CFG_CONFIG_CORE_CONFIG_HANDLER_H
 
+#include "config-changes.h"
+#include "config-profiler.h"
 #include "main-config.h"
 
 #include <checking/default-verification-rules.h>
 #include <checking/validation-mode.h>
+#include <checking/verification-mode.h>
 #include <errors/error-handler.h>
 #include <settings/default-settings.h>
 #include <settings/setting-handler.h>
@@ -31,8 +34,11 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <optional>
+#include <string_view>
 #include <type_traits>
+#include <utility>
 
 /**
  * @namespace cfg
@@ -41,6 +47,32 @@
  */
 namespace cfg {
 
+/**
+ * @namespace detail
+ * 
+ * @brief Provides helper/meta functions/types local to this header file.
+ */
+namespace detail {
+
+/**
+ * @remark Checks if a parser can notify a handler of each setting of which the value has
+ * been parsed completely.
+ * 
+ * @tparam Parser Type of the parser to check.
+ * 
+ * @{
+ */
+template<typename Parser, typename = void>
+struct notifies_parsed_settings : std::false_type {};
+
+template<typename Parser>
+struct notifies_parsed_settings<Parser, std::void_t<
+    decltype(std::declval<Parser&>().set_setting_parsed_handler(nullptr, nullptr))>>
+    : std::true_type {};
+/** @} */
+
+} // namespace detail
+
 /**
  * @class config_handler
  * 
@@ -56,17 +88,20 @@ namespace cfg {
  * controlling various other parts of the program internally.
  * 
  * Potential parsing and validation errors are tracked by an error-handler and can be
- * reported respectively. After all is said and done, the main configuration object can
+ * reported respectively. If the parser notifies which settings it has parsed, each of
+ * these settings is validated right away, while the rest of the data is still being
+ * parsed. After all is said and done, the main configuration object can
  * be verified with a set of verification rules to prevent any misconfigurations.
  * 
  * @tparam Parser Template type of the concrete parser implementation.
  * @tparam MainConfig Configuration-object type that controls various internal systems.
- * @tparam Settings Container type that stores the settings in a contiguous sequence.
+ * @tparam Settings Container type that stores the settings in a contiguous sequence, which
+ * is a @ref setting_table of the default settings by default.
  */
 template<
     template<typename, auto, typename...> typename Parser,
     typename MainConfig = main_config,
-    typename Settings = decltype(get_default_settings()),
+    typename Settings = default_setting_table,
     typename = std::enable_if_t<is_data_type_v<MainConfig>>,
     typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
 class config_handler {
@@ -95,14 +130,110 @@ public:
      * that are validated successfully are mapped to the corresponding options within
      * the main configuration object.
      * 
+     * The returned change-set indicates which parts of the main configuration object
+     * differ from before, so that only the affected drivers and triggers have to be
+     * restarted.
+     * 
      * @tparam ConfigData Type of the config file or message data.
      * 
      * @param[in] data Actual data of the config file or message.
+     * 
+     * @return Change-set of the parts of the main configuration object that changed.
      */
     template<typename ConfigData>
-    constexpr auto process_config(ConfigData const& data) -> void {
-        parser.parse_config(data);
-        setting_handlr.apply_valid_settings(main_cfg_);
+    auto process_config(ConfigData const& data) -> config_changes {
+        auto const previous = main_cfg_;
+        parse_data(data);
+        apply_parsed_settings();
+        return diff_main_config(previous, main_cfg_);
+    }
+
+    /**
+     * @brief Processes a batch of configuration messages at once.
+     * 
+     * @details Works similarly to @ref process_config, except that every message of the
+     * batch is parsed into the same settings, in order, so that the values of a later
+     * message override those of an earlier one. The settings are only validated and
+     * applied once, after the last message has been parsed. If a message causes a
+     * parsing error, the messages that follow it are not parsed and the batch as a whole
+     * fails to process.
+     * 
+     * @tparam ConfigBatch Container type of the config messages.
+     * 
+     * @param[in] batch Container of config messages stored in a contiguous sequence.
+     * 
+     * @return Change-set of the parts of the main configuration object that changed.
+     */
+    template<typename ConfigBatch,
+        typename = std::enable_if_t<is_contiguous_container_v<ConfigBatch>>>
+    auto process_config_batch(ConfigBatch const& batch) -> config_changes {
+        auto const previous = main_cfg_;
+        for (auto const& data : batch) {
+            parse_data(data);
+        }
+        apply_parsed_settings();
+        return diff_main_config(previous, main_cfg_);
+    }
+
+    /**
+     * @brief Processes the contents of a configuration file that is provided in blocks.
+     * 
+     * @details Works similarly to @ref process_config, except that the data is fed to
+     * the parser block by block as the block-reader provides it. As such, the complete
+     * contents of the configuration file never have to be in memory at once. This
+     * requires the parser to support parsing in blocks.
+     * 
+     * @tparam BlockReader Type of a callable that accepts a block-handler.
+     * 
+     * @param[in] read_blocks Callable that invokes the provided block-handler with each
+     * block of data, in order.
+     * 
+     * @return The result of the block-reader, such as an @ref io_result.
+     */
+    template<typename BlockReader>
+    auto process_config_blocks(BlockReader&& read_blocks) {
+        connect_pipeline();
+        parser.begin_parsing();
+        auto const result = read_blocks([this](std::string_view block) {
+            auto const parsing = get_config_profiler().time_stage(config_stage::parse);
+            parser.parse_block(block);
+        });
+        parser.end_parsing();
+        disconnect_pipeline();
+        apply_parsed_settings();
+        return result;
+    }
+
+    /**
+     * @brief Sets, validates and applies the value of a single setting.
+     * 
+     * @details Skips the parsing of a complete configuration file or message, and every
+     * setting other than the given one and the settings that depend on it. This makes a
+     * one-off change, such as a remote tweak of a single setting, cheap. The value is
+     * given in the same form that the parser of this config-handler produces, such as
+     * the text within a tag for an XML parser. The validation errors of any earlier
+     * change are discarded, so that @ref has_config_errors only concerns this change.
+     * 
+     * The returned change-set can be passed to @ref verify_main_config, so that only the
+     * affected verification rules are verified.
+     * 
+     * @param[in] id Identifier of the setting.
+     * @param[in] value New value of the setting.
+     * 
+     * @return Change-set of the parts of the main configuration object that changed,
+     * which is empty if no setting has the identifier or if the value is not valid.
+     */
+    auto set_setting(setting_identifier id, std::string_view value) -> config_changes {
+        auto const index = find_setting_index(id);
+        if (index == std::size_t{setting_count}) return {};
+
+        auto const previous = main_cfg_;
+        setting_handlr.clear_errors();
+        settings_[index].set_value(value);
+        auto const applying = get_config_profiler().time_stage(config_stage::apply);
+        setting_handlr.apply_valid_setting(
+            static_cast<std::uint_fast16_t>(index), main_cfg_);
+        return diff_main_config(previous, main_cfg_);
     }
 
     /**
@@ -123,11 +254,41 @@ public:
         typename = std::enable_if_t<is_contiguous_container_v<VerifyRules>>>
     constexpr auto verify_main_config(
         VerifyRules const& rules = get_default_verification_rules())
+    {
+        return verify_main_config(
+            config_changes::all(), verification_mode::complete, rules);
+    }
+
+    /**
+     * @brief Verifies the settings of the main configuration object that changed.
+     * 
+     * @details Only the verification rules that read any of the changed parts of the
+     * main configuration object are verified, in order. This requires the main
+     * configuration object to have passed verification before the changes were made.
+     * 
+     * @tparam VerifyRules Container type of the verification rules.
+     * 
+     * @param[in] changes Parts of the main configuration object that changed, such as
+     * returned by @ref process_config.
+     * @param[in] mode Indicates whether to stop at the first verification error.
+     * @param[in] rules Container of verification rules stored in a contiguous sequence.
+     * 
+     * @return The resulting verification consists of an error-handler that contains zero
+     * or more verifiction errors.
+     */
+    template<typename VerifyRules = decltype(get_default_verification_rules()),
+        typename = std::enable_if_t<is_contiguous_container_v<VerifyRules>>>
+    constexpr auto verify_main_config(
+        config_changes const& changes,
+        verification_mode mode = verification_mode::complete,
+        VerifyRules const& rules = get_default_verification_rules())
     {
         auto verification = error_handler<std::tuple_size<VerifyRules>{}>{};
         for (auto const& rule : rules) {
+            if (not rule.is_affected_by(changes)) continue;
             if (auto const error_id = rule.verify(main_cfg_); error_id) {
                 verification.add_error(*error_id, rule.id());
+                if (mode == verification_mode::fail_fast) break;
             }
         }
         return verification;
@@ -159,6 +320,31 @@ public:
         setting_handlr.report_validation_errors();
     }
 
+    /**
+     * @brief Exports any parsing or validation error that might have occurred during the
+     * processing of a configuration file as compact binary error records.
+     * 
+     * @details The records are about a quarter of the size of the logged error codes,
+     * which makes them suitable to be stored on the SD-card or to be sent within a
+     * diagnostic LoRaWAN uplink. Refer to @ref error_record_format for their layout.
+     * Sources without any errors are left out.
+     * 
+     * @param[out] buffer Buffer to write the error records to.
+     * @param[in] buffer_size Capacity of the buffer, in number of bytes.
+     * 
+     * @return Number of bytes written.
+     */
+    constexpr auto export_config_errors(
+        std::byte* buffer, std::size_t buffer_size) const -> std::size_t
+    {
+        auto written = std::size_t{};
+        if (parser.has_parsing_errors()) {
+            written += parser.export_parsing_errors(buffer, buffer_size);
+        }
+        return written + setting_handlr.export_validation_errors(
+            buffer + written, buffer_size - written);
+    }
+
     /**
      * @brief Gets the main configuration object.
      * 
@@ -168,14 +354,36 @@ public:
     constexpr auto get_main_config() const -> MainConfig const&
     { return main_cfg_; }
 
+    /**
+     * @brief Gets the concrete parser implementation.
+     * 
+     * @details This allows the parser to be configured before it is used to process a
+     * configuration file or message, such as providing it with a tag-lookup.
+     * 
+     * @return (Const-)reference to the parser.
+     * 
+     * @{
+     */
+    [[nodiscard]]
+    constexpr auto get_parser() -> auto&
+    { return parser; }
+
+    [[nodiscard]]
+    constexpr auto get_parser() const -> auto const&
+    { return parser; }
+    /** @} */
+
     /**
      * @brief Resets the main configuration object to its initial values.
      * 
      * @details This function can be used to reset the values of the main configuration
-     * object before processing another configuration file. 
+     * object before processing another configuration file. All of the settings are
+     * applied again when the next configuration file is processed.
      */
-    constexpr auto reset_main_config() -> void
-    { main_cfg_.reset(); }
+    constexpr auto reset_main_config() -> void {
+        main_cfg_.reset();
+        setting_handlr.reset_applied_settings();
+    }
 
     /**
      * @brief Sets new values to the main configuration object.
@@ -185,10 +393,15 @@ public:
      * run-time environment, some values of the main configuration object remain
      * unaltered and can be used to fall back on whenever a setting could not be applied.
      * 
+     * All of the settings are applied again when the next configuration file is
+     * processed, since the new values may differ from the ones they applied before.
+     * 
      * @param[in] main_cfg New values for the main configuration object.
      */
-    constexpr auto set_main_config(MainConfig const& main_cfg) -> void
-    { main_cfg_ = main_cfg; }
+    constexpr auto set_main_config(MainConfig const& main_cfg) -> void {
+        main_cfg_ = main_cfg;
+        setting_handlr.reset_applied_settings();
+    }
 
     /**
      * @brief Sets new settings to the settings container.
@@ -205,8 +418,10 @@ public:
      * 
      * @param[in] settings New container of settings.
      */
-    constexpr auto set_settings(Settings const& settings) -> void
-    { settings_ = settings; }
+    constexpr auto set_settings(Settings const& settings) -> void {
+        settings_ = settings;
+        setting_handlr.reset_applied_settings();
+    }
 
 private:
     /**
@@ -223,25 +438,127 @@ private:
      */
     using setting_iter = typename Settings::iterator;
 
+    /**
+     * @typedef parser_t
+     * 
+     * @brief Shorter notation to refer to the provided parser-implementation type.
+     */
+    using parser_t = Parser<setting_iter, setting_count>;
+
     /**
      * @typedef setting_handler_t
      * 
-     * @brief Shorter notation to refer to the setting-handler type.
+     * @brief Shorter notation to refer to the setting-handler type, which validates the
+     * settings in the validation mode of the parser.
      */
-    using setting_handler_t = setting_handler<setting_iter, setting_count>;
+    using setting_handler_t
+        = setting_handler<setting_iter, setting_count, parser_t::validation>;
 
     /**
-     * @typedef parser_t
+     * @brief Parses a configuration file or message into the settings.
      * 
-     * @brief Shorter notation to refer to the provided parser-implementation type.
+     * @tparam ConfigData Type of the config file or message data.
+     * 
+     * @param[in] data Actual data of the config file or message.
      */
-    using parser_t = Parser<setting_iter, setting_count>;
+    template<typename ConfigData>
+    auto parse_data(ConfigData const& data) -> void {
+        auto const parsing = get_config_profiler().time_stage(config_stage::parse);
+        connect_pipeline();
+        parser.parse_config(data);
+        disconnect_pipeline();
+    }
+
+    /**
+     * @brief Validates and applies the settings that have been parsed.
+     * 
+     * @details The validation errors of an earlier processing are discarded first, so
+     * that @ref has_config_errors only concerns the settings that have been parsed last.
+     */
+    auto apply_parsed_settings() -> void {
+        auto const applying = get_config_profiler().time_stage(config_stage::apply);
+        setting_handlr.clear_errors();
+        setting_handlr.apply_valid_settings(main_cfg_);
+    }
+
+    /**
+     * @brief Validates a setting as soon as the parser has parsed its value.
+     * 
+     * @param[in] object Instance of a config-handler object to operate on.
+     * @param[in] index Index of the parsed setting.
+     */
+    static constexpr auto handle_parsed_setting(
+        void* object, std::uint_fast16_t index) -> void
+    {
+        auto& handler = *static_cast<config_handler*>(object);
+        handler.setting_handlr.validate_parsed_setting(index);
+    }
+
+    /**
+     * @brief Lets the parser hand each parsed setting to the setting-handler, so that
+     * the settings are validated while the rest of the data is being parsed.
+     * 
+     * @details The config-handler is only connected for the duration of a single parse,
+     * so that it can still be copied or moved in between.
+     */
+    constexpr auto connect_pipeline() -> void {
+        if constexpr (detail::notifies_parsed_settings<parser_t>{}) {
+            parser.set_setting_parsed_handler(&handle_parsed_setting, this);
+        }
+    }
+
+    /**
+     * @brief Stops the parser from handing parsed settings to the setting-handler.
+     */
+    constexpr auto disconnect_pipeline() -> void {
+        if constexpr (detail::notifies_parsed_settings<parser_t>{}) {
+            parser.set_setting_parsed_handler(nullptr, nullptr);
+        }
+    }
+
+    /**
+     * @brief Finds the index of the setting with a given identifier.
+     * 
+     * @details A setting table is looked up by its index of identifiers directly. Other
+     * types of containers are searched.
+     * 
+     * @param[in] id Identifier of the setting.
+     * 
+     * @return Index of the setting, or the number of settings if no setting has the
+     * identifier.
+     */
+    [[nodiscard]]
+    constexpr auto find_setting_index(setting_identifier id) const -> std::size_t {
+        if constexpr (is_setting_table_v<Settings>) {
+            return Settings::find_index(id);
+        } else {
+            auto index = std::size_t{};
+            while (index < settings_.size() and settings_[index].id() != id) ++index;
+            return index;
+        }
+    }
+
+    /**
+     * @brief Makes the initial container of settings.
+     * 
+     * @details A setting table already describes the default settings on its own, so
+     * only other types of containers are initialized with the default settings.
+     * 
+     * @return Container of the default settings.
+     */
+    [[nodiscard]]
+    static constexpr auto make_default_settings() -> Settings {
+        if constexpr (is_setting_table_v<Settings>) {
+            return Settings{};
+        } else {
+            return get_default_settings();
+        }
+    }
 
     MainConfig main_cfg_{};                       /**< Main configuration object. */
-    Settings settings_{get_default_settings()};   /**< Container of settings. */
+    Settings settings_{make_default_settings()};  /**< Container of settings. */
     parser_t parser{settings_};                   /**< Concrete parser implementation. */
-    setting_handler_t setting_handlr{
-        settings_, validation_mode::config_file}; /**< Validates and applies settings. */
+    setting_handler_t setting_handlr{settings_};  /**< Validates and applies settings. */
 };
 
 } // namespace cfg
@@ -0,0 +1,369 @@
+/**
+ * @file config-profiler.h
+ * @brief Optional instrumentation of the stages of processing a configuration file.
+ * 
+ * @version 1.0
+ * @date December 2021
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_CONFIG_CORE_CONFIG_PROFILER_H
+#define CFG_CONFIG_CORE_CONFIG_PROFILER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @def CFG_CONFIG_PROFILING
+ * 
+ * @brief Enables the instrumentation of the config processing stages if non-zero.
+ * 
+ * @details When disabled, which is the default, the profiler does nothing at all and
+ * none of the macros below are expanded.
+ */
+#ifndef CFG_CONFIG_PROFILING
+#define CFG_CONFIG_PROFILING 0
+#endif
+
+/**
+ * @def CFG_CONFIG_PROFILING_START
+ * 
+ * @brief Starts the cycle counter that is read by @ref CFG_CONFIG_PROFILING_CYCLES.
+ * 
+ * @details Defaults to enabling the DWT cycle counter of the Cortex-M core. Define both
+ * macros to use another timer instead, such as SysTick on cores without a DWT unit.
+ */
+#ifndef CFG_CONFIG_PROFILING_START
+#define CFG_CONFIG_PROFILING_START()                          \
+    do {                                                      \
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;       \
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;                  \
+    } while (false)
+#endif
+
+/**
+ * @def CFG_CONFIG_PROFILING_CYCLES
+ * 
+ * @brief Reads the current value of an up-counting 32-bit cycle counter.
+ */
+#ifndef CFG_CONFIG_PROFILING_CYCLES
+#define CFG_CONFIG_PROFILING_CYCLES() (static_cast<std::uint32_t>(DWT->CYCCNT))
+#endif
+
+/**
+ * @def CFG_CONFIG_PROFILING_STACK_WINDOW
+ * 
+ * @brief Number of bytes below the current stack pointer that are painted to find the
+ * stack watermark of a stage.
+ * 
+ * @details The window must fit within the free part of the stack. Stack usage beyond
+ * the window is not detected.
+ */
+#ifndef CFG_CONFIG_PROFILING_STACK_WINDOW
+#define CFG_CONFIG_PROFILING_STACK_WINDOW 2048
+#endif
+
+/**
+ * @namespace cfg
+ * 
+ * @brief Contains everything related to the processing of configuration files.
+ */
+namespace cfg {
+
+/**
+ * @var config_profiling
+ * 
+ * @brief Indicates whether the config processing stages are being instrumented.
+ */
+inline constexpr auto config_profiling = bool{CFG_CONFIG_PROFILING != 0};
+
+/**
+ * @enum config_stage
+ * 
+ * @brief Stages of processing a configuration file or message.
+ */
+enum class config_stage : std::uint8_t {
+    load,   /**< Reading the configuration file from the SD-card. */
+    parse,  /**< Parsing the configuration data into the settings. */
+    apply,  /**< Validating and applying the settings. */
+    verify, /**< Verifying the main configuration object. */
+    log,    /**< Logging the outcome of the processing. */
+};
+
+/**
+ * @var config_stage_count
+ * 
+ * @brief Number of stages of processing a configuration file or message.
+ */
+inline constexpr auto config_stage_count = std::size_t{5};
+
+/**
+ * @struct stage_profile
+ * 
+ * @brief Measurements of a single stage of processing a configuration file.
+ */
+struct stage_profile {
+    std::uint32_t cycles;      /**< Cycles spent in the stage, excluding nested stages. */
+    std::uint32_t stack_bytes; /**< Peak stack depth reached during the stage. */
+    std::uint32_t entries;     /**< Number of times the stage was entered. */
+};
+
+/**
+ * @struct config_profile
+ * 
+ * @brief Measurements of all the stages of processing a configuration file.
+ */
+struct config_profile {
+    /**
+     * @brief Gets the measurements of a stage.
+     * 
+     * @param[in] stage Stage to get the measurements of.
+     * 
+     * @return (Const-)reference to the measurements of the stage.
+     * 
+     * @{
+     */
+    [[nodiscard]]
+    constexpr auto operator[](config_stage stage) -> stage_profile&
+    { return stages[static_cast<std::size_t>(stage)]; }
+
+    [[nodiscard]]
+    constexpr auto operator[](config_stage stage) const -> stage_profile const&
+    { return stages[static_cast<std::size_t>(stage)]; }
+    /** @} */
+
+    std::array<stage_profile, config_stage_count> stages; /**< Measurements per stage. */
+};
+
+/**
+ * @namespace detail
+ * 
+ * @brief Provides helper/meta functions/types local to this header file.
+ */
+namespace detail {
+
+/**
+ * @var stack_paint
+ * 
+ * @brief Pattern that the unused part of the stack is painted with.
+ */
+inline constexpr auto stack_paint = std::uint32_t{0xC5C5'C5C5u};
+
+/**
+ * @brief Reads the cycle counter.
+ */
+inline auto read_cycles() -> std::uint32_t {
+#if CFG_CONFIG_PROFILING
+    return CFG_CONFIG_PROFILING_CYCLES();
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Paints the stack window below the frame of this function.
+ * 
+ * @details The stack is assumed to grow downwards. The window starts a small distance
+ * below the frame, so that the painting does not overwrite the frame itself.
+ * 
+ * @return Address of the top of the painted window.
+ */
+__attribute__((noinline))
+inline auto paint_stack() -> std::uintptr_t {
+#if CFG_CONFIG_PROFILING
+    auto const frame = reinterpret_cast<std::uintptr_t>(__builtin_frame_address(0));
+    auto const top = (frame - 128) & ~std::uintptr_t{3};
+    auto const words = std::size_t{CFG_CONFIG_PROFILING_STACK_WINDOW} / 4;
+    auto* const window = reinterpret_cast<std::uint32_t volatile*>(top) - words;
+    for (auto idx = std::size_t{}; idx < words; ++idx) {
+        window[idx] = stack_paint;
+    }
+    return top;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Finds the lowest address of a painted stack window that has been written to.
+ * 
+ * @param[in] top Address of the top of the painted window.
+ * 
+ * @return Lowest address that no longer holds the paint, or the top of the window if
+ * the window is untouched.
+ */
+inline auto find_stack_watermark(std::uintptr_t top) -> std::uintptr_t {
+#if CFG_CONFIG_PROFILING
+    auto const words = std::size_t{CFG_CONFIG_PROFILING_STACK_WINDOW} / 4;
+    auto const* const window = reinterpret_cast<std::uint32_t volatile*>(top) - words;
+    for (auto idx = std::size_t{}; idx < words; ++idx) {
+        if (window[idx] != stack_paint) {
+            return reinterpret_cast<std::uintptr_t>(window + idx);
+        }
+    }
+#endif
+    return top;
+}
+
+} // namespace detail
+
+/**
+ * @class config_profiler
+ * 
+ * @brief Measures the cycles and the peak stack depth of each stage of processing a
+ * configuration file.
+ * 
+ * @details A stage is timed for as long as a @ref scoped_stage of it exists. Stages can
+ * be nested, in which case the cycles of the inner stage are not counted for the outer
+ * one. The stack is painted whenever a stage is entered or left, and checked again
+ * afterwards; the painting itself is not counted. The peak stack depth of a stage is
+ * measured from the stack pointer at the time the profiler was reset.
+ * 
+ * If @ref CFG_CONFIG_PROFILING is disabled, all of the member functions do nothing.
+ */
+class config_profiler {
+public:
+    /**
+     * @class scoped_stage
+     * 
+     * @brief Times a stage for the lifetime of the object.
+     */
+    class scoped_stage {
+    public:
+        /**
+         * @brief Enters a stage.
+         * 
+         * @param[in,out] profiler Profiler that measures the stage.
+         * @param[in] stage Stage to enter.
+         */
+        scoped_stage(config_profiler& profiler, config_stage stage)
+            : profiler_{profiler}, previous{profiler.enter(stage)} {}
+
+        /**
+         * @brief Leaves the stage and returns to the stage that was entered before.
+         */
+        ~scoped_stage()
+        { profiler_.enter(previous); }
+
+        scoped_stage(scoped_stage const&) = delete;
+        auto operator=(scoped_stage const&) -> scoped_stage& = delete;
+
+    private:
+        config_profiler& profiler_; /**< Profiler that measures the stage. */
+        std::uint8_t previous;      /**< Stage that was entered before. */
+    };
+
+    /**
+     * @brief Clears all the measurements and starts the cycle counter.
+     */
+    auto reset() -> void {
+        if constexpr (config_profiling) {
+#if CFG_CONFIG_PROFILING
+            CFG_CONFIG_PROFILING_START();
+#endif
+            profile = {};
+            current = no_stage;
+            stack_top = detail::paint_stack();
+            stack_base = stack_top;
+            last_cycles = detail::read_cycles();
+        }
+    }
+
+    /**
+     * @brief Times a stage until the returned object is destroyed.
+     * 
+     * @param[in] stage Stage to time.
+     * 
+     * @return Object that times the stage for its lifetime.
+     */
+    [[nodiscard]]
+    auto time_stage(config_stage stage) -> scoped_stage
+    { return {*this, stage}; }
+
+    /**
+     * @brief Gets the measurements of all the stages.
+     */
+    [[nodiscard]]
+    auto get_profile() const -> config_profile const&
+    { return profile; }
+
+private:
+    /**
+     * @var no_stage
+     * 
+     * @brief Indicates that no stage is being timed.
+     */
+    static constexpr auto no_stage = std::uint8_t{config_stage_count};
+
+    /**
+     * @brief Charges the measurements so far to the current stage and switches to
+     * another stage.
+     * 
+     * @details Only switching to a stage as such counts as an entry of it. Returning to
+     * the stage that was timed before a nested stage does not.
+     * 
+     * @param[in] stage Stage to switch to.
+     * 
+     * @return Stage that was timed before.
+     * 
+     * @{
+     */
+    auto enter(config_stage stage) -> std::uint8_t {
+        if constexpr (config_profiling) {
+            ++profile[stage].entries;
+        }
+        return enter(static_cast<std::uint8_t>(stage));
+    }
+
+    auto enter(std::uint8_t stage) -> std::uint8_t {
+        if constexpr (config_profiling) {
+            auto const cycles = detail::read_cycles();
+            if (current != no_stage) {
+                auto& measured = profile.stages[current];
+                auto const watermark = detail::find_stack_watermark(stack_top);
+                auto const depth = static_cast<std::uint32_t>(
+                    watermark < stack_base ? stack_base - watermark : 0);
+                measured.cycles += cycles - last_cycles;
+                if (depth > measured.stack_bytes) measured.stack_bytes = depth;
+            }
+            stack_top = detail::paint_stack();
+            last_cycles = detail::read_cycles();
+        }
+        auto const previous = current;
+        current = stage;
+        return previous;
+    }
+    /** @} */
+
+    config_profile profile{};         /**< Measurements of all the stages. */
+    std::uintptr_t stack_base{};      /**< Stack address at the time of the reset. */
+    std::uintptr_t stack_top{};       /**< Top of the currently painted stack window. */
+    std::uint32_t last_cycles{};      /**< Cycle count when the stage was switched. */
+    std::uint8_t current{no_stage};   /**< Stage that is currently being timed. */
+};
+
+/**
+ * @brief Gets the profiler of the config processing stages.
+ * 
+ * @details The measurements of the configuration file or message that was processed
+ * last can be obtained with its @ref config_profiler::get_profile member function.
+ * 
+ * @return Reference to the default profiler.
+ */
+[[nodiscard]]
+inline auto get_config_profiler() -> config_profiler& {
+    static auto profiler = config_profiler{};
+    return profiler;
+}
+
+} // namespace cfg
+
+#endif
@@ -0,0 +1,107 @@
+/**
+ * @file config-slots.h
+ * @brief Double-buffered storage of the main configuration object.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_CONFIG_CORE_CONFIG_SLOTS_H
+#define CFG_CONFIG_CORE_CONFIG_SLOTS_H
+
+#include "main-config.h"
+
+#include <traits/class-traits.h>
+
+#include <array>
+#include <atomic>
+#include <type_traits>
+
+/**
+ * @namespace cfg
+ * 
+ * @brief Contains everything related to the processing of configuration files.
+ */
+namespace cfg {
+
+/**
+ * @class config_slots
+ * 
+ * @brief Holds an active and a candidate main configuration object.
+ * 
+ * @details The framework keeps using the active configuration, while a new one is being
+ * processed into the candidate slot. Once the candidate has passed verification, it is
+ * made active by flipping a single pointer, which is atomic with respect to any reader
+ * of the active configuration, such as an interrupt handler. The previously active
+ * configuration then becomes the next candidate. If a new configuration is rejected,
+ * the candidate is simply never committed, so the active configuration stays in place
+ * rather than being reset to its default values.
+ * 
+ * @warning A reference to the active configuration stays valid until the next commit
+ * after the one that replaced it, since only then is its slot written to again.
+ * 
+ * @tparam MainConfig Configuration-object type that controls various internal systems.
+ */
+template<typename MainConfig = main_config,
+    typename = std::enable_if_t<is_data_type_v<MainConfig>>>
+class config_slots {
+public:
+    /**
+     * @brief Constructs the slots with the default main configuration object active.
+     */
+    config_slots() = default;
+
+    /**
+     * @brief Constructs the slots with a given main configuration object active.
+     * 
+     * @param[in] main_cfg Main configuration object to make active.
+     */
+    explicit config_slots(MainConfig const& main_cfg)
+        : slots{main_cfg, main_cfg} {}
+
+    config_slots(config_slots const&) = delete;
+    auto operator=(config_slots const&) -> config_slots& = delete;
+
+    /**
+     * @brief Gets the main configuration object that is currently in use.
+     */
+    [[nodiscard]]
+    auto active() const -> MainConfig const&
+    { return *active_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Gets the main configuration object that is being prepared.
+     * 
+     * @details The candidate is not in use, so it can be written to freely until it is
+     * committed.
+     */
+    [[nodiscard]]
+    auto candidate() -> MainConfig& {
+        auto const* const current = active_.load(std::memory_order_relaxed);
+        return current == &slots[0] ? slots[1] : slots[0];
+    }
+
+    /**
+     * @brief Makes the candidate the active main configuration object.
+     * 
+     * @details The previously active configuration becomes the new candidate.
+     */
+    auto commit_candidate() -> void
+    { active_.store(&candidate(), std::memory_order_release); }
+
+private:
+    std::array<MainConfig, 2> slots{};                /**< Both configuration objects. */
+    std::atomic<MainConfig const*> active_{&slots[0]}; /**< Active configuration. */
+};
+
+} // namespace cfg
+
+#endif
@@ -0,0 +1,113 @@
+/**
+ * @file device-config.h
+ * @brief Host-side compilation of the configs of individual devices within a fleet.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_CONFIG_CORE_DEVICE_CONFIG_H
+#define CFG_CONFIG_CORE_DEVICE_CONFIG_H
+
+#include "embedded-config.h"
+#include "main-config.h"
+
+#include <checking/default-verification-rules.h>
+#include <errors/error-code.h>
+#include <parsing/image-parser.h>
+#include <traits/class-traits.h>
+
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+
+/**
+ * @namespace cfg
+ * 
+ * @brief Contains everything related to the processing of configuration files.
+ */
+namespace cfg {
+
+/**
+ * @struct device_config
+ * 
+ * @brief Outcome of compiling the config of a single device.
+ */
+struct device_config {
+    main_config main_cfg;             /**< Main configuration object of the device. */
+    std::optional<error::code> error; /**< First error found, if any. */
+    std::size_t image_size;           /**< Size of the written config image. */
+
+    /**
+     * @brief Checks if the config passed its checks and its image was written.
+     */
+    [[nodiscard]]
+    constexpr auto is_compiled() const -> bool
+    { return not error and image_size != 0; }
+};
+
+/**
+ * @brief Compiles the config of a single device within a fleet to a config image.
+ * 
+ * @details The settings that are shared by the fleet are copied, after which the values
+ * that are specific to the device are set with @ref set_embedded_values. The resulting
+ * settings are checked with @ref check_config_settings, and only if they pass, they are
+ * written with @ref write_config_image. The device thus receives an image that has been
+ * validated and verified the same way as its config file would have been.
+ * 
+ * The base settings are expected in the textual form of a config file, such as after a
+ * host tool has parsed the fleet's config file with an @ref xml_parser. No global state
+ * is used, so the configs of different devices can be compiled concurrently, as long as
+ * each device has its own buffer.
+ * 
+ * @tparam Settings Container type that stores its contents in a contiguous sequence.
+ * @tparam Values Container type of the embedded values.
+ * @tparam VerifyRules Container type of the verification rules.
+ * 
+ * @param[in] base Settings that are shared by all devices of the fleet.
+ * @param[in] values Values of the settings that are specific to the device, which take
+ * precedence over the base settings.
+ * @param[out] buffer Pointer to the first byte of the buffer to write the image to.
+ * @param[in] buffer_size Capacity of the buffer.
+ * @param[in] rules Container of verification rules stored in a contiguous sequence.
+ * 
+ * @return Main configuration object of the device, along with the first error found
+ * and the size of the image. The image size is zero if the config did not pass its
+ * checks, or if the image did not fit within the buffer.
+ */
+template<typename Settings, typename Values,
+    typename VerifyRules = decltype(get_default_verification_rules()),
+    typename = std::enable_if_t<is_contiguous_container_v<Settings>
+        and is_contiguous_container_v<Values>
+        and is_contiguous_container_v<VerifyRules>>>
+[[nodiscard]]
+constexpr auto compile_device_config(
+    Settings const& base,
+    Values const& values,
+    std::byte* buffer,
+    std::size_t buffer_size,
+    VerifyRules const& rules = get_default_verification_rules()
+) -> device_config {
+    auto settings = base;
+    if (auto const error = set_embedded_values(settings, values); error) {
+        return {main_config{}, error, 0};
+    }
+
+    auto const checked = check_config_settings(settings, rules);
+    if (checked.error) return {checked.main_cfg, checked.error, 0};
+
+    return {checked.main_cfg, std::nullopt,
+        write_config_image(settings, buffer, buffer_size)};
+}
+
+} // namespace cfg
+
+#endif
@@ -0,0 +1,271 @@
+/**
+ * @file embedded-config.h
+ * @brief Validation and verification of configurations that are embedded at build time.
+ * 
+ * @version 1.0
+ * @date December 2021
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_CONFIG_CORE_EMBEDDED_CONFIG_H
+#define CFG_CONFIG_CORE_EMBEDDED_CONFIG_H
+
+#include "main-config.h"
+
+#include <checking/default-verification-rules.h>
+#include <checking/validation-mode.h>
+#include <errors/error-code.h>
+#include <errors/error-types.h>
+#include <settings/default-settings.h>
+#include <settings/setting-handler.h>
+#include <settings/setting-identifiers.h>
+#include <settings/setting-table.h>
+#include <traits/class-traits.h>
+#include <utilities/enum.h>
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * @namespace cfg
+ * 
+ * @brief Contains everything related to the processing of configuration files.
+ */
+namespace cfg {
+
+/**
+ * @struct embedded_value
+ * 
+ * @brief Value of a setting that is embedded at build time, in the same textual form as
+ * the contents of its tag within a config file.
+ */
+struct embedded_value {
+    setting_identifier id;  /**< Identifier of the setting. */
+    std::string_view value; /**< Value of the setting. */
+};
+
+/**
+ * @struct embedded_config
+ * 
+ * @brief Outcome of checking a configuration that is embedded at build time.
+ */
+struct embedded_config {
+    main_config main_cfg;             /**< Main configuration object of the values. */
+    std::optional<error::code> error; /**< First error found, if any. */
+};
+
+/**
+ * @namespace detail
+ * 
+ * @brief Provides helper/meta functions/types local to this header file.
+ */
+namespace detail {
+
+/**
+ * @brief Signals that an embedded configuration is not valid.
+ * 
+ * @details This function is deliberately not constexpr. Reaching it while a constant
+ * expression is evaluated makes that evaluation, and therefore the build, fail.
+ */
+inline auto embedded_config_is_invalid() -> void {}
+
+/**
+ * @brief Checks if a setting is disabled by its flag-setting, while the settings are
+ * checked by @ref check_config_settings.
+ * 
+ * @details A flag-setting counts as applied if it is set and valid, and if it is not
+ * disabled itself, alike to how a setting-handler applies it. Its value is validated
+ * again, since the converted value can not be read from the cache of the table.
+ * 
+ * @tparam Setting Type of the setting to check.
+ * @tparam Settings Container type that stores its contents in a contiguous sequence.
+ * 
+ * @param[in] setting_obj Object of the setting to check.
+ * @param[in] settings Container with the settings that are checked.
+ * 
+ * @return True if the setting is disabled, false otherwise.
+ */
+template<typename Setting, typename Settings>
+[[nodiscard]]
+constexpr auto is_checked_setting_disabled(
+    Setting const& setting_obj, Settings const& settings)
+-> bool {
+    return is_disabled_by_flag(setting_obj, settings,
+        [&settings](auto, auto const& flag_obj) {
+            if (not flag_obj.is_set()) return false;
+            if (is_checked_setting_disabled(flag_obj, settings)) return false;
+            auto const [data, status] = flag_obj.validator()(
+                flag_obj.view_value(), validation_mode::config_file, setting_data{});
+            return not status and not data.value_or(setting_data{}).flag;
+        });
+}
+
+} // namespace detail
+
+/**
+ * @brief Checks the settings of a configuration, in the same way as a config file.
+ * 
+ * @details Every setting is validated and applied the same way as when a config file
+ * is processed, after which the resulting main configuration object is verified. The
+ * converted values are passed on directly rather than cached in the table, since its
+ * cache is mutable and can thus not be accessed in a constant expression. Optional
+ * settings may be unset, whereas required ones may not. A setting that is disabled by
+ * its flag-setting is skipped, the same way as @ref setting_handler skips it, so the
+ * children of a disabled trigger may be left out. No global state is used, so the
+ * settings of different configurations can be checked concurrently.
+ * 
+ * The check stops at the first error. Its error code identifies the setting or the
+ * verification rule that caused it, in the same way as a logged error code does.
+ * 
+ * @tparam Settings Container type that stores its contents in a contiguous sequence.
+ * @tparam VerifyRules Container type of the verification rules.
+ * 
+ * @param[in] settings Container with the settings to check, of which the values are in
+ * the textual form of the contents of their tags within a config file.
+ * @param[in] rules Container of verification rules stored in a contiguous sequence.
+ * 
+ * @return Main configuration object of the settings, along with the first error found.
+ */
+template<typename Settings,
+    typename VerifyRules = decltype(get_default_verification_rules()),
+    typename = std::enable_if_t<is_contiguous_container_v<Settings>
+        and is_contiguous_container_v<VerifyRules>>>
+[[nodiscard]]
+constexpr auto check_config_settings(
+    Settings const& settings,
+    VerifyRules const& rules = get_default_verification_rules()
+) -> embedded_config {
+    auto main_cfg = main_config{};
+
+    for (auto const& setting_obj : settings) {
+        if (detail::is_checked_setting_disabled(setting_obj, settings)) continue;
+        if (not setting_obj.is_set()) {
+            if (setting_obj.type() == setting_type::optional) continue;
+            return {main_cfg, error::code{
+                validation_error::setting_unset, to_underlying(setting_obj.id())}};
+        }
+        auto const [data, status] = setting_obj.validator()(
+            setting_obj.view_value(), validation_mode::config_file, setting_data{});
+        if (status) {
+            return {main_cfg, error::code{*status, to_underlying(setting_obj.id())}};
+        }
+        setting_obj.action()(data.value_or(setting_data{}), main_cfg);
+    }
+
+    for (auto const& rule : rules) {
+        if (auto const error = rule.verify(main_cfg); error) {
+            return {main_cfg, error::code{*error, to_underlying(rule.id())}};
+        }
+    }
+    return {main_cfg, std::nullopt};
+}
+
+/**
+ * @brief Sets embedded values to the settings with matching identifiers.
+ * 
+ * @details An empty value unsets its setting. The values are set in order, so a later
+ * value of the same setting takes precedence.
+ * 
+ * @tparam Settings Container type that stores its contents in a contiguous sequence.
+ * @tparam Values Container type of the embedded values.
+ * 
+ * @param[in,out] settings Container with the settings to set the values to.
+ * @param[in] values Embedded values of the settings.
+ * 
+ * @return Error code of the first value that could not be set, if any.
+ */
+template<typename Settings, typename Values,
+    typename = std::enable_if_t<is_contiguous_container_v<Settings>
+        and is_contiguous_container_v<Values>>>
+constexpr auto set_embedded_values(Settings& settings, Values const& values)
+-> std::optional<error::code> {
+    for (auto const& entry : values) {
+        auto setting_obj = std::begin(settings);
+        while (setting_obj != std::end(settings) and setting_obj->id() != entry.id) {
+            ++setting_obj;
+        }
+        if (setting_obj == std::end(settings)) {
+            return error::code{
+                parsing_error::unknown_embedded_setting, to_underlying(entry.id)};
+        }
+        if (entry.value.size() > setting_obj->value_capacity()) {
+            return error::code{
+                parsing_error::exceeds_max_value_length, to_underlying(entry.id)};
+        }
+        setting_obj->set_value(entry.value);
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Checks a configuration that is embedded at build time, in compile time.
+ * 
+ * @details The values are set to a table of the default settings, which is then checked
+ * with @ref check_config_settings. Optional settings may be left out of the values,
+ * whereas required ones may not.
+ * 
+ * @tparam N Number of embedded values.
+ * @tparam VerifyRules Container type of the verification rules.
+ * 
+ * @param[in] values Embedded values of the settings.
+ * @param[in] rules Container of verification rules stored in a contiguous sequence.
+ * 
+ * @return Main configuration object of the values, along with the first error found.
+ */
+template<std::size_t N,
+    typename VerifyRules = decltype(get_default_verification_rules()),
+    typename = std::enable_if_t<is_contiguous_container_v<VerifyRules>>>
+[[nodiscard]]
+constexpr auto check_embedded_config(
+    std::array<embedded_value, N> const& values,
+    VerifyRules const& rules = get_default_verification_rules()
+) -> embedded_config {
+    auto settings = default_setting_table{};
+    if (auto const error = set_embedded_values(settings, values); error) {
+        return {main_config{}, error};
+    }
+    return check_config_settings(settings, rules);
+}
+
+/**
+ * @brief Makes a main configuration object from a configuration that is embedded at
+ * build time.
+ * 
+ * @details Intended to be evaluated in compile time, as in:
+ * 
+ * inline constexpr auto factory_config = make_embedded_config(std::array{
+ *     embedded_value{setting_identifier::device_name, "aether"}, ...});
+ * 
+ * The resulting object can be stored in flash, so that a unit that is started without
+ * a config file has no parsing cost at all. If the embedded configuration does not pass
+ * @ref check_embedded_config, the build fails instead.
+ * 
+ * @tparam N Number of embedded values.
+ * 
+ * @param[in] values Embedded values of the settings.
+ * 
+ * @return Validated and verified main configuration object.
+ */
+template<std::size_t N>
+[[nodiscard]]
+constexpr auto make_embedded_config(std::array<embedded_value, N> const& values)
+-> main_config {
+    auto const result = check_embedded_config(values);
+    if (result.error) detail::embedded_config_is_invalid();
+    return result.main_cfg;
+}
+
+} // namespace cfg
+
+#endif
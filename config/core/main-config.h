@@ -21,6 +21,7 @@
 
 #include <errors/error-handler.h>
 #include <strings/string-conversions.h>
+#include <strings/string-formatting.h>
 #include <traits/class-traits.h>
 
 // warning: implicitly includes 'all.h'
@@ -160,8 +161,8 @@ struct main_configuration {
     }
     /** @} */
 
-    std::array<char, max_name_size> device_name; /**< Buffer storing the device name. */
-    FrameworkConfig framework{};                 /**< Framework configuration object. */
+    std::array<char, max_name_size> device_name{}; /**< Buffer storing the device name. */
+    FrameworkConfig framework{};                   /**< Framework configuration object. */
 };
 
 /**
@@ -176,77 +177,95 @@ using main_config = main_configuration<>;
  */
 static_assert(is_data_type_v<main_config>);
 
+/**
+ * @var main_config_log_format
+ * 
+ * @brief Format string that is used to log a main configuration object.
+ */
+inline constexpr char main_config_log_format[] =
+    "[INFO]Active config contents:\n"
+    "  Name: %s\n"
+    "  USB settings\n"
+    "    detection: %s\n"
+    "    interval-ms: %lu\n"
+    "  Time trigger\n"
+    "    enabled: %i\n"
+    "    interval-ms: %lu\n"
+    "    Sensors\n"
+    "      thp: %i\n"
+    "      accel-gyro: %i\n"
+    "      magnet: %i\n"
+    "      light: %i\n"
+    "    Write to\n"
+    "      lorawan-priority: %hi\n"
+    "      lora: %i\n"
+    "      sd: %i\n"
+    "  Light trigger\n"
+    "    enabled: %i\n"
+    "    low-threshold: %hu\n"
+    "    high-threshold: %hu\n"
+    "    Sensors\n"
+    "      thp: %i\n"
+    "      accel-gyro: %i\n"
+    "      magnet: %i\n"
+    "      light: %i\n"
+    "    Write to\n"
+    "      lorawan-priority: %hi\n"
+    "      lora: %i\n"
+    "      sd: %i\n"
+    "  Acceleration trigger\n"
+    "    enabled: %i\n"
+    "    Sensors\n"
+    "      thp: %i\n"
+    "      accel-gyro: %i\n"
+    "      magnet: %i\n"
+    "      light: %i\n"
+    "    Write to\n"
+    "      lorawan-priority: %hi\n"
+    "      lora: %i\n"
+    "      sd: %i\n"
+    "  Orientation trigger\n"
+    "    enabled: %i\n"
+    "    Sensors\n"
+    "      thp: %i\n"
+    "      accel-gyro: %i\n"
+    "      magnet: %i\n"
+    "      light: %i\n"
+    "    Write to\n"
+    "      lorawan-priority: %hi\n"
+    "      lora: %i\n"
+    "      sd: %i\n";
+
+/**
+ * @var main_config_log_size
+ * 
+ * @brief Size of the buffer that is needed to log any main configuration object.
+ * 
+ * @details The device name is the longest string that is logged.
+ */
+inline constexpr auto main_config_log_size = std::size_t{
+    max_formatted_size(main_config_log_format, main_config::max_name_size - 1)
+};
+
 /**
  * @brief Logs all of the values of a main configuration object.
  * 
  * @warning This function consumes a decent chunk of available stack space. Be aware of
- * using it when most of the stack is already being occupied by something else. Also,
- * ensure to manually update the buffer-size of message to log, accordingly.
+ * using it when most of the stack is already being occupied by something else. The
+ * buffer-size of the message to log follows from @ref main_config_log_format.
  * 
  * @param[in] config Main configuration object to log.
  */
 inline auto log_main_config(main_config const& config) -> void {
-    std::array<char, 1024> message;
-    std::sprintf(message.data(),
-        "[INFO]Active config contents:\n"
-        "  Name: %s\n"
-        "  USB settings\n"
-        "    detection: %s\n"
-        "    interval-ms: %lu\n"
-        "  Time trigger\n"
-        "    enabled: %i\n"
-        "    interval-ms: %lu\n"
-        "    Sensors\n"
-        "      thp: %i\n"
-        "      accel-gyro: %i\n"
-        "      magnet: %i\n"
-        "      light: %i\n"
-        "    Write to\n"
-        "      lorawan-priority: %hi\n"
-        "      lora: %i\n"
-        "      sd: %i\n"
-        "  Light trigger\n"
-        "    enabled: %i\n"
-        "    low-threshold: %hu\n"
-        "    high-threshold: %hu\n"
-        "    Sensors\n"
-        "      thp: %i\n"
-        "      accel-gyro: %i\n"
-        "      magnet: %i\n"
-        "      light: %i\n"
-        "    Write to\n"
-        "      lorawan-priority: %hi\n"
-        "      lora: %i\n"
-        "      sd: %i\n"
-        "  Acceleration trigger\n"
-        "    enabled: %i\n"
-        "    Sensors\n"
-        "      thp: %i\n"
-        "      accel-gyro: %i\n"
-        "      magnet: %i\n"
-        "      light: %i\n"
-        "    Write to\n"
-        "      lorawan-priority: %hi\n"
-        "      lora: %i\n"
-        "      sd: %i\n"
-        "  Orientation trigger\n"
-        "    enabled: %i\n"
-        "    Sensors\n"
-        "      thp: %i\n"
-        "      accel-gyro: %i\n"
-        "      magnet: %i\n"
-        "      light: %i\n"
-        "    Write to\n"
-        "      lorawan-priority: %hi\n"
-        "      lora: %i\n"
-        "      sd: %i\n",
+    std::array<char, main_config_log_size> message;
+    std::sprintf(message.data(), main_config_log_format,
         config.device_name.data(),
         config.framework.usb_detection == USB_DETECTION::ON  ? "on"  :
         config.framework.usb_detection == USB_DETECTION::OFF ? "off" : "interval",
-        config.framework.usb_detection_interval_ms,
+        static_cast<unsigned long>(config.framework.usb_detection_interval_ms),
 
         config.framework.trigger.time.enable,
-        config.framework.trigger.time.interval_ms,
+        static_cast<unsigned long>(config.framework.trigger.time.interval_ms),
         config.framework.trigger.time.measure.thp,
         config.framework.trigger.time.measure.accel_gyro,
         config.framework.trigger.time.measure.magnet,
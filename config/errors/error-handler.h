@@ -21,20 +21,18 @@
 #include "error-types.h"
 
 #include <checking/verification-identifiers.h>
+#include <logging/logger.h>
 #include <parsing/file-pointer.h>
 #include <settings/setting-identifiers.h>
 #include <strings/zstring-view.h>
 #include <utilities/container.h>
 #include <utilities/enum.h>
 #include <traits/enum-traits.h>
-
-// warning: implicitly includes 'all.h'
-#include <logger.hpp>
+#include <utilities/bitwise.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
-#include <cstdio>
-#include <iterator>
 #include <type_traits>
 
 /**
@@ -45,35 +43,66 @@
 namespace cfg {
 
 /**
- * @class error_handler
+ * @enum error_source
  * 
- * @brief Stores and logs error codes.
+ * @brief Identifies the source of the error codes of a binary error record.
+ */
+enum class error_source : std::uint8_t {
+    parsing = 1,   /**< Parsing errors of a config file or message. */
+    unset_setting, /**< Settings that have not been set. */
+    invalid_value, /**< Settings with invalid values. */
+    verification,  /**< Verification errors of the main configuration object. */
+};
+
+/**
+ * @struct error_record_format
  * 
- * @tparam MaxErrors Maximum number of errors an error-handler can store.
+ * @brief Describes the layout of a binary error record.
+ * 
+ * @details An error record starts with a header that consists of the #marker, the @ref
+ * error_source and the number of error codes, one byte each. The header is followed by
+ * the packed 32-bit error codes, in little-endian byte order. Records can be placed one
+ * after another, such as within the payload of a diagnostic LoRaWAN uplink.
  */
-template<int MaxErrors,
-    typename = std::enable_if_t<(MaxErrors > 0)>>
-class error_handler {
+struct error_record_format {
     /**
-     * @typedef container
+     * @var marker
      * 
-     * @brief Shorter notation to refer to the type of the error-buffer.
+     * @brief Byte that marks the start of an error record.
      */
-    using container = array<error::code, MaxErrors>;
+    static constexpr auto marker = std::uint8_t{0xEC};
 
     /**
-     * @typedef iterator
+     * @var header_size
      * 
-     * @brief Shorter notation to refer to the error-buffer's iterator type.
+     * @brief Size of the header of an error record, in number of bytes.
      */
-    using iterator = typename container::iterator;
+    static constexpr auto header_size = std::size_t{3};
 
     /**
-     * @typedef const_iterator
+     * @var code_size
      * 
-     * @brief Shorter notation to refer to the error-buffer's const iterator type.
+     * @brief Size of a single error code, in number of bytes.
      */
-    using const_iterator = typename container::const_iterator;
+    static constexpr auto code_size = std::size_t{4};
+};
+
+/**
+ * @class error_handler
+ * 
+ * @brief Stores, logs and exports error codes.
+ * 
+ * @tparam MaxErrors Maximum number of errors an error-handler can store.
+ */
+template<int MaxErrors,
+    typename = std::enable_if_t<(MaxErrors > 0)>>
+class error_handler {
+    /**
+     * @typedef container
+     * 
+     * @brief Shorter notation to refer to the type of the error-buffer.
+     */
+    using container = array<error::code, MaxErrors>;
 
 public:
     /**
@@ -152,54 +181,88 @@ public:
      * @param[in] error_code Error code to add.
      */
     constexpr auto add_error(error::code error_code) -> void {
-        *top_error = error_code;
-        if (is_error_limit_reached()) return;
-        ++top_error;
+        if (is_error_limit_reached()) {
+            errors[top_error - 1] = error_code;
+        } else {
+            errors[top_error++] = error_code;
+        }
     }
 
     /**
      * @brief Logs all of the errors stored within the internal error-buffer.
      * 
-     * @details Error codes are formatted in a hexadecimal notation.
+     * @details The errors are added to the default log-buffer, which formats the error
+     * codes in a hexadecimal notation once it is flushed. If there are no errors, the
+     * request is simply ignored.
      * 
-     * @param[in] error_msg Optional error message that precedes the error codes.
+     * @param[in] error_msg Optional error message that precedes the error codes. The
+     * message must have a static storage duration, such as a string literal.
      */
     auto log_errors(zstring_view error_msg) const -> void {
-        if (is_error_limit_reached()) return;
+        if (is_error_limit_reached() or not contains_errors()) return;
+
+        auto& log = get_default_log();
         if (not error_msg.empty()) {
-            aether_log << error_msg.data();
+            log.log_text(error_msg.data());
+        }
+        std::for_each(errors.begin(), errors.begin() + top_error,
+            [&log](auto const error_code) { log.log_error_code(error_code.value()); });
+    }
+
+    /**
+     * @brief Exports all of the errors stored within the internal error-buffer as a
+     * binary error record.
+     * 
+     * @details The layout of the record is described by @ref error_record_format. If not
+     * all of the error codes fit in the buffer, only the ones that fit are exported.
+     * 
+     * @param[in] source Source of the errors, which is stored in the header.
+     * @param[out] buffer Buffer to write the error record to.
+     * @param[in] buffer_size Capacity of the buffer, in number of bytes.
+     * 
+     * @return Number of bytes written, which is zero if not even the header fits.
+     */
+    constexpr auto export_errors(
+        error_source source,
+        std::byte* buffer,
+        std::size_t buffer_size
+    ) const -> std::size_t {
+        using format = error_record_format;
+        if (buffer_size < format::header_size) return 0;
+
+        auto const fitting = (buffer_size - format::header_size) / format::code_size;
+        auto const count = std::min({
+            static_cast<std::size_t>(error_count()), fitting, std::size_t{UINT8_MAX}});
+
+        buffer[0] = std::byte{format::marker};
+        buffer[1] = static_cast<std::byte>(source);
+        buffer[2] = static_cast<std::byte>(count);
+        for (auto idx = std::size_t{}; idx < count; ++idx) {
+            auto const offset = format::header_size + idx * format::code_size;
+            detail::write_le(buffer + offset, errors[idx].value());
         }
-        auto offset = 0;
-        std::array<char, 16u * MaxErrors> message;
-        std::for_each(errors.begin(), const_iterator{top_error},
-            [&](auto const error_code) {
-                auto const chars = std::sprintf(
-                    message.data() + offset, "  %#08lX\n", error_code.value());
-                offset += (chars < 0) ? 0 : chars;
-            }
-        );
-        aether_log << message.data();
+        return format::header_size + count * format::code_size;
     }
 
     /**
      * @brief Clears the internal error-buffer.
      */
     constexpr auto clear_errors() -> void
-    { top_error = errors.begin(); }
+    { top_error = 0; }
 
     /**
      * @brief Checks if the internal error-buffer is not empty.
      */
     [[nodiscard]]
     constexpr auto contains_errors() const -> bool
-    { return top_error != errors.cbegin(); }
+    { return top_error != 0; }
 
     /**
      * @brief Checks if the internal error-buffer is full.
      */
     [[nodiscard]]
     constexpr auto is_error_limit_reached() const -> bool
-    { return top_error == errors.cend(); }
+    { return top_error == static_cast<std::size_t>(MaxErrors); }
 
     /**
      * @brief Gets the maximum number of errors the internal error-buffer can store.
@@ -217,11 +280,11 @@ public:
      */
     [[nodiscard]]
     constexpr auto error_count() const -> int
-    { return std::distance(errors.cbegin(), const_iterator{top_error}); }
+    { return static_cast<int>(top_error); }
 
 private:
-    container errors{};                 /**< Stores the error codes. */
-    iterator top_error{errors.begin()}; /**< Keeps track of the error codes. */
+    container errors{};      /**< Stores the error codes. */
+    std::size_t top_error{}; /**< Number of error codes that are stored. */
 };
 
 } // namespace cfg
@@ -19,6 +19,10 @@
 
 #include "error-types.h"
 
+#include <array>
+#include <cstddef>
+#include <string_view>
+
 /**
  * @namespace cfg
  * 
@@ -43,6 +47,28 @@ constexpr auto get_error_message(io_error error_id) {
     }
 }
 
+/**
+ * @brief Gets the length of the longest error message that is mapped to an I/O error.
+ * 
+ * @details The message of an unknown I/O error is taken into account as well, for which
+ * an identifier is used that does not belong to any of the known I/O errors.
+ * 
+ * @return Number of characters, excluding the terminating null-character.
+ */
+[[nodiscard]]
+constexpr auto max_io_error_message_length() -> std::size_t {
+    constexpr auto error_ids = std::array{
+        io_error::file_not_found, io_error::path_not_found, io_error::invalid_name,
+        io_error::file_too_large, static_cast<io_error>(-1)
+    };
+    auto length = std::size_t{};
+    for (auto const error_id : error_ids) {
+        auto const message_length = std::string_view{get_error_message(error_id)}.size();
+        if (message_length > length) length = message_length;
+    }
+    return length;
+}
+
 } // namespace cfg
 
 #endif
@@ -60,14 +60,25 @@ namespace type {
  * @brief Enumeration of the parsing error identifiers.
  */
 enum class parsing : std::uint32_t {
-    unspecified,              /**< Default parsing error. */
-    missing_opening_tag,      /**< Indicates an opening tag is missing. */
-    missing_closing_tag,      /**< Indicates a closing tag is missing. */
-    exceeds_max_value_length, /**< Indicates the value within a tag is too long. */
-    empty_config,             /**< Indicates the config file is empty. */
-    no_tags_found,            /**< Indicates the config file contains no tags. */
-    invalid_message_pointer,  /**< Indicates the config message pointer is invalid. */
-    insufficient_message_size /**< Indicates the config message buffer is too small. */
+    unspecified,               /**< Default parsing error. */
+    missing_opening_tag,       /**< Indicates an opening tag is missing. */
+    missing_closing_tag,       /**< Indicates a closing tag is missing. */
+    exceeds_max_value_length,  /**< Indicates the value within a tag is too long. */
+    empty_config,              /**< Indicates the config file is empty. */
+    no_tags_found,             /**< Indicates the config file contains no tags. */
+    invalid_message_pointer,   /**< Indicates the config message pointer is invalid. */
+    insufficient_message_size, /**< Indicates the config message buffer is too small. */
+    invalid_image_header,      /**< Indicates the config image header is invalid. */
+    unsupported_image_version, /**< Indicates the config image version is unsupported. */
+    image_checksum_mismatch,   /**< Indicates the config image checksum is incorrect. */
+    truncated_image_record,    /**< Indicates a config image record is incomplete. */
+    truncated_delta_record,    /**< Indicates a delta message record is incomplete. */
+    unknown_delta_setting,     /**< Indicates a delta message refers to no setting. */
+    unknown_embedded_setting,  /**< Indicates an embedded value refers to no setting. */
+    incomplete_message,        /**< Indicates a fragmented message is incomplete. */
+    truncated_packed_field,    /**< Indicates a packed message field is incomplete. */
+    packed_field_overflow,     /**< Indicates a packed message field is out of range. */
+    invalid_json_syntax        /**< Indicates the config file is not valid JSON. */
 };
 
 /**
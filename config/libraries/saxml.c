@@ -3,33 +3,15 @@
  * \brief Embedded XML Parser
  */
 #include <stddef.h> /* for NULL */
+#include <string.h> /* memcpy */
 #ifndef SAXML_NO_MALLOC
 #include <stdlib.h> /* malloc and free */
 #endif
 #include <libraries/saxml.h>
 
-#if defined(SAXML_NO_MALLOC) && !defined(SAXML_MAX_STRING_LENGTH)
-#error saxml: Must define SAXML_MAX_STRING_LENGTH
-#endif
-
 typedef void (*pfnParserStateHandler)(void *context, const char character);
 
-typedef struct
-{
-    tSaxmlContext *user;
-
-    pfnParserStateHandler pfnHandler;
-
-    int bInitialize; /* true for first call into a state */
-
-    char *buffer;
-    uint32_t maxStringSize;
-    uint32_t length;
-} tParserContext;
-#ifdef SAXML_NO_MALLOC
-static tParserContext g_saxmlParserContext;
-static char g_saxmlBuffer[SAXML_MAX_STRING_LENGTH];
-#endif
+typedef tSaxmlState tParserContext;
 
 static void state_Begin(void *context, const char character);
 static void state_StartTag(void *context, const char character);
@@ -38,6 +20,8 @@ static void state_TagContents(void *context, const char character);
 static void state_EndTag(void *context, const char character);
 static void state_EmptyTag(void *context, const char character);
 static void state_Attribute(void *context, const char character);
+static void state_AttributeValue(void *context, const char character);
+static const char *ScanRun(tParserContext *ctxt, const char *current, const char *end);
 
 #if !defined(DBG)
     #define DBG(...)
@@ -55,6 +39,52 @@ static void state_Attribute(void *context, const char character);
     }                                                \
     else { /* string truncated */ }
 
+#define ContextContentAddChar(ctxt, character)        \
+    if(NULL == (ctxt)->sink)                           \
+    {                                                  \
+        ContextBufferAddChar(ctxt, character);         \
+    }                                                  \
+    else if((ctxt)->length < (ctxt)->sinkSize)         \
+    {                                                  \
+        (ctxt)->sink[(ctxt)->length] = character;      \
+        ++((ctxt)->length);                            \
+    }                                                  \
+    else { (ctxt)->bSinkTruncated = 1; }
+
+#define ClearContentSink(ctxt)   \
+    (ctxt)->sink = NULL;         \
+    (ctxt)->sinkSize = 0;        \
+    (ctxt)->sinkHandler = NULL;  \
+    (ctxt)->bSinkTruncated = 0;
+
+#define IsWhitespace(character) \
+    ((character) == ' ' || (character) == '\r' || (character) == '\n' || (character) == '\t')
+
+/* Runs of characters are scanned a word at a time. A word of which each byte holds the same
+ * character is made by multiplying that character with a word of 0x01 bytes. Testing whether
+ * any byte of a word is zero, or less than a small character, is exact for the word as a
+ * whole, though not for which byte it is. */
+typedef size_t tScanWord;
+
+#define WordOf(character) ((((tScanWord) -1) / 0xFF) * (unsigned char) (character))
+
+#define WordHasLess(word, character) \
+    (((word) - WordOf(character)) & ~(word) & WordOf(0x80))
+
+#define WordHasByte(word, character) \
+    WordHasLess((word) ^ WordOf(character), 0x01)
+
+#define UpdatePosition(ctxt, character) \
+    if((character) == '\n')             \
+    {                                   \
+        ++((ctxt)->line);               \
+        (ctxt)->column = 1;             \
+    }                                   \
+    else if((character) != '\r')        \
+    {                                   \
+        ++((ctxt)->column);             \
+    }
+
 #define CallHandler(ctxt, handlerName)                                   \
     if(NULL != (ctxt)->user->handlerName && (ctxt)->length > 0)          \
     {                                                                    \
@@ -67,34 +97,49 @@ static void state_Attribute(void *context, const char character);
  * Exported Functions
  */
 
+#ifndef SAXML_NO_MALLOC
 tSaxmlParser saxml_Initialize(tSaxmlContext *context, const uint32_t maxStringSize)
 {
     tParserContext *ctxt;
+    char *buffer;
 
     if(maxStringSize < 2)
         return NULL;
     if(NULL == context)
         return NULL;
 
-    #ifdef SAXML_NO_MALLOC
-    ctxt = &g_saxmlParserContext;
-    ctxt->buffer = g_saxmlBuffer;
-    #else
-    ctxt = (tParserContext *) malloc(sizeof(*context));
+    ctxt = (tParserContext *) malloc(sizeof(*ctxt));
     if(NULL == ctxt)
         return NULL;
 
-    ctxt->buffer = (char *) malloc(maxStringSize);
-    if(NULL == ctxt->buffer)
+    buffer = (char *) malloc(maxStringSize);
+    if(NULL == buffer)
     {
         free(ctxt);
         return NULL;
     }
-    #endif
+
+    return saxml_InitializeWithStorage(ctxt, context, buffer, maxStringSize);
+}
+#endif
+
+tSaxmlParser saxml_InitializeWithStorage(tSaxmlState *state, tSaxmlContext *context,
+                                         char *buffer, const uint32_t maxStringSize)
+{
+    tParserContext *ctxt = state;
+
+    if(maxStringSize < 2)
+        return NULL;
+    if(NULL == ctxt || NULL == context || NULL == buffer)
+        return NULL;
 
     ctxt->user = context;
+    ctxt->buffer = buffer;
     ctxt->length = 0;
     ctxt->maxStringSize = maxStringSize;
+    ctxt->line = 1;
+    ctxt->column = 1;
+    ClearContentSink(ctxt);
     ChangeState(ctxt, state_Begin);
 
     return (tSaxmlParser) ctxt;
@@ -117,14 +162,262 @@ void saxml_HandleCharacter(tSaxmlParser parser, const char character)
 {
     tParserContext *ctxt = (tParserContext *) parser;
     ctxt->pfnHandler(ctxt, character);
+    UpdatePosition(ctxt, character);
+}
+
+void saxml_HandleBuffer(tSaxmlParser parser, const char *buffer, size_t length)
+{
+    tParserContext *ctxt = (tParserContext *) parser;
+    const char *current = buffer;
+    const char *end = buffer + length;
+
+    while(current != end)
+    {
+        /* The first character after a state change, and every delimiter, goes through the
+           state handler. Runs of characters that cannot change the state are consumed
+           here without calling into the state handler. */
+        if(!ctxt->bInitialize)
+        {
+            current = ScanRun(ctxt, current, end);
+            if(current == end)
+                break;
+        }
+        ctxt->pfnHandler(ctxt, *current);
+        UpdatePosition(ctxt, *current);
+        ++current;
+    }
+}
+
+void saxml_SetContentSink(tSaxmlParser parser, char *sink, uint32_t sinkSize,
+                          pfnContentSinkHandler handler)
+{
+    tParserContext *ctxt = (tParserContext *) parser;
+    ClearContentSink(ctxt);
+    if(NULL != sink && sinkSize > 0)
+    {
+        ctxt->sink = sink;
+        ctxt->sinkSize = sinkSize;
+        ctxt->sinkHandler = handler;
+    }
+}
+
+void saxml_GetPosition(tSaxmlParser parser, uint32_t *line, uint32_t *column)
+{
+    tParserContext *ctxt = (tParserContext *) parser;
+    if(NULL != line)
+        *line = ctxt->line;
+    if(NULL != column)
+        *column = ctxt->column;
 }
 
 void saxml_Reset(tSaxmlParser parser)
 {
     tParserContext *ctxt = (tParserContext *) parser;
+    ctxt->line = 1;
+    ctxt->column = 1;
+    ClearContentSink(ctxt);
     ChangeState(ctxt, state_Begin);
 }
 
+/* ---------------------------------------------------------------------------------------------
+ * Run Scanning
+ */
+
+/* Copy a run of characters into the string buffer, truncating like ContextBufferAddChar */
+static void BufferAddRun(tParserContext *ctxt, const char *run, size_t length)
+{
+    size_t room = 0;
+
+    if(ctxt->length < ctxt->maxStringSize - 2)
+        room = (ctxt->maxStringSize - 2) - ctxt->length;
+    if(length > room)
+        length = room; /* string truncated */
+
+    memcpy(ctxt->buffer + ctxt->length, run, length);
+    ctxt->length += (uint32_t) length;
+}
+
+/* Copy a run of tag contents into the content sink if set, or into the string buffer */
+static void ContentAddRun(tParserContext *ctxt, const char *run, size_t length)
+{
+    size_t room;
+
+    if(NULL == ctxt->sink)
+    {
+        BufferAddRun(ctxt, run, length);
+        return;
+    }
+
+    room = ctxt->sinkSize - ctxt->length;
+    if(length > room)
+    {
+        length = room;
+        ctxt->bSinkTruncated = 1;
+    }
+
+    memcpy(ctxt->sink + ctxt->length, run, length);
+    ctxt->length += (uint32_t) length;
+}
+
+/* Load a word of characters, which need not be aligned */
+static tScanWord LoadWord(const char *current)
+{
+    tScanWord word;
+    memcpy(&word, current, sizeof(word));
+    return word;
+}
+
+/* Get the end of the word of characters that starts at current, or the end of the buffer
+ * if it contains no complete word */
+static const char *WordEnd(const char *current, const char *end)
+{
+    return ((size_t) (end - current) > sizeof(tScanWord)) ? current + sizeof(tScanWord) : end;
+}
+
+/* Skip whole words of characters that can neither start a tag nor break a line, and thus only
+ * advance the column */
+static const char *SkipPlainWords(tParserContext *ctxt, const char *current, const char *end)
+{
+    while((size_t) (end - current) >= sizeof(tScanWord))
+    {
+        const tScanWord word = LoadWord(current);
+        if(WordHasByte(word, '<') || WordHasByte(word, '\n') || WordHasByte(word, '\r'))
+            break;
+        ctxt->column += (uint32_t) sizeof(tScanWord);
+        current += sizeof(tScanWord);
+    }
+    return current;
+}
+
+/* Skip whole words of indentation, which consist of either spaces or tabs */
+static const char *SkipIndentWords(tParserContext *ctxt, const char *current, const char *end)
+{
+    while((size_t) (end - current) >= sizeof(tScanWord))
+    {
+        const tScanWord word = LoadWord(current);
+        if(word != WordOf(' ') && word != WordOf('\t'))
+            break;
+        ctxt->column += (uint32_t) sizeof(tScanWord);
+        current += sizeof(tScanWord);
+    }
+    return current;
+}
+
+/* Skip whole words of characters that cannot end a tag name. Any control character stops the
+ * skip as well, which leaves the exact check to the caller. */
+static const char *SkipNameWords(const char *current, const char *end)
+{
+    while((size_t) (end - current) >= sizeof(tScanWord))
+    {
+        const tScanWord word = LoadWord(current);
+        if(WordHasLess(word, '!') || WordHasByte(word, '<') || WordHasByte(word, '/') ||
+           WordHasByte(word, '>'))
+            break;
+        current += sizeof(tScanWord);
+    }
+    return current;
+}
+
+/* Advance to the next '<'. Words without a '<' or a line break are skipped at once, and the
+ * word that stopped the skip is handled a character at a time. */
+static const char *ScanToTag(tParserContext *ctxt, const char *current, const char *end)
+{
+    const char *wordEnd;
+
+    for(;;)
+    {
+        current = SkipPlainWords(ctxt, current, end);
+        wordEnd = WordEnd(current, end);
+        while(current != wordEnd && *current != '<')
+        {
+            UpdatePosition(ctxt, *current);
+            ++current;
+        }
+        if(current != wordEnd || current == end)
+            return current;
+    }
+}
+
+/* Advance to the next character that is not whitespace, a word at a time where possible */
+static const char *ScanWhitespace(tParserContext *ctxt, const char *current, const char *end)
+{
+    const char *wordEnd;
+
+    for(;;)
+    {
+        current = SkipIndentWords(ctxt, current, end);
+        wordEnd = WordEnd(current, end);
+        while(current != wordEnd && IsWhitespace(*current))
+        {
+            UpdatePosition(ctxt, *current);
+            ++current;
+        }
+        if(current != wordEnd || current == end)
+            return current;
+    }
+}
+
+/* Advance to anything that may end a tag name, a word at a time where possible */
+static const char *ScanTagName(const char *current, const char *end)
+{
+    const char *wordEnd;
+
+    for(;;)
+    {
+        current = SkipNameWords(current, end);
+        wordEnd = WordEnd(current, end);
+        while(current != wordEnd && *current != '<' && *current != '/' && *current != '>' &&
+              !IsWhitespace(*current))
+        {
+            ++current;
+        }
+        if(current != wordEnd || current == end)
+            return current;
+    }
+}
+
+/* Consume the characters that the current state would handle without changing state,
+ * and return a pointer to the first character that needs the state handler. */
+static const char *ScanRun(tParserContext *ctxt, const char *current, const char *end)
+{
+    const char *run = current;
+
+    if(ctxt->pfnHandler == state_Begin)
+    {
+        current = ScanToTag(ctxt, current, end);
+    }
+    else if(ctxt->pfnHandler == state_TagName || ctxt->pfnHandler == state_EndTag)
+    {
+        /* Stop at anything that may end the tag name, which also means the run contains
+           no line breaks. Characters that turn out not to be delimiters in the current
+           state are simply added by the state handler instead. */
+        current = ScanTagName(current, end);
+        BufferAddRun(ctxt, run, (size_t) (current - run));
+        ctxt->column += (uint32_t) (current - run);
+    }
+    else if(ctxt->pfnHandler == state_TagContents)
+    {
+        if(0 == ctxt->length)
+        {
+            /* Ignore leading whitespace */
+            current = ScanWhitespace(ctxt, current, end);
+            run = current;
+        }
+        current = ScanToTag(ctxt, current, end);
+        ContentAddRun(ctxt, run, (size_t) (current - run));
+    }
+    else if(ctxt->pfnHandler == state_AttributeValue && 0 != ctxt->quote)
+    {
+        while(current != end && *current != ctxt->quote)
+        {
+            UpdatePosition(ctxt, *current);
+            ++current;
+        }
+        ContentAddRun(ctxt, run, (size_t) (current - run));
+    }
+    return current;
+}
+
 /* ---------------------------------------------------------------------------------------------
  * State Handlers
  */
@@ -285,17 +578,32 @@ static void state_TagContents(void *context, const char character)
             else {}
             // fall through
         default:
-            ContextBufferAddChar(ctxt, character);
+            ContextContentAddChar(ctxt, character);
             break;
     }
 
     if(NULL != nextState)
     {
-        CallHandler(ctxt, contentHandler);
+        if(NULL == ctxt->sink)
+        {
+            CallHandler(ctxt, contentHandler);
+        }
+        else
+        {
+            if(NULL != ctxt->sinkHandler && ctxt->length > 0)
+                ctxt->sinkHandler(ctxt->user->cookie, ctxt->length, ctxt->bSinkTruncated);
+            ClearContentSink(ctxt);
+        }
         ChangeState(ctxt, nextState);
     }
 }
 
+/* Report the name of an attribute that has no value. It cannot receive a value, so any sink
+ * that the handler sets is cleared again. */
+#define CallBareAttributeHandler(ctxt)       \
+    CallHandler(ctxt, attributeHandler);     \
+    ClearContentSink(ctxt);
+
 static void state_Attribute(void *context, const char character)
 {
     tParserContext *ctxt = (tParserContext *) context;
@@ -315,8 +623,16 @@ static void state_Attribute(void *context, const char character)
         case ' ': case '\r': case '\n': case '\t':
             if(0 == ctxt->length)
                 break;
-            else
-                nextState = state_Attribute;
+            CallBareAttributeHandler(ctxt);
+            nextState = state_Attribute;
+            break;
+        case '=':
+            if(0 == ctxt->length)
+                break; /* Syntax error! */
+            /* The name is complete; the value follows in its own state, so that its
+               handler may direct the value into a sink */
+            CallHandler(ctxt, attributeHandler);
+            nextState = state_AttributeValue;
             break;
         case '/':
             /* We've found an empty tag that contains at least one attribute.
@@ -325,10 +641,19 @@ static void state_Attribute(void *context, const char character)
                back. In order to generate a "tagEnd" event, store a dummy string
                containing a single space character (which isn't a valid tag name),
                which will be provided to the tagEndHandler callback. */
+            if(0 != ctxt->length)
+            {
+                CallBareAttributeHandler(ctxt);
+                ctxt->length = 0;
+            }
             ContextBufferAddChar(ctxt, ' ');
             nextState = state_EmptyTag;
             break;
         case '>':
+            if(0 != ctxt->length)
+            {
+                CallBareAttributeHandler(ctxt);
+            }
             nextState = state_TagContents; /* Done with tag, contents may follow */
             break;
         default:
@@ -338,10 +663,72 @@ static void state_Attribute(void *context, const char character)
 
     if(NULL != nextState)
     {
-        if(nextState != state_EmptyTag)
+        ChangeState(ctxt, nextState);
+    }
+}
+
+/* The name of an attribute and its '=' have been parsed; parse its quoted value */
+static void state_AttributeValue(void *context, const char character)
+{
+    tParserContext *ctxt = (tParserContext *) context;
+    pfnParserStateHandler nextState = NULL;
+
+    DBG("%s: %c\n", __func__, character);
+
+    if(ctxt->bInitialize)
+    {
+        DBG("%s: Initialize\n", __func__);
+        ctxt->length = 0;
+        ctxt->quote = 0;
+        ctxt->bInitialize = 0;
+    }
+
+    if(0 != ctxt->quote)
+    {
+        if(character != ctxt->quote)
         {
-            CallHandler(ctxt, attributeHandler);
+            ContextContentAddChar(ctxt, character);
+            return;
+        }
+        if(NULL == ctxt->sink)
+        {
+            CallHandler(ctxt, parameterHandler);
+        }
+        else if(NULL != ctxt->sinkHandler && ctxt->length > 0)
+        {
+            ctxt->sinkHandler(ctxt->user->cookie, ctxt->length, ctxt->bSinkTruncated);
         }
+        ClearContentSink(ctxt);
+        ChangeState(ctxt, state_Attribute);
+        return;
+    }
+
+    switch(character)
+    {
+        case '"': case '\'':
+            ctxt->quote = character;
+            break;
+        case ' ': case '\r': case '\n': case '\t':
+            /* Ignore whitespace */
+            break;
+        case '/':
+            /* Syntax error! The value is missing; end the tag like an attribute would */
+            ctxt->length = 0;
+            ContextBufferAddChar(ctxt, ' ');
+            nextState = state_EmptyTag;
+            break;
+        case '>':
+            /* Syntax error! The value is missing */
+            nextState = state_TagContents;
+            break;
+        default:
+            /* Syntax error! The value is not quoted */
+            break;
+    }
+
+    if(NULL != nextState)
+    {
+        ClearContentSink(ctxt);
         ChangeState(ctxt, nextState);
     }
 }
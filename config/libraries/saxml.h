@@ -5,26 +5,56 @@
 #ifndef SAXML_H
 #define SAXML_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 typedef void (*pfnStringHandler)(void *cookie, const char *szString);
 
+typedef void (*pfnContentSinkHandler)(void *cookie, uint32_t length, int bTruncated);
+
 typedef struct
 {
     void *cookie;
     pfnStringHandler tagHandler;
     pfnStringHandler tagEndHandler;
-    pfnStringHandler parameterHandler;
+    pfnStringHandler parameterHandler; /* receives the value of an attribute */
     pfnStringHandler contentHandler;
-    pfnStringHandler attributeHandler;
+    pfnStringHandler attributeHandler; /* receives the name of an attribute */
 } tSaxmlContext;
 
 typedef void *tSaxmlParser;
 
+/*! \brief Parser state, for callers that provide the storage of a parser themselves. Its
+ *         members are private to the parser and should not be accessed directly.
+ */
+typedef struct
+{
+    tSaxmlContext *user;
+
+    void (*pfnHandler)(void *context, const char character);
+
+    int bInitialize; /* true for first call into a state */
+
+    char *buffer;
+    uint32_t maxStringSize;
+    uint32_t length;
+
+    uint32_t line;   /* line number of the next character, starting at 1 */
+    uint32_t column; /* column number of the next character, starting at 1 */
+
+    char *sink; /* receives the contents of the current tag instead of buffer, if set */
+    uint32_t sinkSize;
+    pfnContentSinkHandler sinkHandler;
+    int bSinkTruncated;
+
+    char quote; /* quote character that encloses the current attribute value, if any */
+} tSaxmlState;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#ifndef SAXML_NO_MALLOC
 /*! \brief Create an XML parsing instance
  *  \param context Pointer to structure containing pointers to parsing handling
  *                 functions, which are called when parsing events occur.
@@ -35,6 +65,22 @@ extern "C" {
  *  \return parser instance
  */
 tSaxmlParser saxml_Initialize(tSaxmlContext *context, const uint32_t maxStringSize);
+#endif
+
+/*! \brief Create an XML parsing instance in storage provided by the caller. No memory is
+ *         allocated, and instances are independent of each other, so multiple documents
+ *         can be parsed at the same time. The storage must outlive the parsing instance,
+ *         and the instance must not be passed to saxml_Deinitialize.
+ *  \param state Storage for the parser state
+ *  \param context Pointer to structure containing pointers to parsing handling
+ *                 functions, which are called when parsing events occur.
+ *  \param buffer Storage for parsed strings, of at least maxStringSize characters
+ *  \param maxStringSize Maximum number of characters for parsed strings, including
+ *                       the terminating null character. Longer strings are truncated.
+ *  \return parser instance, or NULL if any argument is invalid
+ */
+tSaxmlParser saxml_InitializeWithStorage(tSaxmlState *state, tSaxmlContext *context,
+                                         char *buffer, const uint32_t maxStringSize);
 
 /*! \brief Destroy an XML parsing instance
  *  \param parser tSaxmlParser instance, obtained from a call to saxml_Initialize
@@ -48,7 +94,44 @@ void saxml_Deinitialize(tSaxmlParser parser);
  */
 void saxml_HandleCharacter(tSaxmlParser parser, const char character);
 
-/*! \brief Reset the parser to its initial state
+/*! \brief Provide a buffer of characters to the XML parser. Equivalent to calling
+ *         saxml_HandleCharacter for each character in the buffer, but runs of characters
+ *         that do not change the parser's state (tag names, contents and whitespace) are
+ *         consumed at once, without going through the state handlers.
+ *  \param parser tSaxmlParser instance, obtained from a call to saxml_Initialize
+ *  \param buffer Characters to process; need not be zero-terminated
+ *  \param length Number of characters in the buffer
+ */
+void saxml_HandleBuffer(tSaxmlParser parser, const char *buffer, size_t length);
+
+/*! \brief Write the contents of the tag that is currently being parsed directly into a
+ *         buffer provided by the caller, instead of into the parser's string buffer. This
+ *         is intended to be called from within the tagHandler of the tag, or from within
+ *         the attributeHandler of an attribute to receive its value instead of the
+ *         parameterHandler. Only the contents up to the next tag (or end tag), or the
+ *         value up to its closing quote, are written; the sink is cleared afterwards.
+ *         The contents are not zero-terminated. Instead of the contentHandler (or the
+ *         parameterHandler), the sink handler is then called with the number of
+ *         characters written, if any, and whether the contents had to be truncated to
+ *         fit the sink.
+ *  \param parser tSaxmlParser instance, obtained from a call to saxml_Initialize
+ *  \param sink Buffer that receives the contents, or NULL to clear the sink
+ *  \param sinkSize Capacity of the sink, in characters
+ *  \param handler Called once the contents are complete
+ */
+void saxml_SetContentSink(tSaxmlParser parser, char *sink, uint32_t sinkSize,
+                          pfnContentSinkHandler handler);
+
+/*! \brief Get the position of the next character to be processed. When called from within
+ *         a pfnStringHandler function, this is the position of the character that caused
+ *         the handler to be called. Carriage returns are not counted as columns.
+ *  \param parser tSaxmlParser instance, obtained from a call to saxml_Initialize
+ *  \param line Receives the line number, starting at 1; may be NULL
+ *  \param column Receives the column number, starting at 1; may be NULL
+ */
+void saxml_GetPosition(tSaxmlParser parser, uint32_t *line, uint32_t *column);
+
+/*! \brief Reset the parser to its initial state, including its position
  *  \param parser tSaxmlParser instance, obtained from a call to saxml_Initialize
  */
 void saxml_Reset(tSaxmlParser parser);
@@ -17,14 +17,22 @@
 #ifndef CFG_CONFIG_LOGGING_LOGGER_H
 #define CFG_CONFIG_LOGGING_LOGGER_H
 
+#include <strings/string-formatting.h>
+#include <utilities/container.h>
+
 #include <ffconf.h>
 // warning: implicitly includes 'all.h'
 #include <logger.hpp>
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <iterator>
 #include <string_view>
+#include <type_traits>
 
 /**
  * @namespace cfg
@@ -68,6 +76,182 @@ inline auto make_logger(std::string_view name, std::string_view suffix) -> ::log
     return {filename.data(), static_cast<std::size_t>(filename_size)};
 }
 
+/**
+ * @class log_buffer
+ * 
+ * @brief Ring-buffer of log records that are only formatted and written when the buffer
+ * is flushed.
+ * 
+ * @details Records are stored in a binary form, as either a pointer to a text or an error
+ * code, so logging a record involves neither formatting nor a write to the SD-card. All
+ * of the buffered records are formatted and written at once when the buffer is flushed,
+ * such as at the end of processing a configuration file.
+ * 
+ * The texts are not copied. As such, a logged text must have a static storage duration,
+ * which is the case for string literals. If the buffer is full, the oldest record is
+ * overwritten. The number of overwritten records is reported the next time the buffer is
+ * flushed.
+ * 
+ * @tparam Capacity Maximum number of records the buffer can store.
+ */
+template<std::size_t Capacity,
+    typename = std::enable_if_t<(Capacity > 0 and Capacity <= UINT16_MAX)>>
+class log_buffer {
+public:
+    /**
+     * @brief Logs a text.
+     * 
+     * @param[in] text Zero-terminated text with a static storage duration.
+     */
+    constexpr auto log_text(char const* text) -> void
+    { push({text, 0}); }
+
+    /**
+     * @brief Logs an error code, which is formatted in a hexadecimal notation.
+     * 
+     * @param[in] error_code Value of the error code.
+     */
+    constexpr auto log_error_code(std::uint32_t error_code) -> void
+    { push({nullptr, error_code}); }
+
+    /**
+     * @brief Formats and writes all of the buffered records, after which the buffer is
+     * cleared.
+     * 
+     * @details The formatted records are gathered in a small chunk, so that the writer
+     * is invoked with as few and as large pieces of text as possible. A text that does
+     * not fit in a chunk is written on its own.
+     * 
+     * @tparam Writer Type of a callable that accepts a zero-terminated string.
+     * 
+     * @param[in] write Callable that writes a piece of formatted text.
+     */
+    template<typename Writer,
+        typename = std::enable_if_t<std::is_invocable_v<Writer&, char const*>>>
+    auto flush(Writer&& write) -> void {
+        auto chunk = std::array<char, 128>{};
+        auto chunk_size = std::size_t{};
+        auto const write_chunk = [&] {
+            if (chunk_size == 0) return;
+            chunk[chunk_size] = '\0';
+            write(static_cast<char const*>(chunk.data()));
+            chunk_size = 0;
+        };
+        auto const append = [&](char const* text, std::size_t size) {
+            if (chunk_size + size >= chunk.size()) write_chunk();
+            if (size >= chunk.size()) {
+                write(text);
+                return;
+            }
+            std::memcpy(chunk.data() + chunk_size, text, size);
+            chunk_size += size;
+        };
+
+        static constexpr char dropped_format[]
+            = "[WARNING]%u log records were dropped.\n";
+        static constexpr char error_format[] = "  %#08lX\n";
+        auto piece = std::array<char, std::max(max_formatted_size(dropped_format, 0),
+            max_formatted_size(error_format, 0))>{};
+        if (dropped > 0) {
+            auto const chars = std::snprintf(piece.data(), piece.size(),
+                dropped_format, unsigned{dropped});
+            append(piece.data(), static_cast<std::size_t>(chars < 0 ? 0 : chars));
+        }
+        for (auto idx = std::size_t{}; idx < count; ++idx) {
+            auto const& entry = records[(first + idx) % Capacity];
+            if (entry.text) {
+                append(entry.text, std::strlen(entry.text));
+                continue;
+            }
+            auto const chars = std::snprintf(piece.data(), piece.size(),
+                error_format, static_cast<unsigned long>(entry.error_code));
+            append(piece.data(), static_cast<std::size_t>(chars < 0 ? 0 : chars));
+        }
+        write_chunk();
+        clear();
+    }
+
+    /**
+     * @brief Discards all of the buffered records.
+     */
+    constexpr auto clear() -> void {
+        first = 0;
+        count = 0;
+        dropped = 0;
+    }
+
+    /**
+     * @brief Gets the number of buffered records.
+     */
+    [[nodiscard]]
+    constexpr auto size() const -> std::size_t
+    { return count; }
+
+    /**
+     * @brief Checks if there are no buffered records.
+     */
+    [[nodiscard]]
+    constexpr auto empty() const -> bool
+    { return count == 0; }
+
+private:
+    /**
+     * @struct record
+     * 
+     * @brief Binary form of a log record.
+     */
+    struct record {
+        char const* text;         /**< Logged text, or a null pointer for error codes. */
+        std::uint32_t error_code; /**< Logged error code, if there is no text. */
+    };
+
+    /**
+     * @brief Adds a record to the buffer, overwriting the oldest record if it is full.
+     * 
+     * @param[in] entry Record to add.
+     */
+    constexpr auto push(record entry) -> void {
+        if (count < Capacity) {
+            records[(first + count++) % Capacity] = entry;
+            return;
+        }
+        records[first] = entry;
+        first = static_cast<std::uint16_t>((first + 1) % Capacity);
+        if (dropped < UINT16_MAX) ++dropped;
+    }
+
+    array<record, Capacity> records{}; /**< Ring-buffer of log records. */
+    std::uint16_t first{};             /**< Index of the oldest record. */
+    std::uint16_t count{};             /**< Number of buffered records. */
+    std::uint16_t dropped{};           /**< Number of overwritten records. */
+};
+
+/**
+ * @var default_log_capacity
+ * 
+ * @brief Number of records that the default log-buffer can store.
+ */
+inline constexpr auto default_log_capacity = std::size_t{96};
+
+/**
+ * @brief Gets the default log-buffer, which is used while processing configuration
+ * files or messages.
+ * 
+ * @return Reference to the default log-buffer.
+ */
+[[nodiscard]]
+inline auto get_default_log() -> log_buffer<default_log_capacity>& {
+    static auto buffer = log_buffer<default_log_capacity>{};
+    return buffer;
+}
+
+/**
+ * @brief Formats and writes all of the records of the default log-buffer to the
+ * aether_log.
+ */
+inline auto flush_default_log() -> void
+{ get_default_log().flush([](char const* text) { aether_log << text; }); }
+
 /**
  * @struct logger
  * 
@@ -17,6 +17,8 @@
 #ifndef CFG_CONFIG_PARSING_CONFIG_PARSER_H
 #define CFG_CONFIG_PARSING_CONFIG_PARSER_H
 
+#include <cstddef>
+
 /**
  * @namespace cfg
  * 
@@ -59,6 +61,18 @@ public:
     auto report_parsing_errors() const -> void
     { dispatch().report_parsing_errors_impl(); }
 
+    /**
+     * @brief Exports the parsing errors as a binary error record.
+     * 
+     * @param[out] buffer Buffer to write the error record to.
+     * @param[in] buffer_size Capacity of the buffer, in number of bytes.
+     * 
+     * @return Number of bytes written.
+     */
+    constexpr auto export_parsing_errors(
+        std::byte* buffer, std::size_t buffer_size) const -> std::size_t
+    { return dispatch().export_parsing_errors_impl(buffer, buffer_size); }
+
 protected:
     /**
      * @brief Special member functions.
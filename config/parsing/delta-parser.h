@@ -0,0 +1,328 @@
+/**
+ * @file delta-parser.h
+ * @brief Parsing-mechanism for processing delta config messages.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+*/
+#ifndef CFG_CONFIG_PARSING_DELTA_PARSER_H
+#define CFG_CONFIG_PARSING_DELTA_PARSER_H
+
+#include "config-parser.h"
+#include "message-parser.h"
+
+#include <checking/validation-mode.h>
+#include <errors/error-handler.h>
+#include <errors/error-types.h>
+#include <traits/class-traits.h>
+#include <traits/iterator-traits.h>
+#include <utilities/bitwise.h>
+#include <utilities/enum.h>
+#include <utilities/range.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * @namespace cfg
+ * 
+ * @brief Contains everything related to the processing of configuration files.
+ */
+namespace cfg {
+
+/**
+ * @class delta_parser
+ * 
+ * @brief Parses delta config messages, which only contain the values of the settings
+ * that change.
+ * 
+ * @details A delta message starts with a byte that holds the number of records. The
+ * records follow as a single stream of bits, starting at the most significant bit of
+ * the second byte. Each record consists of an 8-bit setting-identifier, followed by as
+ * many bits as the size of that setting's bitspan. Any bits after the last record are
+ * ignored.
+ * 
+ * As an example, changing a single 32-bit interval only takes a delta message of six
+ * bytes, whereas a full config message is required to be at least 64 bytes.
+ * 
+ * The settings that are not part of a delta message are left unset, so that applying
+ * the parsed settings to a main configuration object only changes the fields that the
+ * delta message refers to.
+ * 
+ * @tparam SettingIter Iterator type of the settings container.
+ * @tparam MaxSettings Maximum number of settings to operate on.
+ */
+template<typename SettingIter, int MaxSettings,
+    typename = std::enable_if_t<is_random_access_iter_v<SettingIter>>,
+    typename = std::enable_if_t<(MaxSettings > 0)>>
+class delta_parser : public config_parser<delta_parser<SettingIter, MaxSettings>> {
+    /**
+     * @typedef base_type
+     * 
+     * @brief Shorter notation to refer to the type of the base class.
+     */
+    using base_type = config_parser<delta_parser<SettingIter, MaxSettings>>;
+
+    /**
+     * @{
+     * @brief Grants the public interface access to its implementation.
+     */
+    template<typename Config>
+    friend constexpr auto base_type::parse_config(Config const&) -> void;
+    friend auto base_type::report_parsing_errors() const -> void;
+    friend constexpr auto base_type::has_parsing_errors() const -> bool;
+    friend constexpr auto base_type::export_parsing_errors(
+        std::byte*, std::size_t) const -> std::size_t;
+    /** @} */
+
+public:
+    /**
+     * @var max_settings
+     * 
+     * @brief Maximum number of settings that a delta parser can operate on.
+     */
+    static constexpr auto max_settings = int{MaxSettings};
+
+    /**
+     * @var validation
+     * 
+     * @brief Indicates how the values that a delta parser sets should be validated.
+     */
+    static constexpr auto validation = validation_mode::config_delta;
+
+    /**
+     * @brief Default constructs a delta parser.
+     */
+    constexpr delta_parser() = default;
+
+    /**
+     * @brief Constructs a delta parser with a range of settings to operate on.
+     * 
+     * @tparam Settings Container type that stores its contents in a contiguous sequence.
+     * 
+     * @param[in,out] settings Container with settings which will have their values set
+     * based on the contents of the parsed delta message.
+     */
+    template<typename Settings,
+        typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
+    constexpr explicit delta_parser(Settings& settings)
+        : settings_{settings} {}
+
+    /**
+     * @brief Clears all of the parsing errors.
+     */
+    constexpr auto clear_parsing_errors() -> void
+    { err_handler.clear_errors(); }
+
+    /**
+     * @brief Sets the new range of settings to operate on.
+     * 
+     * @details If the distance of the new range of settings exceeds the MaxSettings
+     * value, the new range is ignored and no changes are made.
+     * 
+     * @param[in] settings New range of settings to operate on. This can also be a
+     * reference to a container type, due to the extensive constructors of the range
+     * class.
+     */
+    constexpr auto set_settings(range<SettingIter> settings) -> void {
+        auto const distance = settings.distance();
+        if (distance <= 0 or distance > MaxSettings) return;
+        settings_ = settings;
+    }
+
+private:
+    /**
+     * @brief Parses a delta message.
+     * 
+     * @details The values of all the settings are cleared first. Then, the value of each
+     * record is extracted and written to the value-buffer of the setting it refers to.
+     * If a setting occurs more than once, only its first record is used. Since the size
+     * of a record depends on the setting it refers to, parsing stops at the first record
+     * that does not refer to a setting with a bitspan.
+     * 
+     * @param[in] delta Delta message to parse.
+     */
+    constexpr auto parse_config_impl(message_data delta) -> void {
+        err_handler.clear_errors();
+        for (auto&& setting_obj : settings_) {
+            setting_obj.set_value(std::string_view{});
+        }
+
+        validate_delta_message(delta);
+        if (err_handler.contains_errors()) return;
+
+        auto const id_size = 8u;
+        auto const record_count = std::to_integer<unsigned>(delta.data()[0]);
+        auto const message_bits = unsigned{delta.size()} * 8u;
+        auto pos = 8u;
+
+        for (auto record = 0u; record < record_count; ++record) {
+            if (message_bits - pos < id_size) {
+                err_handler.add_error(parsing_error::truncated_delta_record, record);
+                return;
+            }
+            auto const id = static_cast<int>(extract_bits(delta.data(), pos, id_size));
+            pos += id_size;
+
+            auto const setting_it = find_setting(id);
+            if (setting_it == settings_.end()) {
+                err_handler.add_error(parsing_error::unknown_delta_setting, id);
+                return;
+            }
+            auto const bits = setting_it->config_bits();
+            if (message_bits - pos < bits.size()) {
+                err_handler.add_error(parsing_error::truncated_delta_record, record);
+                return;
+            }
+            if (not setting_it->is_set()) {
+                setting_it->set_value(
+                    extract_bits(delta.data(), pos, bits.size()), (bits.size() + 7u) / 8u);
+            }
+            pos += bits.size();
+        }
+    }
+
+    /**
+     * @brief Validates a delta message.
+     * 
+     * @details Checks if the data pointer of the delta message is valid and if it at
+     * least contains the number of records.
+     * 
+     * @param[in] delta Delta message to validate.
+     */
+    constexpr auto validate_delta_message(message_data delta) -> void {
+        if (delta.data() == nullptr) {
+            err_handler.add_error(parsing_error::invalid_message_pointer);
+        } else if (delta.size() < 1) {
+            err_handler.add_error(parsing_error::insufficient_message_size, delta.size());
+        }
+    }
+
+    /**
+     * @brief Finds the setting with a given identifier that has a bitspan.
+     * 
+     * @param[in] id Underlying value of the setting-identifier.
+     * 
+     * @return Iterator to the found setting, or the end of the range of settings.
+     */
+    constexpr auto find_setting(int id) const -> SettingIter {
+        for (auto it = settings_.begin(); it != settings_.end(); ++it) {
+            if (to_underlying(it->id()) == id and it->config_bits().size() != 0) {
+                return it;
+            }
+        }
+        return settings_.end();
+    }
+
+    /**
+     * @brief Checks if any error has occurred during the parsing of a delta message.
+     */
+    [[nodiscard]]
+    constexpr auto has_parsing_errors_impl() const -> bool
+    { return err_handler.contains_errors(); }
+
+    /**
+     * @brief Reports any error that might have occurred during the parsing of a delta
+     * message.
+     * 
+     * @details If there are no parsing errors to report, the logging request is simply
+     * ignored.
+     */
+    auto report_parsing_errors_impl() const -> void {
+        err_handler.log_errors(
+            "[ERROR]Some errors occurred while parsing the delta message:\n");
+    }
+
+    /**
+     * @brief Exports the errors that occurred during the parsing of a delta message
+     * as a binary error record.
+     * 
+     * @param[out] buffer Buffer to write the error record to.
+     * @param[in] buffer_size Capacity of the buffer, in number of bytes.
+     * 
+     * @return Number of bytes written.
+     */
+    constexpr auto export_parsing_errors_impl(
+        std::byte* buffer, std::size_t buffer_size) const -> std::size_t
+    { return err_handler.export_errors(error_source::parsing, buffer, buffer_size); }
+
+    error_handler<2> err_handler; /**< Handles potential parsing-errors. */
+    range<SettingIter> settings_; /**< Range of settings to operate on. */
+};
+
+/**
+ * @remark Allows a delta parser to be constructed from a container type.
+ * 
+ * @tparam Settings Container type that stores its contents in a contiguous sequence.
+ */
+template<typename Settings,
+    typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
+delta_parser(Settings&)
+    -> delta_parser<iterator_type<Settings>, std::tuple_size<Settings>{}>;
+
+/**
+ * @brief Writes the values of a range of settings to a delta message.
+ * 
+ * @details Only the settings with a bitspan that are set are written, as one record
+ * each and in order. Their values are expected in the binary form in which a @ref
+ * message_parser sets them. The bits after the last record are zero.
+ * 
+ * @tparam Settings Container type that stores its contents in a contiguous sequence.
+ * 
+ * @param[in] settings Container with the settings to write.
+ * @param[out] buffer Pointer to the first byte of the buffer to write the message to.
+ * @param[in] buffer_size Capacity of the buffer.
+ * 
+ * @return Size of the written delta message. If the buffer is too small, if there are
+ * more records than fit in the record count, or if a value does not fit within the
+ * bitspan of its setting, a value of zero is returned.
+ */
+template<typename Settings,
+    typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
+constexpr auto write_delta_message(
+    Settings const& settings,
+    std::byte* buffer,
+    std::size_t buffer_size
+) -> std::size_t {
+    if (buffer == nullptr or buffer_size < 1) return 0;
+
+    auto const id_size = 8u;
+    auto const buffer_bits = buffer_size * 8u;
+    auto record_count = 0u;
+    auto pos = 8u;
+
+    for (auto const& setting_obj : settings) {
+        auto const size = unsigned{setting_obj.config_bits().size()};
+        if (size == 0 or not setting_obj.is_set()) continue;
+
+        auto const id = to_underlying(setting_obj.id());
+        auto const value = convert_bits<std::uint64_t>(setting_obj.view_value());
+        if (id < 0 or id > 0xFF or record_count == 0xFF) return 0;
+        if (size < 64u and (value >> size) != 0) return 0;
+        if (buffer_bits - pos < id_size + size) return 0;
+
+        insert_bits(buffer, pos, id_size, static_cast<std::uint_fast64_t>(id));
+        insert_bits(buffer, pos + id_size, size, value);
+        pos += id_size + size;
+        ++record_count;
+    }
+
+    buffer[0] = static_cast<std::byte>(record_count);
+    if (pos % 8u != 0) insert_bits(buffer, pos, 8u - pos % 8u, 0u);
+    return (pos + 7u) / 8u;
+}
+
+} // namespace cfg
+
+#endif
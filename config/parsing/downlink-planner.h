@@ -0,0 +1,208 @@
+/**
+ * @file downlink-planner.h
+ * @brief Host-side planning of the smallest downlink that changes a device's config.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_CONFIG_PARSING_DOWNLINK_PLANNER_H
+#define CFG_CONFIG_PARSING_DOWNLINK_PLANNER_H
+
+#include "delta-parser.h"
+#include "message-data.h"
+#include "message-fragments.h"
+#include "message-parser.h"
+#include "packed-parser.h"
+
+#include <traits/class-traits.h>
+#include <utilities/bitwise.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * @namespace cfg
+ * 
+ * @brief Contains everything related to the processing of configuration files.
+ */
+namespace cfg {
+
+/**
+ * @enum downlink_encoding
+ * 
+ * @brief Enumeration of the formats that a downlink can change a config with.
+ */
+enum class downlink_encoding : std::uint8_t {
+    none,      /**< Indicates the config does not change, so no downlink is needed. */
+    delta,     /**< Indicates a delta message, see @ref delta_parser. */
+    packed,    /**< Indicates a packed message, see @ref packed_parser. */
+    full,      /**< Indicates a config message, see @ref message_parser. */
+    fragmented /**< Indicates a config message split into @ref message_fragments. */
+};
+
+/**
+ * @var lorawan_frame_overhead
+ * 
+ * @brief Number of bytes that a LoRaWAN downlink adds to its payload, which consists of
+ * the MAC header, the frame header, the port and the message integrity code.
+ */
+inline constexpr auto lorawan_frame_overhead = std::size_t{13};
+
+/**
+ * @struct downlink_plan
+ * 
+ * @brief Describes the downlink that is planned to change a config.
+ */
+struct downlink_plan {
+    downlink_encoding encoding; /**< Format of the payload. */
+    std::size_t size;           /**< Size of all the frames together, in bytes. */
+    std::size_t frame_size;     /**< Size of each frame, except maybe the last one. */
+    std::size_t frame_count;    /**< Number of frames to send. */
+
+    /**
+     * @brief Gets the number of bytes that are sent over the air for the downlink,
+     * including the overhead of each LoRaWAN frame.
+     */
+    [[nodiscard]]
+    constexpr auto airtime_bytes() const -> std::size_t
+    { return size + frame_count * lorawan_frame_overhead; }
+};
+
+/**
+ * @brief Computes the difference between two configs.
+ * 
+ * @details The values of the settings are expected in the binary form in which a @ref
+ * message_parser sets them, such as after parsing the full config messages of both
+ * configs on a host. A setting with a bitspan has changed if it is set in the target
+ * config, and if its value differs from the current config or is not set there.
+ * 
+ * @tparam Settings Container type that stores its contents in a contiguous sequence.
+ * 
+ * @param[in] current Settings of the config that is currently in use by a device.
+ * @param[in] target Settings of the config that the device should change to.
+ * 
+ * @return Copy of the target settings, of which only the changed settings are set.
+ */
+template<typename Settings,
+    typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
+[[nodiscard]]
+constexpr auto diff_settings(Settings const& current, Settings const& target)
+-> Settings {
+    auto changes = target;
+    for (auto idx = std::size_t{}; idx < std::size(target); ++idx) {
+        auto const& from = current[idx];
+        auto const& to = target[idx];
+        auto const changed = to.config_bits().size() != 0 and to.is_set()
+            and (not from.is_set() or convert_bits<std::uint64_t>(from.view_value())
+                != convert_bits<std::uint64_t>(to.view_value()));
+        if (not changed) changes[idx].set_value(std::string_view{});
+    }
+    return changes;
+}
+
+/**
+ * @brief Plans and writes the downlink that changes a device's config with the fewest
+ * bytes over the air.
+ * 
+ * @details The changed settings are written as a delta message and as a packed message,
+ * which leave the other settings in place. The complete target config is written as a
+ * config message, which is split into fragments if it exceeds the maximum frame size.
+ * The encoding that sends the fewest bytes over the air, including the overhead of each
+ * LoRaWAN frame, is written to the buffer. On a tie, the encoding that is listed first
+ * in @ref downlink_encoding is preferred.
+ * 
+ * @tparam MaxFragments Maximum number of fragments of the reassembly on the device.
+ * @tparam Settings Container type that stores its contents in a contiguous sequence.
+ * 
+ * @param[in] current Settings of the config that is currently in use by the device.
+ * @param[in] target Settings of the config that the device should change to. Refer to
+ * @ref diff_settings for the form of the values.
+ * @param[in] max_frame_size Maximum payload size of a single downlink.
+ * @param[out] buffer Pointer to the first byte of the buffer to write the frames to,
+ * back to back.
+ * @param[in] buffer_size Capacity of the buffer.
+ * 
+ * @return Plan of the written downlink, or nothing if none of the encodings fits.
+ */
+template<std::size_t MaxFragments = 4, typename Settings,
+    typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
+constexpr auto plan_downlink(
+    Settings const& current,
+    Settings const& target,
+    std::size_t max_frame_size,
+    std::byte* buffer,
+    std::size_t buffer_size
+) -> std::optional<downlink_plan> {
+    if (buffer == nullptr) return std::nullopt;
+
+    auto const changes = diff_settings(current, target);
+    auto changed = false;
+    for (auto const& setting_obj : changes) {
+        changed = changed or setting_obj.is_set();
+    }
+    if (not changed) return downlink_plan{downlink_encoding::none, 0, 0, 0};
+
+    auto message = std::array<std::byte, bitspan::byte_boundary>{};
+    auto const message_size
+        = write_config_message(target, message.data(), message.size());
+    auto const layout = make_fragment_layout<MaxFragments>(message_size, max_frame_size);
+
+    auto const write = [&](downlink_encoding encoding) -> std::size_t {
+        switch (encoding) {
+        case downlink_encoding::delta:
+            return write_delta_message(changes, buffer, buffer_size);
+        case downlink_encoding::packed:
+            return write_packed_message(changes, buffer, buffer_size);
+        case downlink_encoding::full:
+            if (message_size == 0 or buffer_size < message_size) return 0;
+            for (auto idx = std::size_t{}; idx < message_size; ++idx) {
+                buffer[idx] = message[idx];
+            }
+            return message_size;
+        case downlink_encoding::fragmented:
+            return write_message_fragments(
+                {message.data(), static_cast<std::uint_least8_t>(message_size)},
+                layout, buffer, buffer_size);
+        default:
+            return 0;
+        }
+    };
+
+    auto best = std::optional<downlink_plan>{};
+    auto const consider = [&best](downlink_plan plan) {
+        if (plan.size == 0) return;
+        if (best and best->airtime_bytes() <= plan.airtime_bytes()) return;
+        best = plan;
+    };
+    for (auto const encoding : {downlink_encoding::delta, downlink_encoding::packed,
+        downlink_encoding::full}) {
+        auto const size = write(encoding);
+        if (size <= max_frame_size) consider({encoding, size, size, 1});
+    }
+    if (message_size > max_frame_size and layout.frame_count != 0) {
+        consider({downlink_encoding::fragmented,
+            write(downlink_encoding::fragmented), layout.frame_size, layout.frame_count});
+    }
+
+    if (best) write(best->encoding);
+    return best;
+}
+
+} // namespace cfg
+
+#endif
@@ -0,0 +1,483 @@
+/**
+ * @file image-parser.h
+ * @brief Parsing-mechanism for processing binary pre-compiled config images.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+*/
+#ifndef CFG_CONFIG_PARSING_IMAGE_PARSER_H
+#define CFG_CONFIG_PARSING_IMAGE_PARSER_H
+
+#include "config-parser.h"
+
+#include <checking/validation-mode.h>
+#include <errors/error-handler.h>
+#include <errors/error-types.h>
+#include <traits/class-traits.h>
+#include <traits/iterator-traits.h>
+#include <utilities/algorithm.h>
+#include <utilities/bitwise.h>
+#include <utilities/checksum.h>
+#include <utilities/container.h>
+#include <utilities/enum.h>
+#include <utilities/range.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * @namespace cfg
+ * 
+ * @brief Contains everything related to the processing of configuration files.
+ */
+namespace cfg {
+
+/**
+ * @struct image_format
+ * 
+ * @brief Describes the layout of a binary config image.
+ * 
+ * @details A config image starts with a header of #header_size bytes: the four
+ * characters of #magic, a version byte, a reserved byte and the number of records as a
+ * little-endian 16-bit integer. Each record consists of a setting-identifier byte, a
+ * length byte and the characters of the setting's value. The image ends with the CRC-32
+ * checksum of all the preceding bytes, as a little-endian 32-bit integer.
+ * 
+ * The values are stored in their textual form, exactly as they would appear within an
+ * XML config file, so that they are validated the same way.
+ */
+struct image_format {
+    /**
+     * @var magic
+     * 
+     * @brief Characters that identify a config image.
+     */
+    static constexpr char magic[] = "AECF";
+
+    /**
+     * @var magic_size
+     * 
+     * @brief Number of magic characters, excluding the null-terminator.
+     */
+    static constexpr auto magic_size = std::size_t{4};
+
+    /**
+     * @var version
+     * 
+     * @brief Version of the config image layout that is supported.
+     */
+    static constexpr auto version = std::uint8_t{1};
+
+    /**
+     * @var header_size
+     * 
+     * @brief Size of the header, in number of bytes.
+     */
+    static constexpr auto header_size = std::size_t{8};
+
+    /**
+     * @var record_header_size
+     * 
+     * @brief Size of the identifier and length of a record, in number of bytes.
+     */
+    static constexpr auto record_header_size = std::size_t{2};
+
+    /**
+     * @var checksum_size
+     * 
+     * @brief Size of the checksum, in number of bytes.
+     */
+    static constexpr auto checksum_size = std::size_t{4};
+
+    /**
+     * @var max_record_count
+     * 
+     * @brief Maximum number of records within a config image.
+     */
+    static constexpr auto max_record_count = std::size_t{0xFFFF};
+};
+
+/**
+ * @class image_data
+ * 
+ * @brief Data-type used for handling config images, consisting of a pointer to a range
+ * of bytes and a size.
+ * 
+ * @details The bytes are only read, so the pointer can refer to a config image that is
+ * mapped into memory directly, such as one that is stored in flash.
+ */
+class image_data {
+public:
+    /**
+     * @brief Default constructs an image-data object.
+     */
+    constexpr image_data() = default;
+
+    /**
+     * @brief Constructs an image-data object with a given data pointer and size.
+     */
+    constexpr image_data(std::byte const* data, std::size_t size)
+        : data_{data}, size_{size} {}
+
+    /**
+     * @brief Gets the data pointer.
+     */
+    [[nodiscard]]
+    constexpr auto data() const -> std::byte const*
+    { return data_; }
+
+    /**
+     * @brief Gets the size of the image data.
+     */
+    [[nodiscard]]
+    constexpr auto size() const -> std::size_t
+    { return size_; }
+
+    /**
+     * @brief Compares two image-data objects for (in)equality.
+     * 
+     * @param[in] lhs Image-data object on the left-hand side of the operator.
+     * @param[in] rhs Image-data object on the right-hand side of the operator.
+     * 
+     * @return Two image-data objects are considered to be equal when their data pointer
+     * and size matches.
+     * @{
+     */
+    [[nodiscard]]
+    friend constexpr auto operator!=(
+        image_data const& lhs, image_data const& rhs) -> bool
+    { return not (lhs == rhs); }
+
+    [[nodiscard]]
+    friend constexpr auto operator==(
+        image_data const& lhs, image_data const& rhs) -> bool
+    { return lhs.data_ == rhs.data_ and lhs.size_ == rhs.size_; }
+    /** @} */
+
+private:
+    std::byte const* data_{}; /**< Pointer to the data of the image. */
+    std::size_t size_{};      /**< Size of the image data. */
+};
+
+/**
+ * @class image_parser
+ * 
+ * @brief Parses binary config images and maps the value of each record to the value-
+ * buffer of the setting with a matching identifier.
+ * 
+ * @details Config images are meant to be produced from XML config files in advance. No
+ * text has to be tokenized, yet the values are validated and applied with the same
+ * validators and actions as the values of an XML config file.
+ * 
+ * @tparam SettingIter Iterator type of the settings container.
+ * @tparam MaxSettings Maximum number of settings to operate on.
+ */
+template<typename SettingIter, int MaxSettings,
+    typename = std::enable_if_t<is_random_access_iter_v<SettingIter>>,
+    typename = std::enable_if_t<(MaxSettings > 0)>>
+class image_parser : public config_parser<image_parser<SettingIter, MaxSettings>> {
+    /**
+     * @typedef base_type
+     * 
+     * @brief Shorter notation to refer to the type of the base class.
+     */
+    using base_type = config_parser<image_parser<SettingIter, MaxSettings>>;
+
+    /**
+     * @typedef settings_range
+     * 
+     * @brief Type of the range of settings.
+     */
+    using settings_range = range<SettingIter>;
+
+    /**
+     * @{
+     * @brief Grants the public interface access to its implementation.
+     */
+    template<typename Config>
+    friend constexpr auto base_type::parse_config(Config const&) -> void;
+    friend auto base_type::report_parsing_errors() const -> void;
+    friend constexpr auto base_type::has_parsing_errors() const -> bool;
+    friend constexpr auto base_type::export_parsing_errors(
+        std::byte*, std::size_t) const -> std::size_t;
+    /** @} */
+
+public:
+    /**
+     * @var max_settings
+     * 
+     * @brief Maximum number of settings that an image parser can operate on.
+     */
+    static constexpr auto max_settings = int{MaxSettings};
+
+    /**
+     * @var validation
+     * 
+     * @brief Indicates how the values that an image parser sets should be validated.
+     */
+    static constexpr auto validation = validation_mode::config_file;
+
+    /**
+     * @brief Default constructs an image parser.
+     */
+    constexpr image_parser() = default;
+
+    /**
+     * @brief Constructs an image parser with a range of settings to operate on.
+     * 
+     * @tparam Settings Container type that stores its contents in a contiguous sequence.
+     * 
+     * @param[in,out] settings Container with settings which will have their values set
+     * based on the records of the parsed config image.
+     */
+    template<typename Settings,
+        typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
+    constexpr explicit image_parser(Settings& settings)
+        : settings_{settings} {}
+
+    /**
+     * @brief Clears all of the parsing errors.
+     */
+    constexpr auto clear_parsing_errors() -> void
+    { err_handler.clear_errors(); }
+
+    /**
+     * @brief Sets the new range of settings to operate on.
+     * 
+     * @details If the distance of the new range of settings exceeds the MaxSettings
+     * value, the new range is ignored and no changes are made.
+     * 
+     * @param[in] settings New range of settings to operate on. This can also be a
+     * reference to a container type, due to the extensive constructors of the range
+     * class.
+     */
+    constexpr auto set_settings(settings_range settings) -> void {
+        auto const distance = settings.distance();
+        if (distance <= 0 or distance > MaxSettings) return;
+        settings_ = settings;
+    }
+
+private:
+    /**
+     * @brief Parses a config image.
+     * 
+     * @details Validates the header and checksum of the config image and walks through
+     * its records. The value of each record is written to the value-buffer of the
+     * setting with the same identifier. Records with an unknown identifier are ignored,
+     * just like unknown tags within an XML config file. If a setting occurs more than
+     * once, only its first record is used. Settings without a record are left unset.
+     * 
+     * @param[in] image Config image to parse.
+     */
+    constexpr auto parse_config_impl(image_data image) -> void {
+        err_handler.clear_errors();
+        cfg::fill(values_parsed, false);
+        for (auto&& setting_obj : settings_) {
+            setting_obj.set_value(std::string_view{});
+        }
+
+        validate_config_image(image);
+        if (err_handler.contains_errors()) return;
+
+        auto const record_count = detail::read_le<std::uint16_t>(
+            image.data() + image_format::magic_size + 2);
+        auto const end = image.size() - image_format::checksum_size;
+        auto offset = image_format::header_size;
+
+        for (auto record = 0u; record < record_count; ++record) {
+            if (end - offset < image_format::record_header_size) {
+                err_handler.add_error(parsing_error::truncated_image_record, record);
+                return;
+            }
+            auto const id = std::to_integer<int>(image.data()[offset]);
+            auto const length = std::to_integer<std::size_t>(image.data()[offset + 1]);
+            offset += image_format::record_header_size;
+
+            if (end - offset < length) {
+                err_handler.add_error(parsing_error::truncated_image_record, record);
+                return;
+            }
+            auto const value = std::string_view{
+                reinterpret_cast<char const*>(image.data() + offset), length};
+            offset += length;
+
+            set_setting_value(id, value);
+        }
+    }
+
+    /**
+     * @brief Validates the header and checksum of a config image.
+     * 
+     * @param[in] image Config image to validate.
+     */
+    constexpr auto validate_config_image(image_data image) -> void {
+        auto const min_size = image_format::header_size + image_format::checksum_size;
+        if (image.data() == nullptr or image.size() < min_size) {
+            err_handler.add_error(parsing_error::invalid_image_header);
+            return;
+        }
+        for (auto idx = std::size_t{}; idx < image_format::magic_size; ++idx) {
+            if (std::to_integer<char>(image.data()[idx]) != image_format::magic[idx]) {
+                err_handler.add_error(parsing_error::invalid_image_header);
+                return;
+            }
+        }
+        if (auto const version = std::to_integer<std::uint8_t>(
+                image.data()[image_format::magic_size]);
+            version != image_format::version)
+        {
+            err_handler.add_error(parsing_error::unsupported_image_version, version);
+            return;
+        }
+        auto const checked_size = image.size() - image_format::checksum_size;
+        auto const checksum = detail::read_le<std::uint32_t>(image.data() + checked_size);
+        if (crc32(image.data(), checked_size) != checksum) {
+            err_handler.add_error(parsing_error::image_checksum_mismatch);
+        }
+    }
+
+    /**
+     * @brief Sets the value of the setting with a given identifier.
+     * 
+     * @details If the size of the value exceeds the size of a setting's value-buffer,
+     * the value is only copied partially and a matching parser-error is added to the
+     * error-handler.
+     * 
+     * @param[in] id Underlying value of the setting-identifier.
+     * @param[in] value Value of the record.
+     */
+    constexpr auto set_setting_value(int id, std::string_view value) -> void {
+        for (auto [it, end, idx] = settings_.enumerate(); it != end; ++it, ++idx) {
+            if (to_underlying(it->id()) != id) continue;
+            if (values_parsed[idx]) return;
+
+            if (value.size() > it->value_capacity()) {
+                err_handler.add_error(parsing_error::exceeds_max_value_length, id);
+            }
+            it->set_value(value);
+            values_parsed[idx] = true;
+            return;
+        }
+    }
+
+    /**
+     * @brief Checks if any error has occurred during the parsing of a config image.
+     */
+    [[nodiscard]]
+    constexpr auto has_parsing_errors_impl() const -> bool
+    { return err_handler.contains_errors(); }
+
+    /**
+     * @brief Reports any error that might have occurred during the parsing of a
+     * config image.
+     * 
+     * @details If there are no parsing errors to report, the logging request is simply
+     * ignored.
+     */
+    auto report_parsing_errors_impl() const -> void {
+        err_handler.log_errors(
+            "[ERROR]Some errors occurred while parsing the config image:\n");
+    }
+
+    /**
+     * @brief Exports the errors that occurred during the parsing of a config image
+     * as a binary error record.
+     * 
+     * @param[out] buffer Buffer to write the error record to.
+     * @param[in] buffer_size Capacity of the buffer, in number of bytes.
+     * 
+     * @return Number of bytes written.
+     */
+    constexpr auto export_parsing_errors_impl(
+        std::byte* buffer, std::size_t buffer_size) const -> std::size_t
+    { return err_handler.export_errors(error_source::parsing, buffer, buffer_size); }
+
+    error_handler<MaxSettings> err_handler;   /**< Handles potential parsing-errors. */
+    settings_range settings_;                 /**< Range of settings to operate on. */
+    array<bool, MaxSettings> values_parsed{}; /**< Tracks which values are parsed. */
+};
+
+/**
+ * @remark Allows an image parser to be constructed from a container type.
+ * 
+ * @tparam Settings Container type that stores its contents in a contiguous sequence.
+ */
+template<typename Settings,
+    typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
+image_parser(Settings&)
+    -> image_parser<iterator_type<Settings>, std::tuple_size<Settings>{}>;
+
+/**
+ * @brief Writes the values of a range of settings to a config image.
+ * 
+ * @details Only the settings that are set are written, in order. This allows a host
+ * tool to parse an XML config file with an @ref xml_parser and to convert the resulting
+ * settings to a config image, which is then parsed by an @ref image_parser on the device.
+ * 
+ * @tparam Settings Container type that stores its contents in a contiguous sequence.
+ * 
+ * @param[in] settings Container with the settings to write.
+ * @param[out] buffer Pointer to the first byte of the buffer to write the image to.
+ * @param[in] buffer_size Capacity of the buffer.
+ * 
+ * @return Size of the written config image. If the buffer is too small, or if a setting
+ * could not be represented within a config image, a value of zero is returned.
+ */
+template<typename Settings,
+    typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
+constexpr auto write_config_image(
+    Settings const& settings,
+    std::byte* buffer,
+    std::size_t buffer_size
+) -> std::size_t {
+    auto const min_size = image_format::header_size + image_format::checksum_size;
+    if (buffer == nullptr or buffer_size < min_size) return 0;
+
+    auto const end = buffer_size - image_format::checksum_size;
+    auto offset = image_format::header_size;
+    auto record_count = std::size_t{};
+
+    for (auto const& setting_obj : settings) {
+        if (not setting_obj.is_set()) continue;
+
+        auto const id = to_underlying(setting_obj.id());
+        auto const value = setting_obj.view_value();
+        if (id < 0 or id > 0xFF or value.size() > 0xFF) return 0;
+        if (record_count == image_format::max_record_count) return 0;
+        if (end - offset < image_format::record_header_size + value.size()) return 0;
+
+        buffer[offset] = static_cast<std::byte>(id);
+        buffer[offset + 1] = static_cast<std::byte>(value.size());
+        offset += image_format::record_header_size;
+        for (auto const character : value) {
+            buffer[offset++] = static_cast<std::byte>(character);
+        }
+        ++record_count;
+    }
+
+    for (auto idx = std::size_t{}; idx < image_format::magic_size; ++idx) {
+        buffer[idx] = static_cast<std::byte>(image_format::magic[idx]);
+    }
+    buffer[image_format::magic_size] = std::byte{image_format::version};
+    buffer[image_format::magic_size + 1] = std::byte{};
+    detail::write_le(buffer + image_format::magic_size + 2,
+        static_cast<std::uint16_t>(record_count));
+    detail::write_le(buffer + offset, crc32(buffer, offset));
+
+    return offset + image_format::checksum_size;
+}
+
+} // namespace cfg
+
+#endif
@@ -0,0 +1,890 @@
+/**
+ * @file json-parser.h
+ * @brief Parsing-mechanism for processing JSON-formatted data.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_CONFIG_PARSING_JSON_PARSER_H
+#define CFG_CONFIG_PARSING_JSON_PARSER_H
+
+#include "config-parser.h"
+#include "file-pointer.h"
+#include "tag-pool.h"
+#include "tag-table.h"
+
+#include <checking/validation-mode.h>
+#include <errors/error-handler.h>
+#include <errors/error-types.h>
+#include <traits/class-traits.h>
+#include <traits/iterator-traits.h>
+#include <utilities/algorithm.h>
+#include <utilities/container.h>
+#include <utilities/range.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * @namespace cfg
+ * 
+ * @brief Contains everything related to the processing of configuration files.
+ */
+namespace cfg {
+
+/**
+ * @namespace detail
+ * 
+ * @brief Provides helper/meta functions/types local to this header file.
+ */
+namespace detail {
+
+/**
+ * @brief Gets the size of the buffer that parsed JSON keys and values are stored in.
+ * 
+ * @details One more character than the longest tag-name or value is stored, so that a
+ * string that is too long is never mistaken for one that fits, along with the
+ * null-character. If the longest tag-name is not known in compile time, a default size
+ * is used instead.
+ * 
+ * @tparam Setting Type of the settings that the parsed strings are mapped to.
+ * 
+ * @return Number of characters of the buffer.
+ */
+template<typename Setting>
+[[nodiscard]]
+constexpr auto json_token_size() -> std::size_t {
+    if constexpr (has_max_tag_length_v<Setting>) {
+        return std::max(Setting::max_tag_length, Setting::max_value_size) + 2;
+    } else {
+        return std::size_t{64};
+    }
+}
+
+} // namespace detail
+
+/**
+ * @class json_parser
+ * 
+ * @brief Parses JSON-formatted data and maps each parsed value to a matching setting.
+ * 
+ * @details The keys of nested objects form the path of tag-names of a setting, so that
+ * {"aether": {"usb": {"detection": "on"}}} sets the same setting as the equivalent XML
+ * tags would. Strings and numbers are stored as they are, while true and false are
+ * stored as 1 and 0 respectively. A null value leaves its setting unset, and the
+ * contents of arrays are not mapped to any setting.
+ * 
+ * The data is tokenized one character at a time by a small state machine, so it can be
+ * provided in blocks of any size. Keys and values are gathered in a buffer that is sized
+ * from the settings, so the parser never allocates.
+ * 
+ * @tparam SettingIter Iterator type of the settings container.
+ * @tparam MaxSettings Maximum number of settings to operate on.
+ */
+template<typename SettingIter, int MaxSettings,
+    typename = std::enable_if_t<is_random_access_iter_v<SettingIter>>,
+    typename = std::enable_if_t<(MaxSettings > 0)>>
+class json_parser : public config_parser<json_parser<SettingIter, MaxSettings>> {
+    /**
+     * @typedef base_type
+     * 
+     * @brief Shorter notation to refer to the type of the base class.
+     */
+    using base_type = config_parser<json_parser<SettingIter, MaxSettings>>;
+
+    /**
+     * @typedef settings_range
+     * 
+     * @brief Type of the range of settings.
+     */
+    using settings_range = range<SettingIter>;
+
+    /**
+     * @typedef setting_t
+     * 
+     * @brief Type of the settings.
+     */
+    using setting_t = typename settings_range::value_type;
+
+    /**
+     * @{
+     * @brief Grants the public interface access to its implementation.
+     */
+    template<typename Config>
+    friend constexpr auto base_type::parse_config(Config const&) -> void;
+    friend auto base_type::report_parsing_errors() const -> void;
+    friend constexpr auto base_type::has_parsing_errors() const -> bool;
+    friend constexpr auto base_type::export_parsing_errors(
+        std::byte*, std::size_t) const -> std::size_t;
+    /** @} */
+
+public:
+    /**
+     * @var max_settings
+     * 
+     * @brief Maximum number of settings that a JSON parser can operate on.
+     */
+    static constexpr auto max_settings = int{MaxSettings};
+
+    /**
+     * @var validation
+     * 
+     * @brief Indicates how the values that a JSON parser sets should be validated.
+     */
+    static constexpr auto validation = validation_mode::config_file;
+
+    /**
+     * @var max_tag_depth
+     * 
+     * @brief Maximum tag-depth of all the settings.
+     */
+    static constexpr auto max_tag_depth
+        = int{settings_range::value_type::max_tag_depth};
+
+    /**
+     * @var max_nesting
+     * 
+     * @brief Maximum number of objects and arrays that can be nested within each other.
+     */
+    static constexpr auto max_nesting = int{32};
+
+    /**
+     * @var token_size
+     * 
+     * @brief Size of the buffer that parsed keys and values are stored in.
+     */
+    static constexpr auto token_size = detail::json_token_size<setting_t>();
+
+    /**
+     * @typedef setting_parsed_fn
+     * 
+     * @brief Function type that is notified with the index of each setting of which the
+     * value has been parsed completely, along with a type-erased context object.
+     */
+    using setting_parsed_fn = auto (*)(void*, std::uint_fast16_t) -> void;
+
+    /**
+     * @brief Default constructs a JSON parser.
+     */
+    constexpr json_parser() = default;
+
+    /**
+     * @brief Constructs a JSON parser with a range of settings to operate on.
+     * 
+     * @tparam Settings Container type that stores its contents in a contiguous sequence.
+     * 
+     * @param[in,out] settings Container with settings. Their tags will be searched and
+     * their values will be set based on the contents of the parsed JSON data.
+     */
+    template<typename Settings,
+        typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
+    constexpr explicit json_parser(Settings& settings)
+        : settings_{settings} {}
+
+    /**
+     * @brief Constructs a JSON parser with a range of settings to operate on and a
+     * lookup that resolves keys to these settings.
+     * 
+     * @tparam Settings Container type that stores its contents in a contiguous sequence.
+     * 
+     * @param[in,out] settings Container with settings. Their values will be set based on
+     * the contents of the parsed JSON data.
+     * @param[in] lookup Lookup of a @ref tag_table that is made from the same settings.
+     */
+    template<typename Settings,
+        typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
+    constexpr json_parser(Settings& settings, tag_lookup lookup)
+        : settings_{settings}, lookup_table{lookup} {}
+
+    /**
+     * @brief Clears all of the parsing errors.
+     */
+    constexpr auto clear_parsing_errors() -> void
+    { err_handler.clear_errors(); }
+
+    /**
+     * @brief Sets the new range of settings to operate on.
+     * 
+     * @details If the distance of the new range of settings exceeds the MaxSettings
+     * value, the new range is ignored and no changes are made.
+     * 
+     * The lookup that resolves keys is cleared, since it most likely does not match the
+     * new range of settings. Use @ref set_tag_lookup to provide a new one.
+     * 
+     * @param[in] settings New range of settings to operate on. This can also be a
+     * reference to a container type, due to the extensive constructors of the range
+     * class.
+     */
+    constexpr auto set_settings(settings_range settings) -> void {
+        auto const distance = settings.distance();
+        if (distance <= 0 or distance > MaxSettings) return;
+        settings_ = settings;
+        lookup_table = {};
+    }
+
+    /**
+     * @brief Sets the lookup that resolves keys to the range of settings.
+     * 
+     * @details With a lookup, each parsed key is resolved with a single hash-table
+     * lookup, instead of being matched against the tag-names of all the settings.
+     * 
+     * @param[in] lookup Lookup of a @ref tag_table that is made from the same settings,
+     * or an empty lookup to match the tag-names of all the settings instead.
+     */
+    constexpr auto set_tag_lookup(tag_lookup lookup) -> void
+    { lookup_table = lookup; }
+
+    /**
+     * @brief Sets the handler that is notified whenever the value of a setting has been
+     * parsed completely.
+     * 
+     * @details The handler is invoked right after the value of a setting is stored,
+     * while the JSON data is still being parsed. The handler must not modify the values
+     * of any other settings.
+     * 
+     * @param[in] handler Function to notify, or a null pointer to stop notifying.
+     * @param[in] context Object that is passed on to the handler.
+     */
+    constexpr auto set_setting_parsed_handler(
+        setting_parsed_fn handler, void* context) -> void
+    {
+        parsed_handler = handler;
+        parsed_context = context;
+    }
+
+    /**
+     * @brief Prepares the parser for parsing JSON-formatted data in blocks.
+     * 
+     * @details Resets all the parsing state. The JSON data can then be provided block by
+     * block with @ref parse_block, after which the parsing should be completed with @ref
+     * end_parsing.
+     */
+    constexpr auto begin_parsing() -> void
+    { reset_parsing(); }
+
+    /**
+     * @brief Parses the next block of JSON-formatted data.
+     * 
+     * @details The block does not have to end at the boundary of a key or a value, as
+     * the state of the tokenizer is kept between blocks. Once a syntax error has been
+     * found, the rest of the data is ignored.
+     * 
+     * @param[in] block Next block of JSON-formatted data to parse.
+     */
+    constexpr auto parse_block(std::string_view block) -> void {
+        for (auto const character : block) {
+            if (state == json_state::failed) break;
+            parse_character(character);
+        }
+        bytes_parsed += static_cast<std::uint_least32_t>(block.size());
+    }
+
+    /**
+     * @brief Completes the parsing of JSON-formatted data that was provided in blocks.
+     * 
+     * @details If no data was parsed at all, a matching parsing-error is added to the
+     * error-handler. Otherwise, the parsing process is verified.
+     */
+    constexpr auto end_parsing() -> void {
+        if (bytes_parsed == 0) {
+            err_handler.add_error(parsing_error::empty_config, current_position());
+            return;
+        }
+        if (state == json_state::in_literal) {
+            end_literal();
+        }
+        verify_parsing();
+    }
+
+private:
+    /**
+     * @enum json_state
+     * 
+     * @brief Enumeration of what the tokenizer expects the next character to be part of.
+     */
+    enum class json_state : std::uint8_t {
+        expect_value,       /**< Expects any value. */
+        expect_first_value, /**< Expects the first value of an array, or its end. */
+        expect_key,         /**< Expects the key of an object member. */
+        expect_first_key,   /**< Expects the first key of an object, or its end. */
+        expect_colon,       /**< Expects the colon that follows a key. */
+        expect_separator,   /**< Expects a comma or the end of an object or array. */
+        in_key,             /**< Parses the characters of a key. */
+        in_string,          /**< Parses the characters of a string value. */
+        in_literal,         /**< Parses the characters of a number or literal name. */
+        done,               /**< Expects nothing but whitespace. */
+        failed              /**< Ignores the rest of the data after a syntax error. */
+    };
+
+    /**
+     * @brief Parses JSON-formatted data.
+     * 
+     * @param[in] config JSON-formatted data to parse.
+     */
+    constexpr auto parse_config_impl(std::string_view config) -> void {
+        begin_parsing();
+        parse_block(config);
+        end_parsing();
+    }
+
+    /**
+     * @brief Resets all the state that changes during the parsing of the JSON data.
+     * 
+     * @details The values of the settings are cleared as well, so that a setting that
+     * was parsed before but that is left out now is reported as not set.
+     */
+    constexpr auto reset_parsing() -> void {
+        err_handler.clear_errors();
+        cfg::fill_n(tag_levels, settings_.distance(), std::int8_t{});
+        cfg::fill(values_parsed, false);
+        for (auto&& setting_obj : settings_) {
+            setting_obj.set_value(std::string_view{});
+        }
+        cfg::fill(tag_path, static_cast<std::int_least16_t>(tag_lookup::no_node));
+        tag_path.front() = tag_lookup::root_node;
+        bytes_parsed = 0;
+        line = 1;
+        column = 0;
+        arrays = 0;
+        token_length = 0;
+        nesting = 0;
+        object_depth = 0;
+        ignored_nesting = 0;
+        key_depth = -1;
+        state = json_state::expect_value;
+        escaped = false;
+        key_parsed = false;
+    }
+
+    /**
+     * @brief Gets the position of the character that is being parsed.
+     */
+    [[nodiscard]]
+    constexpr auto current_position() const -> file_ptr
+    { return {static_cast<int>(column), static_cast<int>(line)}; }
+
+    /**
+     * @brief Verifies the parsing process.
+     * 
+     * @details If any object or array is still open, a matching parsing-error is added
+     * to the error-handler, just like an unterminated string or an expected value. If no
+     * keys were found at all, a matching parsing-error is added as well. A syntax error
+     * that has been added already makes the rest of these checks meaningless.
+     */
+    constexpr auto verify_parsing() -> void {
+        if (state == json_state::failed) return;
+        if (nesting > 0) {
+            err_handler.add_error(parsing_error::missing_closing_tag, nesting);
+        } else if (state != json_state::done) {
+            fail();
+        }
+        if (not key_parsed) {
+            err_handler.add_error(parsing_error::no_tags_found, current_position());
+        }
+    }
+
+    /**
+     * @brief Checks if any error has occurred during the parsing of the JSON data.
+     */
+    [[nodiscard]]
+    constexpr auto has_parsing_errors_impl() const -> bool
+    { return err_handler.contains_errors(); }
+
+    /**
+     * @brief Reports any error that might have occurred during the parsing of a config
+     * file.
+     * 
+     * @details If there are no parsing errors to report, the logging request is simply
+     * ignored.
+     */
+    auto report_parsing_errors_impl() const -> void {
+        err_handler.log_errors(
+            "[ERROR]Some errors occurred while parsing the config file:\n");
+    }
+
+    /**
+     * @brief Exports the errors that occurred during the parsing of the JSON data as a
+     * binary error record.
+     * 
+     * @param[out] buffer Buffer to write the error record to.
+     * @param[in] buffer_size Capacity of the buffer, in number of bytes.
+     * 
+     * @return Number of bytes written.
+     */
+    constexpr auto export_parsing_errors_impl(
+        std::byte* buffer, std::size_t buffer_size) const -> std::size_t
+    { return err_handler.export_errors(error_source::parsing, buffer, buffer_size); }
+
+    /**
+     * @brief Feeds a single character to the tokenizer.
+     * 
+     * @param[in] character Next character of the JSON data.
+     */
+    constexpr auto parse_character(char character) -> void {
+        track_position(character);
+        switch (state) {
+        case json_state::in_key:
+        case json_state::in_string:
+            parse_string_character(character);
+            return;
+        case json_state::in_literal:
+            if (is_literal_character(character)) {
+                append_token(character);
+                return;
+            }
+            end_literal();
+            if (state == json_state::failed) return;
+            break;
+        default:
+            break;
+        }
+        if (is_whitespace(character)) return;
+
+        switch (state) {
+        case json_state::expect_first_value:
+            if (character == ']') return close_container(character);
+            [[fallthrough]];
+        case json_state::expect_value:
+            return begin_value(character);
+        case json_state::expect_first_key:
+            if (character == '}') return close_container(character);
+            [[fallthrough]];
+        case json_state::expect_key:
+            if (character != '"') return fail();
+            token_length = 0;
+            state = json_state::in_key;
+            return;
+        case json_state::expect_colon:
+            if (character != ':') return fail();
+            state = json_state::expect_value;
+            return;
+        case json_state::expect_separator:
+            if (character == ',') {
+                state = is_in_array() ? json_state::expect_value : json_state::expect_key;
+                return;
+            }
+            if (character == '}' or character == ']') return close_container(character);
+            return fail();
+        default:
+            return fail();
+        }
+    }
+
+    /**
+     * @brief Feeds a character of a key or string value to the tokenizer.
+     * 
+     * @details The escape sequences of single characters are unescaped. Escaped Unicode
+     * code points are not supported, as the values of the settings are plain ASCII.
+     * 
+     * @param[in] character Next character of the key or string value.
+     */
+    constexpr auto parse_string_character(char character) -> void {
+        if (escaped) {
+            escaped = false;
+            switch (character) {
+            case '"': case '\\': case '/': return append_token(character);
+            case 'b': return append_token('\b');
+            case 'f': return append_token('\f');
+            case 'n': return append_token('\n');
+            case 'r': return append_token('\r');
+            case 't': return append_token('\t');
+            default:  return fail();
+            }
+        }
+        if (character == '\\') {
+            escaped = true;
+        } else if (character == '"') {
+            end_string();
+        } else if (static_cast<unsigned char>(character) < 0x20) {
+            fail();
+        } else {
+            append_token(character);
+        }
+    }
+
+    /**
+     * @brief Starts parsing a value of which the first character is given.
+     * 
+     * @param[in] character First character of the value.
+     */
+    constexpr auto begin_value(char character) -> void {
+        token_length = 0;
+        if (character == '{') {
+            open_container(false);
+            state = json_state::expect_first_key;
+        } else if (character == '[') {
+            open_container(true);
+            state = json_state::expect_first_value;
+        } else if (character == '"') {
+            state = json_state::in_string;
+        } else if (character == '-' or is_literal_character(character)) {
+            append_token(character);
+            state = json_state::in_literal;
+        } else {
+            fail();
+        }
+    }
+
+    /**
+     * @brief Completes a key or string value.
+     */
+    constexpr auto end_string() -> void {
+        if (state == json_state::in_key) {
+            handle_key(view_token());
+            state = json_state::expect_colon;
+        } else {
+            handle_value(view_token());
+            end_value();
+        }
+    }
+
+    /**
+     * @brief Completes a number or a literal name.
+     * 
+     * @details The literal names true and false are mapped to the values 1 and 0, so
+     * that they are validated like any other boolean value. The literal name null does
+     * not set any value. Any other literal must be a number, which is stored as is.
+     */
+    constexpr auto end_literal() -> void {
+        auto const literal = view_token();
+        if (literal == "true") {
+            handle_value("1");
+        } else if (literal == "false") {
+            handle_value("0");
+        } else if (literal != "null") {
+            auto const first = std::size_t{literal.front() == '-'};
+            if (literal.size() == first) return fail();
+            if (literal[first] < '0' or literal[first] > '9') return fail();
+            handle_value(literal);
+        }
+        end_value();
+    }
+
+    /**
+     * @brief Continues after a complete value.
+     */
+    constexpr auto end_value() -> void {
+        key_depth = -1;
+        state = nesting == 0 ? json_state::done : json_state::expect_separator;
+    }
+
+    /**
+     * @brief Opens an object or an array.
+     * 
+     * @details The keys of nested objects are mapped to deeper tag-names, as long as the
+     * object is not part of an array.
+     * 
+     * @param[in] is_array Indicates whether an array or an object is opened.
+     */
+    constexpr auto open_container(bool is_array) -> void {
+        if (nesting == max_nesting) return fail();
+        if (is_array) {
+            arrays |= std::uint32_t{1} << nesting;
+            if (ignored_nesting == 0) ignored_nesting = nesting + 1;
+        } else if (ignored_nesting == 0) {
+            ++object_depth;
+        }
+        ++nesting;
+        key_depth = -1;
+    }
+
+    /**
+     * @brief Closes the object or array that is opened last.
+     * 
+     * @param[in] character Character that closes the object or array.
+     */
+    constexpr auto close_container(char character) -> void {
+        if (nesting == 0 or (character == ']') != is_in_array()) return fail();
+        --nesting;
+        arrays &= ~(std::uint32_t{1} << nesting);
+        if (ignored_nesting == 0) {
+            --object_depth;
+        } else if (ignored_nesting == nesting + 1) {
+            ignored_nesting = 0;
+        }
+        end_value();
+    }
+
+    /**
+     * @brief Handles a key of an object member.
+     * 
+     * @details The key is matched against the tag-names of the settings at the depth of
+     * the object, or resolved with the tag-lookup. Keys within arrays and keys that are
+     * nested deeper than any setting are ignored.
+     * 
+     * @param[in] key Parsed key.
+     */
+    constexpr auto handle_key(std::string_view key) -> void {
+        key_parsed = true;
+        key_depth = -1;
+        if (ignored_nesting != 0) return;
+
+        auto const depth = object_depth - 1;
+        if (depth < 0 or depth >= max_tag_depth) return;
+        key_depth = static_cast<std::int_least8_t>(depth);
+
+        if (lookup_table.empty()) {
+            match_key(key_data(), depth);
+        } else {
+            tag_path[depth + 1] = static_cast<std::int_least16_t>(
+                lookup_table.find(tag_path[depth], key));
+        }
+    }
+
+    /**
+     * @brief Matches a key against the tag-names of all the settings at a given depth.
+     * 
+     * @details Every setting whose path of tag-names has been matched beyond the given
+     * depth belonged to a previous member of the same object, so its tracked tag-level
+     * is lowered to the depth first. The settings of which the tag-name at the depth
+     * matches the key then have their tag-level raised.
+     * 
+     * @param[in] key Zero-terminated key.
+     * @param[in] depth Depth of the key.
+     */
+    constexpr auto match_key(char const* key, int depth) -> void {
+        auto const resolved_key = intern_key(key);
+        auto const level = static_cast<std::int8_t>(depth);
+        for (auto [it, end, idx] = settings_.enumerate(); it != end; ++it, ++idx) {
+            if (tag_levels[idx] > level) tag_levels[idx] = level;
+            if (tag_levels[idx] != level)                  continue;
+            if (not key_matches(resolved_key, idx, level)) continue;
+            tag_levels[idx] = static_cast<std::int8_t>(level + 1);
+        }
+    }
+
+    /**
+     * @brief Handles a string, number or boolean value of an object member.
+     * 
+     * @details The value is stored by the setting of which the path of tag-names ends at
+     * the key of the member, unless that setting has been parsed already.
+     * 
+     * @param[in] value Parsed value.
+     */
+    constexpr auto handle_value(std::string_view value) -> void {
+        if (key_depth < 0) return;
+
+        auto const index = find_setting(key_depth + 1);
+        if (index < 0 or values_parsed[index]) return;
+
+        set_setting_value(static_cast<std::uint_fast16_t>(index), value);
+        values_parsed[index] = true;
+        notify_setting_parsed(static_cast<std::uint_fast16_t>(index));
+    }
+
+    /**
+     * @brief Finds the setting of which the path of tag-names ends at a given depth.
+     * 
+     * @param[in] depth Number of tag-names of the path.
+     * 
+     * @return Index of the setting, or a negative value if there is no such setting.
+     */
+    [[nodiscard]]
+    constexpr auto find_setting(int depth) const -> int {
+        if (not lookup_table.empty()) {
+            return static_cast<int>(lookup_table.setting_index(tag_path[depth]));
+        }
+        for (auto [it, end, idx] = settings_.enumerate(); it != end; ++it, ++idx) {
+            if (tag_levels[idx] != depth) continue;
+            if (depth == max_tag_depth or it->is_tag_empty(depth)) {
+                return static_cast<int>(idx);
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * @brief Checks if a key matches the tag-name of a given setting at a given depth.
+     * 
+     * @param[in] key Key, or the identifier of the interned key, to compare.
+     * @param[in] index Index of the setting to check.
+     * @param[in] depth Depth of the key.
+     */
+    template<typename Key>
+    [[nodiscard]]
+    constexpr auto key_matches(Key key, std::uint_fast16_t index, int depth) const
+    -> bool {
+        if constexpr (has_interned_tags_v<setting_t>) {
+            return key != unknown_tag_id and settings_[index].interned_tag(depth) == key;
+        } else {
+            return settings_[index].tag(depth) == std::string_view{key};
+        }
+    }
+
+    /**
+     * @brief Converts a parsed key to the form in which it is matched against the
+     * tag-names of the settings.
+     * 
+     * @param[in] key Zero-terminated key.
+     * 
+     * @return Identifier of the interned key if the settings support it, otherwise the
+     * key itself.
+     */
+    [[nodiscard]]
+    static constexpr auto intern_key(char const* key) {
+        if constexpr (has_interned_tags_v<setting_t>) {
+            return setting_t::find_tag(key);
+        } else {
+            return key;
+        }
+    }
+
+    /**
+     * @brief Sets the value of a given setting to the parsed value.
+     * 
+     * @details If the size of the value exceeds the size of a setting's value-buffer,
+     * the value is only copied partially and a matching parser-error is added to the
+     * error-handler.
+     * 
+     * @param[in] index Index of the setting.
+     * @param[in] value Parsed value.
+     */
+    constexpr auto set_setting_value(std::uint_fast16_t index, std::string_view value)
+    -> void {
+        if (value.size() > settings_[index].value_capacity()) {
+            err_handler.add_error(
+                parsing_error::exceeds_max_value_length, current_position());
+        }
+        settings_[index].set_value(value);
+    }
+
+    /**
+     * @brief Notifies the setting-parsed handler (if any) that the value of a given
+     * setting has been parsed completely.
+     * 
+     * @param[in] index Index of the setting.
+     */
+    constexpr auto notify_setting_parsed(std::uint_fast16_t index) const -> void {
+        if (parsed_handler == nullptr) return;
+        parsed_handler(parsed_context, index);
+    }
+
+    /**
+     * @brief Appends a character to the key or value that is being parsed.
+     * 
+     * @details Characters beyond the capacity of the buffer are discarded. The buffer
+     * holds one character more than any tag-name or value, so a discarded character is
+     * never mistaken for a string that fits.
+     * 
+     * @param[in] character Character to append.
+     */
+    constexpr auto append_token(char character) -> void {
+        if (token_length + std::size_t{1} >= token_size) return;
+        token[token_length++] = character;
+    }
+
+    /**
+     * @brief Gets a view of the key or value that has been parsed.
+     */
+    [[nodiscard]]
+    constexpr auto view_token() const -> std::string_view
+    { return {token.data(), token_length}; }
+
+    /**
+     * @brief Gets the key that has been parsed as a zero-terminated string.
+     */
+    [[nodiscard]]
+    constexpr auto key_data() -> char const* {
+        token[token_length] = '\0';
+        return token.data();
+    }
+
+    /**
+     * @brief Checks if the object or array that is opened last is an array.
+     */
+    [[nodiscard]]
+    constexpr auto is_in_array() const -> bool
+    { return nesting > 0 and (arrays >> (nesting - 1) & 1u) != 0; }
+
+    /**
+     * @brief Adds a syntax error at the current position and ignores the rest of the
+     * data.
+     */
+    constexpr auto fail() -> void {
+        err_handler.add_error(parsing_error::invalid_json_syntax, current_position());
+        state = json_state::failed;
+    }
+
+    /**
+     * @brief Keeps track of the line and column position of the parsed character.
+     * 
+     * @param[in] character Character that is being parsed.
+     */
+    constexpr auto track_position(char character) -> void {
+        if (character == '\n') {
+            ++line;
+            column = 0;
+        } else if (character != '\r') {
+            ++column;
+        }
+    }
+
+    /**
+     * @brief Checks if a character is whitespace between the tokens of JSON data.
+     */
+    [[nodiscard]]
+    static constexpr auto is_whitespace(char character) -> bool {
+        return character == ' ' or character == '\n'
+            or character == '\r' or character == '\t';
+    }
+
+    /**
+     * @brief Checks if a character can be part of a number or a literal name.
+     */
+    [[nodiscard]]
+    static constexpr auto is_literal_character(char character) -> bool {
+        return (character >= '0' and character <= '9')
+            or (character >= 'a' and character <= 'z')
+            or character == '+' or character == '-'
+            or character == '.' or character == 'E';
+    }
+
+    settings_range settings_;                     /**< Range of all the settings. */
+    tag_lookup lookup_table;                      /**< Resolves keys to settings. */
+    error_handler<MaxSettings> err_handler;       /**< Handles parsing-errors. */
+    array<std::int8_t, MaxSettings> tag_levels{}; /**< Tracks tag levels of settings. */
+    array<bool, MaxSettings> values_parsed{};     /**< Tracks which values are parsed. */
+    array<std::int_least16_t, max_tag_depth + 1> tag_path{}; /**< Resolved tag nodes. */
+    array<char, token_size> token{};              /**< Key or value being parsed. */
+    setting_parsed_fn parsed_handler{};           /**< Notified of parsed settings. */
+    void* parsed_context{};                       /**< Context of the parsed handler. */
+    std::uint_least32_t bytes_parsed{};           /**< Number of bytes parsed. */
+    std::uint_least32_t line{1};                  /**< Line of the parsed character. */
+    std::uint_least32_t column{};                 /**< Column of the parsed character. */
+    std::uint32_t arrays{};                       /**< Marks the nested arrays. */
+    std::uint_least16_t token_length{};           /**< Characters of the token. */
+    std::int_least8_t nesting{};                  /**< Open objects and arrays. */
+    std::int_least8_t object_depth{};             /**< Open objects outside arrays. */
+    std::int_least8_t ignored_nesting{};          /**< Nesting of the outer array. */
+    std::int_least8_t key_depth{-1};              /**< Depth of the current key. */
+    json_state state{json_state::expect_value};   /**< Expected part of the data. */
+    bool escaped{};                               /**< Tracks an escape sequence. */
+    bool key_parsed{};                            /**< Tracks if any key was parsed. */
+};
+
+/**
+ * @remark Allows a JSON parser to be constructed from a container type.
+ * 
+ * @tparam Settings Container type that stores its contents in a contiguous sequence.
+ */
+template<typename Settings,
+    typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
+json_parser(Settings&)
+    -> json_parser<iterator_type<Settings>, std::tuple_size<Settings>{}>;
+
+} // namespace cfg
+
+#endif
@@ -0,0 +1,91 @@
+/**
+ * @file message-data.h
+ * @brief Data-type used for handling config messages.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_CONFIG_PARSING_MESSAGE_DATA_H
+#define CFG_CONFIG_PARSING_MESSAGE_DATA_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @namespace cfg
+ * 
+ * @brief Contains everything related to the processing of configuration files.
+ */
+namespace cfg {
+
+/**
+ * @class message_data
+ * 
+ * @brief Data-type used for handling config messages, consisting of a pointer to a range
+ * of bytes and a size.
+ */
+class message_data {
+public:
+    /**
+     * @brief Default constructs a message-data object.
+     */
+    constexpr message_data() = default;
+
+    /**
+     * @brief Constructs a message-data object with a given data pointer and size.
+     */
+    constexpr message_data(std::byte* data, std::uint_least8_t size)
+        : data_{data}, size_{size} {}
+
+    /**
+     * @brief Gets the data pointer.
+     */
+    [[nodiscard]]
+    constexpr auto data() const -> std::byte const*
+    { return data_; }
+
+    /**
+     * @brief Gets the size of message data.
+     */
+    [[nodiscard]]
+    constexpr auto size() const -> std::uint_least8_t
+    { return size_; }
+
+    /**
+     * @brief Compares two message-data objects for (in)equality.
+     * 
+     * @param[in] lhs Message-data object on the left-hand side of the operator.
+     * @param[in] rhs Message-data object on the right-hand side of the operator.
+     * 
+     * @return Two message-data objects are considered to be equal when their data
+     * pointer and size matches.
+     * @{
+     */
+    [[nodiscard]]
+    friend constexpr auto operator!=(
+        message_data const& lhs, message_data const& rhs) -> bool
+    { return not (lhs == rhs); }
+
+    [[nodiscard]]
+    friend constexpr auto operator==(
+        message_data const& lhs, message_data const& rhs) -> bool
+    { return lhs.data_ == rhs.data_ and lhs.size_ == rhs.size_; }
+    /** @} */
+
+private:
+    std::byte* data_{};         /**< Pointer to the data of the message. */
+    std::uint_least8_t size_{}; /**< Size of of the message data. */
+};
+
+} // namespace cfg
+
+#endif
@@ -0,0 +1,170 @@
+/**
+ * @file message-decoder.h
+ * @brief Compile-time generated decoder for config messages.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+*/
+#ifndef CFG_CONFIG_PARSING_MESSAGE_DECODER_H
+#define CFG_CONFIG_PARSING_MESSAGE_DECODER_H
+
+#include <utilities/bitwise.h>
+#include <utilities/range.h>
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+/**
+ * @namespace cfg
+ * 
+ * @brief Contains everything related to the processing of configuration files.
+ */
+namespace cfg {
+
+/**
+ * @typedef message_decode_fn
+ * 
+ * @brief Function type that decodes a config message into a range of settings.
+ * 
+ * @details The function returns false if the range of settings does not match the
+ * settings that it was generated from, in which case no values are set.
+ * 
+ * @tparam SettingIter Iterator type of the settings container.
+ */
+template<typename SettingIter>
+using message_decode_fn = auto (*)(std::byte const*, range<SettingIter>) -> bool;
+
+/**
+ * @class message_decoder
+ * 
+ * @brief Decodes config messages with a straight-line sequence of field extractions
+ * that are generated in compile time.
+ * 
+ * @details The bitspans of the settings are collected in compile time. For each setting
+ * with a bitspan, an extraction of its span is generated with the position and size of
+ * that span as constants. Settings without a bitspan are left out of the generated code
+ * entirely. As such, decoding a config message involves no loop, no branches on the
+ * size of a bitspan and no run-time computation of shifts and masks.
+ * 
+ * @tparam GetSettings Function that returns the container of settings in compile time,
+ * such as @ref get_default_settings.
+ */
+template<auto GetSettings>
+class message_decoder {
+    /**
+     * @var setting_count
+     * 
+     * @brief Number of settings to decode a config message into.
+     */
+    static constexpr auto setting_count = std::tuple_size_v<decltype(GetSettings())>;
+
+    /**
+     * @brief Collects the bitspans of the settings.
+     * 
+     * @return Array containing the bitspan of each setting, in the same order.
+     */
+    [[nodiscard]]
+    static constexpr auto collect_bitspans() -> std::array<bitspan, setting_count> {
+        auto spans = std::array<bitspan, setting_count>{};
+        auto const settings = GetSettings();
+        for (auto idx = std::size_t{}; idx < setting_count; ++idx) {
+            spans[idx] = settings[idx].config_bits();
+        }
+        return spans;
+    }
+
+    /**
+     * @var spans
+     * 
+     * @brief Bitspans of the settings, which are only used in compile time.
+     */
+    static constexpr auto spans = collect_bitspans();
+
+public:
+    /**
+     * @brief Decodes a config message into a range of settings.
+     * 
+     * @details The extracted span of each setting is written to its value buffer. The
+     * value of a setting without a bitspan remains unaltered.
+     * 
+     * @warning Ensure that the config message refers to a range of at least N bytes,
+     * where N is greater or equal to the byte boundary of a bitspan.
+     * 
+     * @tparam SettingIter Iterator type of the settings container.
+     * 
+     * @param[in] message Pointer to the bytes of the config message.
+     * @param[in,out] settings Range of settings that matches the settings returned by
+     * GetSettings, i.e. that has the same number of settings in the same order.
+     * 
+     * @return True if the config message is decoded, false if the number of settings
+     * does not match.
+     */
+    template<typename SettingIter>
+    static constexpr auto decode(std::byte const* message, range<SettingIter> settings)
+        -> bool
+    {
+        if (settings.distance() != static_cast<std::ptrdiff_t>(setting_count)) {
+            return false;
+        }
+        decode_fields(message, settings, std::make_index_sequence<setting_count>{});
+        return true;
+    }
+
+private:
+    /**
+     * @brief Decodes the span of bits of all the settings.
+     * 
+     * @tparam SettingIter Iterator type of the settings container.
+     * @tparam Indices Indices of all the settings.
+     * 
+     * @param[in] message Pointer to the bytes of the config message.
+     * @param[in,out] settings Range of settings to decode the config message into.
+     */
+    template<typename SettingIter, std::size_t... Indices>
+    static constexpr auto decode_fields(
+        std::byte const* message,
+        range<SettingIter> settings,
+        std::index_sequence<Indices...>
+    ) -> void
+    { (decode_field<Indices>(message, settings), ...); }
+
+    /**
+     * @brief Decodes the span of bits of a single setting.
+     * 
+     * @details Expands to nothing if the setting does not have a bitspan.
+     * 
+     * @tparam Index Index of the setting.
+     * @tparam SettingIter Iterator type of the settings container.
+     * 
+     * @param[in] message Pointer to the bytes of the config message.
+     * @param[in,out] settings Range of settings to decode the config message into.
+     */
+    template<std::size_t Index, typename SettingIter>
+    static constexpr auto decode_field(
+        [[maybe_unused]] std::byte const* message,
+        [[maybe_unused]] range<SettingIter> settings
+    ) -> void {
+        constexpr auto pos = unsigned{spans[Index].pos()};
+        constexpr auto size = unsigned{spans[Index].size()};
+
+        if constexpr (size != 0) {
+            settings[Index].set_value(
+                extract_fixed_bits<pos, size>(message), (size + 7u) / 8u);
+        }
+    }
+};
+
+} // namespace cfg
+
+#endif
@@ -0,0 +1,355 @@
+/**
+ * @file message-fragments.h
+ * @brief Reassembly of config messages that are split across multiple frames.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_CONFIG_PARSING_MESSAGE_FRAGMENTS_H
+#define CFG_CONFIG_PARSING_MESSAGE_FRAGMENTS_H
+
+#include "message-data.h"
+
+#include <utilities/bitwise.h>
+#include <utilities/checksum.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @namespace cfg
+ * 
+ * @brief Contains everything related to the processing of configuration files.
+ */
+namespace cfg {
+
+/**
+ * @enum fragment_status
+ * 
+ * @brief Outcome of adding a frame to a fragmented config message.
+ */
+enum class fragment_status : std::uint8_t {
+    pending,           /**< Indicates more fragments are awaited. */
+    complete,          /**< Indicates all fragments arrived and the checksum matches. */
+    invalid_fragment,  /**< Indicates the frame is not a valid fragment. */
+    checksum_mismatch, /**< Indicates the checksum did not match the fragments. */
+};
+
+/**
+ * @class message_fragments
+ * 
+ * @brief Reassembles a config message from the fragments that it is split into, without
+ * copying their contents.
+ * 
+ * @details A config message that does not fit in a single LoRaWAN payload is sent as a
+ * number of frames, each of which carries one fragment of the message. A frame starts
+ * with a one byte header, of which the upper nibble contains the sequence number of the
+ * fragment and the lower nibble contains the sequence number of the last fragment. The
+ * rest of the frame is the payload of the fragment. The last fragment ends with the
+ * CRC-32 checksum of the payloads of all the fragments, excluding the checksum itself,
+ * in little endian byte order.
+ * 
+ * Fragments may arrive in any order, and a fragment that arrives again replaces the
+ * earlier one. The frames are referred to rather than copied, so they are required to
+ * outlive the reassembly. Once all the fragments have arrived, the checksum is verified.
+ * Only then is the message complete, and can it be passed to a @ref message_parser,
+ * which decodes the bitspans directly across the fragment boundaries.
+ * 
+ * @tparam MaxFragments Maximum number of fragments a config message can be split into.
+ */
+template<std::size_t MaxFragments = 4,
+    typename = std::enable_if_t<(MaxFragments > 0 and MaxFragments <= 16)>>
+class message_fragments {
+public:
+    /**
+     * @var max_fragments
+     * 
+     * @brief Maximum number of fragments a config message can be split into.
+     */
+    static constexpr auto max_fragments = std::size_t{MaxFragments};
+
+    /**
+     * @var header_size
+     * 
+     * @brief Size of the header that precedes the payload of each fragment, in bytes.
+     */
+    static constexpr auto header_size = std::size_t{1};
+
+    /**
+     * @var checksum_size
+     * 
+     * @brief Size of the checksum at the end of the last fragment, in bytes.
+     */
+    static constexpr auto checksum_size = std::size_t{4};
+
+    /**
+     * @var max_payload_size
+     * 
+     * @brief Maximum size of the payload of a fragment, in bytes, so that its frame and
+     * its stored size both fit in a single byte.
+     */
+    static constexpr auto max_payload_size = std::size_t{UINT8_MAX} - header_size;
+
+    /**
+     * @brief Default constructs an empty reassembly.
+     */
+    constexpr message_fragments() = default;
+
+    /**
+     * @brief Adds a frame to the reassembly.
+     * 
+     * @details If the reassembly was already complete, or if the frame belongs to a
+     * message that is split into a different number of fragments, the reassembly is
+     * started over with the given frame. If the checksum of a message does not match
+     * once all its fragments have arrived, the reassembly is started over as well. A
+     * frame with a payload larger than #max_payload_size is not a valid fragment.
+     * 
+     * @param[in] frame Frame that carries a fragment of a config message.
+     * 
+     * @return Status of the reassembly after adding the frame.
+     */
+    constexpr auto add_fragment(message_data frame) -> fragment_status {
+        if (frame.data() == nullptr or frame.size() <= header_size)
+            return fragment_status::invalid_fragment;
+        if (frame.size() - header_size > max_payload_size)
+            return fragment_status::invalid_fragment;
+
+        auto const header = std::to_integer<unsigned>(frame.data()[0]);
+        auto const sequence = header >> 4u;
+        auto const count = (header & 0x0Fu) + 1u;
+        if (count > max_fragments or sequence >= count)
+            return fragment_status::invalid_fragment;
+
+        if (complete or (received != 0 and count != fragment_count)) reset();
+        fragment_count = static_cast<std::uint8_t>(count);
+        payloads[sequence] = frame.data() + header_size;
+        payload_sizes[sequence] = static_cast<std::uint8_t>(frame.size() - header_size);
+        received |= static_cast<std::uint16_t>(1u << sequence);
+
+        if (received != (1u << count) - 1u) return fragment_status::pending;
+        if (not checksum_matches()) {
+            reset();
+            return fragment_status::checksum_mismatch;
+        }
+        complete = true;
+        return fragment_status::complete;
+    }
+
+    /**
+     * @brief Discards all of the fragments that have been added.
+     */
+    constexpr auto reset() -> void
+    { *this = {}; }
+
+    /**
+     * @brief Checks if all the fragments have arrived and the checksum matches.
+     */
+    [[nodiscard]]
+    constexpr auto is_complete() const -> bool
+    { return complete; }
+
+    /**
+     * @brief Gets the size of the reassembled message, excluding the checksum.
+     * 
+     * @return Total size of the payloads, or zero if the message is not complete.
+     */
+    [[nodiscard]]
+    constexpr auto size() const -> std::size_t {
+        if (not complete) return 0;
+
+        auto total = std::size_t{};
+        for (auto idx = std::size_t{}; idx < fragment_count; ++idx) {
+            total += payload_sizes[idx];
+        }
+        return total - checksum_size;
+    }
+
+    /**
+     * @brief Extracts a span of bits from the reassembled message.
+     * 
+     * @details A span that lies within a single fragment is extracted from that fragment
+     * directly. Only a span that crosses a fragment boundary has its few bytes gathered
+     * from both fragments first.
+     * 
+     * @warning Ensure the message is complete and that the span lies within its size.
+     * 
+     * @param[in] bits Span of bits to extract.
+     * 
+     * @return Unsigned integral value of at least 64-bits that contains the span of bits.
+     */
+    [[nodiscard]]
+    constexpr auto extract_bits(bitspan bits) const -> std::uint_fast64_t {
+        auto const pos = unsigned{bits.pos()} % 8u;
+        auto const size = unsigned{bits.size()};
+        auto const count = (pos + size + 7u) / 8u;
+
+        auto fragment = std::size_t{};
+        auto offset = std::size_t{bits.pos()} / 8u;
+        while (offset >= payload_sizes[fragment]) {
+            offset -= payload_sizes[fragment++];
+        }
+        if (offset + count <= payload_sizes[fragment]) {
+            return cfg::extract_bits(payloads[fragment] + offset, pos, size);
+        }
+
+        auto bytes = std::array<std::byte, (bitspan::max_size + 7u) / 8u + 1u>{};
+        for (auto idx = 0u; idx < count; ++idx, ++offset) {
+            if (offset == payload_sizes[fragment]) {
+                ++fragment;
+                offset = 0;
+            }
+            bytes[idx] = payloads[fragment][offset];
+        }
+        return cfg::extract_bits(bytes.data(), pos, size);
+    }
+
+private:
+    /**
+     * @brief Checks if the checksum at the end of the last fragment matches the
+     * payloads of all the fragments.
+     */
+    [[nodiscard]]
+    constexpr auto checksum_matches() const -> bool {
+        auto const last = std::size_t{fragment_count} - 1u;
+        if (payload_sizes[last] < checksum_size) return false;
+
+        auto crc = std::uint32_t{};
+        for (auto idx = std::size_t{}; idx < last; ++idx) {
+            crc = crc32(payloads[idx], payload_sizes[idx], crc);
+        }
+        auto const data_size = payload_sizes[last] - checksum_size;
+        crc = crc32(payloads[last], data_size, crc);
+        return crc == detail::read_le<std::uint32_t>(payloads[last] + data_size);
+    }
+
+    std::array<std::byte const*, MaxFragments> payloads{}; /**< Payloads per fragment. */
+    std::array<std::uint8_t, MaxFragments> payload_sizes{}; /**< Sizes of the payloads. */
+    std::uint16_t received{};                              /**< Mask of the fragments. */
+    std::uint8_t fragment_count{};                         /**< Number of fragments. */
+    bool complete{};                                       /**< Checksum has matched. */
+};
+
+/**
+ * @struct fragment_layout
+ * 
+ * @brief Describes how a config message is split into frames.
+ * 
+ * @details Every frame is the same size, except for the last one, which may be smaller.
+ */
+struct fragment_layout {
+    std::size_t message_size; /**< Size of the config message, in bytes. */
+    std::size_t frame_size;   /**< Size of each frame, including its header. */
+    std::size_t frame_count;  /**< Number of frames, or zero if it cannot be split. */
+
+    /**
+     * @brief Gets the size of all the frames together, in number of bytes.
+     */
+    [[nodiscard]]
+    constexpr auto size() const -> std::size_t {
+        if (frame_count == 0) return 0;
+        return message_size + message_fragments<>::checksum_size
+            + frame_count * message_fragments<>::header_size;
+    }
+};
+
+/**
+ * @brief Computes how a config message is split into the least number of frames.
+ * 
+ * @details The payloads are spread evenly across the frames, so that the checksum at
+ * the end of the last frame always fits in its payload. A frame is never larger than a
+ * @ref message_data object can refer to, regardless of the maximum frame size.
+ * 
+ * @tparam MaxFragments Maximum number of fragments of the reassembly on the device.
+ * 
+ * @param[in] message_size Size of the config message, in bytes.
+ * @param[in] max_frame_size Maximum size of a single frame, such as the maximum payload
+ * size of a LoRaWAN downlink at the current data rate.
+ * 
+ * @return Layout of the frames, with a frame count of zero if the message does not fit
+ * in the maximum number of fragments.
+ */
+template<std::size_t MaxFragments = 4,
+    typename = std::enable_if_t<(MaxFragments > 0 and MaxFragments <= 16)>>
+[[nodiscard]]
+constexpr auto make_fragment_layout(std::size_t message_size, std::size_t max_frame_size)
+-> fragment_layout {
+    using fragments_t = message_fragments<MaxFragments>;
+    auto layout = fragment_layout{message_size, 0, 0};
+    if (max_frame_size <= fragments_t::header_size) return layout;
+
+    auto const total = message_size + fragments_t::checksum_size;
+    auto const capacity = std::min(
+        max_frame_size - fragments_t::header_size, fragments_t::max_payload_size);
+    auto const count = (total + capacity - 1) / capacity;
+    if (count == 0 or count > fragments_t::max_fragments) return layout;
+
+    auto const payload_size = (total + count - 1) / count;
+    if (total - payload_size * (count - 1) < fragments_t::checksum_size) return layout;
+
+    layout.frame_size = payload_size + fragments_t::header_size;
+    layout.frame_count = count;
+    return layout;
+}
+
+/**
+ * @brief Splits a config message into frames that are reassembled by a @ref
+ * message_fragments object.
+ * 
+ * @details The frames are written back to back. The CRC-32 checksum of the config
+ * message is appended to the payload of the last frame.
+ * 
+ * @param[in] message Config message to split.
+ * @param[in] layout Layout of the frames, as made by @ref make_fragment_layout for the
+ * size of the config message.
+ * @param[out] buffer Pointer to the first byte of the buffer to write the frames to.
+ * @param[in] buffer_size Capacity of the buffer.
+ * 
+ * @return Size of all the written frames together. If the layout does not match the
+ * config message or if the buffer is too small, a value of zero is returned.
+ */
+constexpr auto write_message_fragments(
+    message_data message,
+    fragment_layout layout,
+    std::byte* buffer,
+    std::size_t buffer_size
+) -> std::size_t {
+    using fragments_t = message_fragments<>;
+    if (message.data() == nullptr or buffer == nullptr) return 0;
+    if (layout.frame_count == 0 or layout.message_size != message.size()) return 0;
+    if (buffer_size < layout.size()) return 0;
+
+    auto checksum = std::array<std::byte, fragments_t::checksum_size>{};
+    detail::write_le(checksum.data(), crc32(message.data(), message.size()));
+
+    auto const payload_size = layout.frame_size - fragments_t::header_size;
+    auto const last = layout.frame_count - 1;
+    auto offset = std::size_t{};
+    auto pos = std::size_t{};
+    for (auto frame = std::size_t{}; frame < layout.frame_count; ++frame) {
+        buffer[pos++] = static_cast<std::byte>(frame << 4u | last);
+        for (auto idx = std::size_t{}; idx < payload_size; ++idx, ++offset) {
+            if (offset < message.size()) {
+                buffer[pos++] = message.data()[offset];
+            } else if (offset < message.size() + checksum.size()) {
+                buffer[pos++] = checksum[offset - message.size()];
+            }
+        }
+    }
+    return pos;
+}
+
+} // namespace cfg
+
+#endif
@@ -18,7 +18,11 @@
 #define CFG_CONFIG_PARSING_MESSAGE_PARSER_H
 
 #include "config-parser.h"
+#include "message-data.h"
+#include "message-decoder.h"
+#include "message-fragments.h"
 
+#include <checking/validation-mode.h>
 #include <errors/error-handler.h>
 #include <errors/error-types.h>
 #include <traits/class-traits.h>
@@ -37,65 +41,6 @@
  */
 namespace cfg {
 
-/**
- * @class message_data
- * 
- * @brief Data-type used for handling config messages, consisting of a pointer to a range
- * of bytes and a size.
- */
-class message_data {
-public:
-    /**
-     * @brief Default constructs a message-data object.
-     */
-    constexpr message_data() = default;
-
-    /**
-     * @brief Constructs a message-data object with a given data pointer and size.
-     */
-    constexpr message_data(std::byte* data, std::uint_least8_t size)
-        : data_{data}, size_{size} {}
-
-    /**
-     * @brief Gets the data pointer.
-     */
-    [[nodiscard]]
-    constexpr auto data() const -> std::byte const*
-    { return data_; }
-
-    /**
-     * @brief Gets the size of message data.
-     */
-    [[nodiscard]]
-    constexpr auto size() const -> std::uint_least8_t
-    { return size_; }
-
-    /**
-     * @brief Compares two message-data objects for (in)equality.
-     * 
-     * @param[in] lhs Message-data object on the left-hand side of the operator.
-     * @param[in] rhs Message-data object on the right-hand side of the operator.
-     * 
-     * @return Two message-data objects are considered to be equal when their data
-     * pointer and size matches.
-     * @{
-     */
-    [[nodiscard]]
-    friend constexpr auto operator!=(
-        message_data const& lhs, message_data const& rhs) -> bool
-    { return not (lhs == rhs); }
-
-    [[nodiscard]]
-    friend constexpr auto operator==(
-        message_data const& lhs, message_data const& rhs) -> bool
-    { return lhs.data_ == rhs.data_ and lhs.size_ == rhs.size_; }
-    /** @} */
-
-private:
-    std::byte* data_{};         /**< Pointer to the data of the message. */
-    std::uint_least8_t size_{}; /**< Size of of the message data. */
-};
-
 /**
  * @class message_parser
  * 
@@ -124,6 +69,8 @@ class message_parser : public config_parser<message_parser<SettingIter, MaxSetti
     friend constexpr auto base_type::parse_config(Config const&) -> void;
     friend auto base_type::report_parsing_errors() const -> void;
     friend constexpr auto base_type::has_parsing_errors() const -> bool;
+    friend constexpr auto base_type::export_parsing_errors(
+        std::byte*, std::size_t) const -> std::size_t;
     /** @} */
 
 public:
@@ -134,6 +81,13 @@ public:
      */
     static constexpr auto max_settings = int{MaxSettings};
 
+    /**
+     * @var validation
+     * 
+     * @brief Indicates how the values that a message parser sets should be validated.
+     */
+    static constexpr auto validation = validation_mode::config_message;
+
     /**
      * @brief Default constructs a message parser.
      */
@@ -172,8 +126,23 @@ public:
         auto const distance = settings.distance();
         if (distance <= 0 or distance > MaxSettings) return;
         settings_ = settings;
+        decoder = nullptr;
     }
 
+    /**
+     * @brief Sets the decoder that is generated from the range of settings.
+     * 
+     * @details With a decoder, a config message is decoded with a straight-line sequence
+     * of field extractions that is generated in compile time. Without a decoder, the
+     * bitspans of all the settings are extracted in a loop.
+     * 
+     * @tparam GetSettings Function that returns the settings the decoder is generated
+     * from, which should match the range of settings this parser operates on.
+     */
+    template<auto GetSettings>
+    constexpr auto set_decoder(message_decoder<GetSettings>) -> void
+    { decoder = &message_decoder<GetSettings>::template decode<SettingIter>; }
+
 private:
     /**
      * @brief Parses a config message.
@@ -183,15 +152,54 @@ private:
      * config message and written to their internal value buffer. If the bitspan of a
      * setting has a size of zero, it is simply ignored and its value remains unaltered.
      * 
+     * If a decoder is set and it matches the range of settings, the decoder is used to
+     * extract the spans of bits instead.
+     * 
      * @param[in] config Config message to validate.
      */
     constexpr auto parse_config_impl(message_data config) -> void {
         validate_config_message(config);
         if (err_handler.contains_errors()) return;
+        if (decoder != nullptr and decoder(config.data(), settings_)) return;
+
+        for (auto&& setting_obj : settings_) {
+            if (auto const bits = setting_obj.config_bits(); bits.size() != 0) {
+                setting_obj.set_value(
+                    extract_bits(config.data(), bits), (bits.size() + 7u) / 8u);
+            }
+        }
+    }
+
+    /**
+     * @brief Parses a config message that has been reassembled from fragments.
+     * 
+     * @details Works similarly to the other overload, except that the span of bits of
+     * each setting is extracted across the fragments with @ref
+     * message_fragments::extract_bits. The decoder is not used, since it requires the
+     * config message to be contiguous. A message of which not all fragments have arrived,
+     * or of which the checksum did not match, is not parsed at all.
+     * 
+     * @tparam MaxFragments Maximum number of fragments of the config message.
+     * 
+     * @param[in] config Reassembled config message to parse.
+     */
+    template<std::size_t MaxFragments>
+    constexpr auto parse_config_impl(message_fragments<MaxFragments> const& config)
+    -> void {
+        if (not config.is_complete()) {
+            err_handler.add_error(parsing_error::incomplete_message);
+            return;
+        }
+        if (config.size() < bitspan::byte_boundary) {
+            err_handler.add_error(
+                parsing_error::insufficient_message_size, config.size());
+            return;
+        }
 
-        for (auto& setting_obj : settings_) {
+        for (auto&& setting_obj : settings_) {
             if (auto const bits = setting_obj.config_bits(); bits.size() != 0) {
-                setting_obj.set_value(extract_bits(config.data(), bits));
+                setting_obj.set_value(
+                    config.extract_bits(bits), (bits.size() + 7u) / 8u);
             }
         }
     }
@@ -236,8 +244,22 @@ private:
             "[ERROR]Some errors occurred while parsing the config message:\n");
     }
 
-    error_handler<2> err_handler; /**< Handles potential parsing-errors. */
-    range<SettingIter> settings_; /**< Range of settings to operate on. */
+    /**
+     * @brief Exports the errors that occurred during the parsing of a config message
+     * as a binary error record.
+     * 
+     * @param[out] buffer Buffer to write the error record to.
+     * @param[in] buffer_size Capacity of the buffer, in number of bytes.
+     * 
+     * @return Number of bytes written.
+     */
+    constexpr auto export_parsing_errors_impl(
+        std::byte* buffer, std::size_t buffer_size) const -> std::size_t
+    { return err_handler.export_errors(error_source::parsing, buffer, buffer_size); }
+
+    error_handler<2> err_handler;             /**< Handles potential parsing-errors. */
+    range<SettingIter> settings_;             /**< Range of settings to operate on. */
+    message_decode_fn<SettingIter> decoder{}; /**< Generated decoder of the settings. */
 };
 
 /**
@@ -250,6 +272,49 @@ template<typename Settings,
 message_parser(Settings&)
     -> message_parser<iterator_type<Settings>, std::tuple_size<Settings>{}>;
 
+/**
+ * @brief Writes the values of a range of settings to a config message.
+ * 
+ * @details The value of each setting with a bitspan is written to the span of bits that
+ * a @ref message_parser extracts it from. The values are expected in that same binary
+ * form. Since a config message replaces every setting with a bitspan, all of them are
+ * required to be set. The bits that no setting refers to are zero.
+ * 
+ * @tparam Settings Container type that stores its contents in a contiguous sequence.
+ * 
+ * @param[in] settings Container with the settings to write.
+ * @param[out] buffer Pointer to the first byte of the buffer to write the message to.
+ * @param[in] buffer_size Capacity of the buffer.
+ * 
+ * @return Size of the written config message. If the buffer is too small, if a setting
+ * with a bitspan is not set, or if a value does not fit within its bitspan, a value of
+ * zero is returned.
+ */
+template<typename Settings,
+    typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
+constexpr auto write_config_message(
+    Settings const& settings,
+    std::byte* buffer,
+    std::size_t buffer_size
+) -> std::size_t {
+    if (buffer == nullptr or buffer_size < bitspan::byte_boundary) return 0;
+
+    for (auto idx = std::size_t{}; idx < bitspan::byte_boundary; ++idx) {
+        buffer[idx] = std::byte{};
+    }
+    for (auto const& setting_obj : settings) {
+        auto const bits = setting_obj.config_bits();
+        auto const size = unsigned{bits.size()};
+        if (size == 0) continue;
+        if (not setting_obj.is_set()) return 0;
+
+        auto const value = convert_bits<std::uint64_t>(setting_obj.view_value());
+        if (size < 64u and (value >> size) != 0) return 0;
+        insert_bits(buffer, bits.pos(), size, value);
+    }
+    return bitspan::byte_boundary;
+}
+
 } // namespace cfg
 
 #endif
@@ -0,0 +1,453 @@
+/**
+ * @file packed-parser.h
+ * @brief Parsing-mechanism for processing packed config messages.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_CONFIG_PARSING_PACKED_PARSER_H
+#define CFG_CONFIG_PARSING_PACKED_PARSER_H
+
+#include "config-parser.h"
+#include "message-data.h"
+
+#include <checking/validation-mode.h>
+#include <errors/error-handler.h>
+#include <errors/error-types.h>
+#include <traits/class-traits.h>
+#include <traits/iterator-traits.h>
+#include <utilities/bitwise.h>
+#include <utilities/enum.h>
+#include <utilities/range.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * @namespace cfg
+ * 
+ * @brief Contains everything related to the processing of configuration files.
+ */
+namespace cfg {
+
+/**
+ * @struct packed_format
+ * 
+ * @brief Describes the layout of a packed config message.
+ * 
+ * @details A packed message is a single stream of bits, starting at the most significant
+ * bit of the first byte. It starts with a presence mask that holds one bit for each
+ * setting with a bitspan, in the order of the settings. The fields of the settings that
+ * are present follow, in the same order.
+ * 
+ * A setting with a bitspan of at most #raw_field_size bits has its field stored as is,
+ * with as many bits as the size of its bitspan. Any wider setting, such as an interval
+ * or a threshold, has its value stored as a mantissa and a decimal exponent: first the
+ * exponent in #exponent_size bits, then the mantissa in groups of #group_size bits, least
+ * significant group first. Each group is preceded by a bit that indicates whether
+ * another group follows. As such, an interval of 30000 only takes twelve bits instead of
+ * thirty-two.
+ */
+struct packed_format {
+    /**
+     * @var raw_field_size
+     * 
+     * @brief Largest size of a bitspan whose field is stored as is, in number of bits.
+     */
+    static constexpr auto raw_field_size = 8u;
+
+    /**
+     * @var exponent_size
+     * 
+     * @brief Size of the decimal exponent of a scaled field, in number of bits.
+     */
+    static constexpr auto exponent_size = 2u;
+
+    /**
+     * @var group_size
+     * 
+     * @brief Number of mantissa bits in a group of a scaled field.
+     */
+    static constexpr auto group_size = 4u;
+
+    /**
+     * @var scales
+     * 
+     * @brief Multipliers of the mantissa, indexed by the decimal exponent.
+     */
+    static constexpr auto scales = std::array<std::uint_fast64_t, 4>{1, 10, 100, 1000};
+};
+
+/**
+ * @namespace detail
+ * 
+ * @brief Provides helper/meta functions/types local to this header file.
+ */
+namespace detail {
+
+/**
+ * @brief Counts the settings that have a bitspan, which is the size of the presence
+ * mask of a packed message in number of bits.
+ * 
+ * @tparam Settings Type of the range of settings.
+ * 
+ * @param[in] settings Range of settings to count.
+ */
+template<typename Settings>
+[[nodiscard]]
+constexpr auto count_packed_settings(Settings const& settings) -> unsigned {
+    auto count = 0u;
+    for (auto const& setting_obj : settings) {
+        if (setting_obj.config_bits().size() != 0) ++count;
+    }
+    return count;
+}
+
+} // namespace detail
+
+/**
+ * @class packed_parser
+ * 
+ * @brief Parses packed config messages, which take the least number of bits to change
+ * any number of settings.
+ * 
+ * @details For more details about the layout of a packed message, refer to @ref
+ * packed_format. Just like a delta message, the settings that are not present in a
+ * packed message are left unset. A full reconfiguration simply has all of the settings
+ * present. Packed messages can be created with the @ref write_packed_message function,
+ * from the same range of settings.
+ * 
+ * @tparam SettingIter Iterator type of the settings container.
+ * @tparam MaxSettings Maximum number of settings to operate on.
+ */
+template<typename SettingIter, int MaxSettings,
+    typename = std::enable_if_t<is_random_access_iter_v<SettingIter>>,
+    typename = std::enable_if_t<(MaxSettings > 0)>>
+class packed_parser : public config_parser<packed_parser<SettingIter, MaxSettings>> {
+    /**
+     * @typedef base_type
+     * 
+     * @brief Shorter notation to refer to the type of the base class.
+     */
+    using base_type = config_parser<packed_parser<SettingIter, MaxSettings>>;
+
+    /**
+     * @{
+     * @brief Grants the public interface access to its implementation.
+     */
+    template<typename Config>
+    friend constexpr auto base_type::parse_config(Config const&) -> void;
+    friend auto base_type::report_parsing_errors() const -> void;
+    friend constexpr auto base_type::has_parsing_errors() const -> bool;
+    friend constexpr auto base_type::export_parsing_errors(
+        std::byte*, std::size_t) const -> std::size_t;
+    /** @} */
+
+public:
+    /**
+     * @var max_settings
+     * 
+     * @brief Maximum number of settings that a packed parser can operate on.
+     */
+    static constexpr auto max_settings = int{MaxSettings};
+
+    /**
+     * @var validation
+     * 
+     * @brief Indicates how the values that a packed parser sets should be validated.
+     */
+    static constexpr auto validation = validation_mode::config_delta;
+
+    /**
+     * @brief Default constructs a packed parser.
+     */
+    constexpr packed_parser() = default;
+
+    /**
+     * @brief Constructs a packed parser with a range of settings to operate on.
+     * 
+     * @tparam Settings Container type that stores its contents in a contiguous sequence.
+     * 
+     * @param[in,out] settings Container with settings which will have their values set
+     * based on the contents of the parsed packed message.
+     */
+    template<typename Settings,
+        typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
+    constexpr explicit packed_parser(Settings& settings)
+        : settings_{settings} {}
+
+    /**
+     * @brief Clears all of the parsing errors.
+     */
+    constexpr auto clear_parsing_errors() -> void
+    { err_handler.clear_errors(); }
+
+    /**
+     * @brief Sets the new range of settings to operate on.
+     * 
+     * @details If the distance of the new range of settings exceeds the MaxSettings
+     * value, the new range is ignored and no changes are made.
+     * 
+     * @param[in] settings New range of settings to operate on. This can also be a
+     * reference to a container type, due to the extensive constructors of the range
+     * class.
+     */
+    constexpr auto set_settings(range<SettingIter> settings) -> void {
+        auto const distance = settings.distance();
+        if (distance <= 0 or distance > MaxSettings) return;
+        settings_ = settings;
+    }
+
+private:
+    /**
+     * @brief Parses a packed message.
+     * 
+     * @details The values of all the settings are cleared first. Then, the field of each
+     * setting that is present is decoded and written to its value-buffer, in the same
+     * binary form as a @ref message_parser would write it. Parsing stops at the first
+     * field that is incomplete or that does not fit in the bitspan of its setting.
+     * 
+     * @param[in] packed Packed message to parse.
+     */
+    constexpr auto parse_config_impl(message_data packed) -> void {
+        err_handler.clear_errors();
+        for (auto&& setting_obj : settings_) {
+            setting_obj.set_value(std::string_view{});
+        }
+
+        auto const mask_size = detail::count_packed_settings(settings_);
+        validate_packed_message(packed, mask_size);
+        if (err_handler.contains_errors()) return;
+
+        auto mask_pos = 0u;
+        auto pos = mask_size;
+        for (auto&& setting_obj : settings_) {
+            auto const bits = setting_obj.config_bits();
+            if (bits.size() == 0) continue;
+            if (extract_bits(packed.data(), mask_pos++, 1u) == 0) continue;
+
+            auto const value = read_field(packed, pos, bits.size());
+            if (not value) {
+                err_handler.add_error(*value.error, to_underlying(setting_obj.id()));
+                return;
+            }
+            setting_obj.set_value(*value.data, (bits.size() + 7u) / 8u);
+        }
+    }
+
+    /**
+     * @struct field_result
+     * 
+     * @brief Outcome of reading the field of a setting.
+     */
+    struct field_result {
+        /**
+         * @brief Checks if the field has been read successfully.
+         */
+        [[nodiscard]]
+        constexpr explicit operator bool() const
+        { return not error.has_value(); }
+
+        std::optional<std::uint_fast64_t> data; /**< Value of the field. */
+        std::optional<parsing_error> error;     /**< Reason the field was not read. */
+    };
+
+    /**
+     * @brief Reads the field of a setting from a packed message.
+     * 
+     * @param[in] packed Packed message to read the field from.
+     * @param[in,out] pos Position of the field, which is advanced past the field.
+     * @param[in] size Size of the bitspan of the setting.
+     * 
+     * @return Value of the field, or the reason it could not be read.
+     */
+    static constexpr auto read_field(message_data packed, unsigned& pos, unsigned size)
+    -> field_result {
+        auto const message_bits = unsigned{packed.size()} * 8u;
+        auto const read = [&](unsigned count) {
+            auto const bits = extract_bits(packed.data(), pos, count);
+            pos += count;
+            return bits;
+        };
+        auto const truncated = field_result{
+            std::nullopt, parsing_error::truncated_packed_field};
+        auto const overflow = field_result{
+            std::nullopt, parsing_error::packed_field_overflow};
+
+        if (size <= packed_format::raw_field_size) {
+            if (message_bits - pos < size) return truncated;
+            return {read(size), std::nullopt};
+        }
+
+        if (message_bits - pos < packed_format::exponent_size) return truncated;
+        auto const scale = packed_format::scales[read(packed_format::exponent_size)];
+
+        auto mantissa = std::uint_fast64_t{};
+        for (auto shift = 0u; ; shift += packed_format::group_size) {
+            if (message_bits - pos < packed_format::group_size + 1u) return truncated;
+            auto const more = read(1u) != 0;
+            auto const group = read(packed_format::group_size);
+            if (shift >= size) return overflow;
+            mantissa |= group << shift;
+            if (not more) break;
+        }
+
+        auto const max_value = size < 64u
+            ? (std::uint_fast64_t{1} << size) - 1u
+            : ~std::uint_fast64_t{};
+        if (mantissa > max_value / scale) return overflow;
+        return {mantissa * scale, std::nullopt};
+    }
+
+    /**
+     * @brief Validates a packed message.
+     * 
+     * @details Checks if the data pointer of the packed message is valid and if it at
+     * least contains the presence mask.
+     * 
+     * @param[in] packed Packed message to validate.
+     * @param[in] mask_size Size of the presence mask in number of bits.
+     */
+    constexpr auto validate_packed_message(message_data packed, unsigned mask_size)
+    -> void {
+        if (packed.data() == nullptr) {
+            err_handler.add_error(parsing_error::invalid_message_pointer);
+        } else if (packed.size() < (mask_size + 7u) / 8u) {
+            err_handler.add_error(
+                parsing_error::insufficient_message_size, packed.size());
+        }
+    }
+
+    /**
+     * @brief Checks if any error has occurred during the parsing of a packed message.
+     */
+    [[nodiscard]]
+    constexpr auto has_parsing_errors_impl() const -> bool
+    { return err_handler.contains_errors(); }
+
+    /**
+     * @brief Reports any error that might have occurred during the parsing of a packed
+     * message.
+     * 
+     * @details If there are no parsing errors to report, the logging request is simply
+     * ignored.
+     */
+    auto report_parsing_errors_impl() const -> void {
+        err_handler.log_errors(
+            "[ERROR]Some errors occurred while parsing the packed message:\n");
+    }
+
+    /**
+     * @brief Exports the errors that occurred during the parsing of a packed message
+     * as a binary error record.
+     * 
+     * @param[out] buffer Buffer to write the error record to.
+     * @param[in] buffer_size Capacity of the buffer, in number of bytes.
+     * 
+     * @return Number of bytes written.
+     */
+    constexpr auto export_parsing_errors_impl(
+        std::byte* buffer, std::size_t buffer_size) const -> std::size_t
+    { return err_handler.export_errors(error_source::parsing, buffer, buffer_size); }
+
+    error_handler<2> err_handler; /**< Handles potential parsing-errors. */
+    range<SettingIter> settings_; /**< Range of settings to operate on. */
+};
+
+/**
+ * @remark Allows a packed parser to be constructed from a container type.
+ * 
+ * @tparam Settings Container type that stores its contents in a contiguous sequence.
+ */
+template<typename Settings,
+    typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
+packed_parser(Settings&)
+    -> packed_parser<iterator_type<Settings>, std::tuple_size<Settings>{}>;
+
+/**
+ * @brief Writes the values of a range of settings to a packed message.
+ * 
+ * @details Only the settings that are set are marked as present. Their values are
+ * expected in the binary form in which a @ref message_parser sets them, such as after
+ * parsing a full config message on a host. Each scaled field is written with the
+ * largest decimal exponent that divides its value, which keeps the mantissa short for
+ * the round values that intervals and thresholds typically have.
+ * 
+ * @tparam Settings Container type that stores its contents in a contiguous sequence.
+ * 
+ * @param[in] settings Container with the settings to write.
+ * @param[out] buffer Pointer to the first byte of the buffer to write the message to.
+ * @param[in] buffer_size Capacity of the buffer.
+ * 
+ * @return Size of the written packed message. If the buffer is too small, or if a value
+ * does not fit within the bitspan of its setting, a value of zero is returned.
+ */
+template<typename Settings,
+    typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
+constexpr auto write_packed_message(
+    Settings const& settings,
+    std::byte* buffer,
+    std::size_t buffer_size
+) -> std::size_t {
+    auto const mask_size = detail::count_packed_settings(settings);
+    auto const buffer_bits = buffer_size * 8u;
+    if (buffer == nullptr or buffer_bits < mask_size) return 0;
+
+    auto mask_pos = 0u;
+    auto pos = mask_size;
+    auto const write = [&](unsigned count, std::uint_fast64_t bits) {
+        if (buffer_bits - pos < count) return false;
+        insert_bits(buffer, pos, count, bits);
+        pos += count;
+        return true;
+    };
+
+    for (auto const& setting_obj : settings) {
+        auto const size = unsigned{setting_obj.config_bits().size()};
+        if (size == 0) continue;
+
+        auto const present = setting_obj.is_set();
+        insert_bits(buffer, mask_pos++, 1u, present);
+        if (not present) continue;
+
+        auto const value = convert_bits<std::uint64_t>(setting_obj.view_value());
+        if (size < 64u and (value >> size) != 0) return 0;
+        if (size <= packed_format::raw_field_size) {
+            if (not write(size, value)) return 0;
+            continue;
+        }
+
+        auto exponent = packed_format::scales.size() - 1u;
+        while (exponent > 0 and value % packed_format::scales[exponent] != 0) {
+            --exponent;
+        }
+        auto mantissa = value / packed_format::scales[exponent];
+        if (not write(packed_format::exponent_size, exponent)) return 0;
+        do {
+            auto const group = mantissa & ((1u << packed_format::group_size) - 1u);
+            mantissa >>= packed_format::group_size;
+            if (not write(1u, mantissa != 0)) return 0;
+            if (not write(packed_format::group_size, group)) return 0;
+        } while (mantissa != 0);
+    }
+
+    if (pos % 8u != 0) insert_bits(buffer, pos, 8u - pos % 8u, 0u);
+    return (pos + 7u) / 8u;
+}
+
+} // namespace cfg
+
+#endif
@@ -0,0 +1,286 @@
+/**
+ * @file tag-pool.h
+ * @brief Pool of interned tag-names that are referred to by a small identifier.
+ * 
+ * @version 1.0
+ * @date December 2021
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_CONFIG_PARSING_TAG_POOL_H
+#define CFG_CONFIG_PARSING_TAG_POOL_H
+
+#include "tag-table.h"
+
+#include <traits/class-traits.h>
+#include <utilities/container.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @namespace cfg
+ * 
+ * @brief Contains everything related to the processing of configuration files.
+ */
+namespace cfg {
+
+/**
+ * @typedef tag_id
+ * 
+ * @brief Identifier of a tag-name that is interned within a @ref tag_pool.
+ */
+using tag_id = std::uint8_t;
+
+/**
+ * @var empty_tag_id
+ * 
+ * @brief Identifier of a tag-name that is not set (i.e.: a null pointer).
+ */
+inline constexpr auto empty_tag_id = tag_id{0};
+
+/**
+ * @var unknown_tag_id
+ * 
+ * @brief Identifier of a tag-name that is not interned, which matches no other tag.
+ */
+inline constexpr auto unknown_tag_id = tag_id{UINT8_MAX};
+
+/**
+ * @class tag_pool
+ * 
+ * @brief Stores each unique tag-name of a container of settings once.
+ * 
+ * @details Settings that share tag-names, such as the common beginning of their paths,
+ * refer to the same interned tag-name by its identifier instead of storing a copy of it.
+ * Once a parsed tag-name is resolved to its identifier, it can be matched against the
+ * tag-names of many settings by comparing integers.
+ * 
+ * A tag-pool is intended to be constructed in compile time from a constexpr container
+ * of settings, allowing it to be stored in read-only memory. Use the @ref
+ * count_unique_tags function to determine its exact capacity.
+ * 
+ * @tparam MaxTags Maximum number of unique tag-names the pool can store.
+ */
+template<int MaxTags,
+    typename = std::enable_if_t<(MaxTags > 0 and MaxTags < unknown_tag_id)>>
+class tag_pool {
+public:
+    /**
+     * @var max_tags
+     * 
+     * @brief Maximum number of unique tag-names the pool can store.
+     */
+    static constexpr auto max_tags = int{MaxTags};
+
+    /**
+     * @brief Default-constructs an empty tag-pool.
+     */
+    constexpr tag_pool() = default;
+
+    /**
+     * @brief Constructs a tag-pool from the paths of tag-names of a given container of
+     * settings.
+     * 
+     * @details Tag-names that would exceed the capacity of the pool are discarded.
+     * 
+     * @tparam Settings Container type that stores its contents in a contiguous sequence.
+     * 
+     * @param[in] settings Container with settings to obtain the tag-names from.
+     */
+    template<typename Settings,
+        typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
+    constexpr explicit tag_pool(Settings const& settings) {
+        auto const max_depth = int{Settings::value_type::max_tag_depth};
+        for (auto idx = std::size_t{}; idx < std::size(settings); ++idx) {
+            for (auto depth = 0; depth < max_depth; ++depth) {
+                if (settings[idx].is_tag_empty(depth)) break;
+                insert(settings[idx].tag(depth));
+            }
+        }
+    }
+
+    /**
+     * @brief Finds the identifier of a tag-name.
+     * 
+     * @param[in] tag Tag-name to find.
+     * 
+     * @return Identifier of the interned tag-name, @ref empty_tag_id if the tag-name is
+     * not set or @ref unknown_tag_id if the tag-name is not interned.
+     */
+    [[nodiscard]]
+    constexpr auto find(char const* tag) const -> tag_id {
+        for (auto id = 0; id < count; ++id) {
+            if (detail::tags_match(names[id], tag)) return static_cast<tag_id>(id);
+        }
+        return unknown_tag_id;
+    }
+
+    /**
+     * @brief Gets the tag-name that belongs to an identifier.
+     * 
+     * @param[in] id Identifier of an interned tag-name.
+     * 
+     * @return Interned tag-name, or a null pointer if the identifier is unknown.
+     */
+    [[nodiscard]]
+    constexpr auto name(tag_id id) const -> char const*
+    { return id < count ? names[id] : nullptr; }
+
+    /**
+     * @brief Gets the number of interned tag-names, excluding the empty tag-name.
+     */
+    [[nodiscard]]
+    constexpr auto size() const -> int
+    { return count - 1; }
+
+private:
+    /**
+     * @brief Interns a tag-name, unless it is interned already.
+     * 
+     * @param[in] tag Tag-name to intern.
+     */
+    constexpr auto insert(char const* tag) -> void {
+        if (find(tag) != unknown_tag_id or count > MaxTags) return;
+        names[count++] = tag;
+    }
+
+    array<char const*, MaxTags + 1> names{}; /**< Tag-names, starting at empty tag. */
+    std::int16_t count{1};                   /**< Number of tag-names including empty. */
+};
+
+/**
+ * @brief Counts the number of unique tag-names within the paths of tag-names of a given
+ * container of settings.
+ * 
+ * @details This function is intended to be used for determining the exact capacity of a
+ * @ref tag_pool in compile time.
+ * 
+ * @tparam Settings Container type that stores its contents in a contiguous sequence.
+ * 
+ * @param[in] settings Container with settings to obtain the tag-names from.
+ * 
+ * @return Number of unique tag-names, excluding the empty tag-name.
+ */
+template<typename Settings,
+    typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
+[[nodiscard]]
+constexpr auto count_unique_tags(Settings const& settings) -> int {
+    auto const max_depth = int{Settings::value_type::max_tag_depth};
+    auto const is_first = [&](std::size_t index, int level) {
+        auto const tag = settings[index].tag(level);
+        for (auto idx = std::size_t{}; idx <= index; ++idx) {
+            for (auto depth = 0; depth < max_depth; ++depth) {
+                if (idx == index and depth == level) return true;
+                if (settings[idx].is_tag_empty(depth)) break;
+                if (detail::tags_match(settings[idx].tag(depth), tag)) return false;
+            }
+        }
+        return true;
+    };
+    auto count = 0;
+    for (auto idx = std::size_t{}; idx < std::size(settings); ++idx) {
+        for (auto depth = 0; depth < max_depth; ++depth) {
+            if (settings[idx].is_tag_empty(depth)) break;
+            if (is_first(idx, depth)) ++count;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Gets the length of the longest tag-name within the paths of tag-names of a given
+ * container of settings.
+ * 
+ * @details This function is intended to be used for sizing the buffers that parsed
+ * tag-names are stored in, in compile time.
+ * 
+ * @tparam Settings Container type that stores its contents in a contiguous sequence.
+ * 
+ * @param[in] settings Container with settings to obtain the tag-names from.
+ * 
+ * @return Number of characters of the longest tag-name, excluding the null-character.
+ */
+template<typename Settings,
+    typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
+[[nodiscard]]
+constexpr auto max_tag_length(Settings const& settings) -> std::size_t {
+    auto const max_depth = int{Settings::value_type::max_tag_depth};
+    auto length = std::size_t{};
+    for (auto idx = std::size_t{}; idx < std::size(settings); ++idx) {
+        for (auto depth = 0; depth < max_depth; ++depth) {
+            if (settings[idx].is_tag_empty(depth)) break;
+            auto const tag_length = std::string_view{settings[idx].tag(depth)}.size();
+            if (tag_length > length) length = tag_length;
+        }
+    }
+    return length;
+}
+
+/**
+ * @remark Checks if a setting type refers to its tag-names by interned identifiers.
+ * 
+ * @tparam T Type of the setting to check.
+ * 
+ * @{
+ */
+template<typename T, typename = void>
+struct has_interned_tags : std::false_type {};
+
+template<typename T>
+struct has_interned_tags<T, std::void_t<
+    decltype(T::find_tag(std::declval<char const*>())),
+    decltype(std::declval<T const&>().interned_tag(0))>> : std::true_type {};
+/** @} */
+
+/**
+ * @var has_interned_tags_v
+ * 
+ * @brief Helper variable template for the @ref has_interned_tags type trait.
+ * 
+ * @tparam T Type of the setting to check.
+ */
+template<typename T>
+inline constexpr auto has_interned_tags_v
+    = bool{has_interned_tags<T>{}};
+
+/**
+ * @remark Checks if a setting type provides the length of the longest tag-name of all
+ * the settings that it belongs with.
+ * 
+ * @tparam T Type of the setting to check.
+ * 
+ * @{
+ */
+template<typename T, typename = void>
+struct has_max_tag_length : std::false_type {};
+
+template<typename T>
+struct has_max_tag_length<T, std::void_t<decltype(T::max_tag_length)>>
+    : std::true_type {};
+/** @} */
+
+/**
+ * @var has_max_tag_length_v
+ * 
+ * @brief Helper variable template for the @ref has_max_tag_length type trait.
+ * 
+ * @tparam T Type of the setting to check.
+ */
+template<typename T>
+inline constexpr auto has_max_tag_length_v
+    = bool{has_max_tag_length<T>{}};
+
+} // namespace cfg
+
+#endif
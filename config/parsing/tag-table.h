@@ -0,0 +1,370 @@
+/**
+ * @file tag-table.h
+ * @brief Lookup-table for resolving tag-names to the settings they belong to.
+ * 
+ * @version 1.0
+ * @date December 2021
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_CONFIG_PARSING_TAG_TABLE_H
+#define CFG_CONFIG_PARSING_TAG_TABLE_H
+
+#include <strings/string-hashing.h>
+#include <traits/class-traits.h>
+#include <utilities/bitwise.h>
+#include <utilities/container.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * @namespace cfg
+ * 
+ * @brief Contains everything related to the processing of configuration files.
+ */
+namespace cfg {
+
+/**
+ * @struct tag_node
+ * 
+ * @brief Represents a single tag-name within the tree of tag-paths of all the settings.
+ * 
+ * @details Settings that share the beginning of their path of tag-names also share the
+ * nodes that make up this part of the path. A node is identified by its tag-name in
+ * combination with its parent node.
+ */
+struct tag_node {
+    char const* tag{};          /**< Tag-name of the node. */
+    std::uint32_t hash{};       /**< Hash of the tag-name and the parent node. */
+    std::int16_t parent{-1};    /**< Index of the parent node. */
+    std::int16_t setting{-1};   /**< Index of the setting that ends at this node. */
+};
+
+/**
+ * @namespace detail
+ * 
+ * @brief Provides helper/meta functions/types local to this header file.
+ */
+namespace detail {
+
+/**
+ * @brief Computes the hash value of a tag-name that belongs to a given parent node.
+ * 
+ * @param[in] parent Index of the parent node.
+ * @param[in] tag Tag-name of the node.
+ * 
+ * @return Unsigned 32-bit hash value.
+ */
+[[nodiscard]]
+constexpr auto hash_tag(int parent, std::string_view tag) -> std::uint32_t {
+    auto const seed = hash_string({}) ^ (static_cast<std::uint32_t>(parent) * 0x9E37'79B1u);
+    return hash_string(tag, seed);
+}
+
+/**
+ * @brief Checks if two tag-names match.
+ * 
+ * @details Tag-names that are not set (i.e.: null pointers) only match each other.
+ * 
+ * @param[in] lhs Tag-name on the left-hand side.
+ * @param[in] rhs Tag-name on the right-hand side.
+ */
+[[nodiscard]]
+constexpr auto tags_match(char const* lhs, char const* rhs) -> bool {
+    if (lhs == nullptr or rhs == nullptr) return lhs == rhs;
+    return std::string_view{lhs} == std::string_view{rhs};
+}
+
+} // namespace detail
+
+/**
+ * @class tag_lookup
+ * 
+ * @brief Provides a view to the contents of a @ref tag_table and resolves tag-names to
+ * the index of their node.
+ * 
+ * @details A tag-lookup is cheap to copy and does not depend on the capacity of the
+ * table it refers to. An empty tag-lookup does not resolve any tag-name.
+ */
+class tag_lookup {
+public:
+    /**
+     * @var root_node
+     * 
+     * @brief Index of the node that acts as the parent of all outermost tag-names.
+     */
+    static constexpr auto root_node = std::int_fast16_t{0};
+
+    /**
+     * @var no_node
+     * 
+     * @brief Index that indicates a tag-name could not be resolved.
+     */
+    static constexpr auto no_node = std::int_fast16_t{-1};
+
+    /**
+     * @brief Default-constructs an empty tag-lookup.
+     */
+    constexpr tag_lookup() = default;
+
+    /**
+     * @brief Constructs a tag-lookup from the nodes and hash-slots of a table.
+     * 
+     * @param[in] nodes Pointer to the nodes of the table.
+     * @param[in] slots Pointer to the hash-slots of the table.
+     * @param[in] slot_count Number of hash-slots, which is required to be a power of two.
+     */
+    constexpr tag_lookup(
+        tag_node const* nodes,
+        std::int16_t const* slots,
+        std::uint_fast16_t slot_count
+    ):
+        nodes_{nodes},
+        slots_{slots},
+        slot_mask{static_cast<std::uint_fast16_t>(slot_count - 1)}
+    {}
+
+    /**
+     * @brief Finds the child node of a given parent node with a matching tag-name.
+     * 
+     * @details The hash of the tag-name and parent node selects a hash-slot. Ideally,
+     * only a single string comparison is needed to confirm the match. Colliding nodes
+     * are stored in the hash-slots that follow.
+     * 
+     * @param[in] parent Index of the parent node.
+     * @param[in] tag Tag-name to resolve.
+     * 
+     * @return Index of the matching node, or @ref no_node if there is no such node.
+     */
+    [[nodiscard]]
+    constexpr auto find(std::int_fast16_t parent, std::string_view tag) const
+    -> std::int_fast16_t {
+        if (empty() or parent == no_node) return no_node;
+
+        auto const hash = detail::hash_tag(parent, tag);
+        for (auto slot = hash & slot_mask; slots_[slot] != root_node;
+            slot = (slot + 1) & slot_mask)
+        {
+            auto const& node = nodes_[slots_[slot]];
+            if (node.hash == hash and node.parent == parent and node.tag == tag) {
+                return slots_[slot];
+            }
+        }
+        return no_node;
+    }
+
+    /**
+     * @brief Gets the index of the setting of which the path of tag-names ends at the
+     * given node.
+     * 
+     * @param[in] node Index of the node.
+     * 
+     * @return Index of the setting, or a negative value if no setting ends at the node.
+     */
+    [[nodiscard]]
+    constexpr auto setting_index(std::int_fast16_t node) const -> std::int_fast16_t {
+        if (empty() or node == no_node) return -1;
+        return nodes_[node].setting;
+    }
+
+    /**
+     * @brief Checks if the tag-lookup does not refer to any table.
+     */
+    [[nodiscard]]
+    constexpr auto empty() const -> bool
+    { return nodes_ == nullptr; }
+
+private:
+    tag_node const* nodes_{};          /**< Nodes of the referred table. */
+    std::int16_t const* slots_{};      /**< Hash-slots of the referred table. */
+    std::uint_fast16_t slot_mask{};    /**< Maps hash values to hash-slots. */
+};
+
+/**
+ * @class tag_table
+ * 
+ * @brief Stores the tree of tag-paths of a container of settings in a hash-table.
+ * 
+ * @details Each unique tag-name at a specific position within the tree is stored as a
+ * single node. The node at the end of the path of a setting refers to the index of that
+ * setting. When multiple settings have the exact same path of tag-names, the setting that
+ * comes first is referred to, just like a linear search through the settings would.
+ * 
+ * A tag-table is intended to be constructed in compile time from a constexpr container
+ * of settings, allowing it to be stored in read-only memory. Use the @ref
+ * count_tag_nodes function to determine its exact capacity.
+ * 
+ * @tparam MaxNodes Maximum number of nodes the table can store, excluding the root node.
+ */
+template<int MaxNodes,
+    typename = std::enable_if_t<(MaxNodes > 0 and MaxNodes < INT16_MAX)>>
+class tag_table {
+public:
+    /**
+     * @var max_nodes
+     * 
+     * @brief Maximum number of nodes the table can store, excluding the root node.
+     */
+    static constexpr auto max_nodes = int{MaxNodes};
+
+    /**
+     * @var slot_count
+     * 
+     * @brief Number of hash-slots, which keeps the load factor of the table below 50%.
+     */
+    static constexpr auto slot_count
+        = bit_ceil(static_cast<std::uint_fast16_t>(MaxNodes * 2 + 1));
+
+    /**
+     * @brief Default-constructs an empty tag-table.
+     */
+    constexpr tag_table() = default;
+
+    /**
+     * @brief Constructs a tag-table from the paths of tag-names of a given container of
+     * settings.
+     * 
+     * @details Nodes that would exceed the capacity of the table are discarded, along
+     * with the remaining part of the path they belong to.
+     * 
+     * @tparam Settings Container type that stores its contents in a contiguous sequence.
+     * 
+     * @param[in] settings Container with settings to obtain the paths of tag-names from.
+     */
+    template<typename Settings,
+        typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
+    constexpr explicit tag_table(Settings const& settings) {
+        auto const max_depth = int{Settings::value_type::max_tag_depth};
+        for (auto idx = std::size_t{}; idx < std::size(settings); ++idx) {
+            auto const& setting_obj = settings[idx];
+            auto parent = tag_lookup::root_node;
+
+            for (auto depth = 0; depth < max_depth; ++depth) {
+                if (setting_obj.is_tag_empty(depth)) break;
+                parent = insert(parent, setting_obj.tag(depth));
+                if (parent == tag_lookup::no_node) break;
+            }
+            if (parent > tag_lookup::root_node and nodes[parent].setting == -1) {
+                nodes[parent].setting = static_cast<std::int16_t>(idx);
+            }
+        }
+    }
+
+    /**
+     * @brief Gets a lookup that refers to the contents of this table.
+     * 
+     * @warning The tag-table should outlive the returned lookup.
+     */
+    [[nodiscard]]
+    constexpr auto lookup() const -> tag_lookup
+    { return {nodes.data(), slots.data(), slot_count}; }
+
+    /**
+     * @brief Gets the number of nodes stored, excluding the root node.
+     */
+    [[nodiscard]]
+    constexpr auto node_count() const -> int
+    { return count - 1; }
+
+private:
+    /**
+     * @brief Inserts a new node, unless a matching node is already stored.
+     * 
+     * @param[in] parent Index of the parent node.
+     * @param[in] tag Tag-name of the node.
+     * 
+     * @return Index of the inserted or matching node, or @ref tag_lookup::no_node if
+     * the table is full.
+     */
+    constexpr auto insert(std::int_fast16_t parent, char const* tag)
+    -> std::int_fast16_t {
+        if (auto const node = lookup().find(parent, tag); node != tag_lookup::no_node) {
+            return node;
+        }
+        if (count > MaxNodes) return tag_lookup::no_node;
+
+        auto const hash = detail::hash_tag(parent, tag);
+        auto slot = hash & (slot_count - 1);
+        while (slots[slot] != tag_lookup::root_node) {
+            slot = (slot + 1) & (slot_count - 1);
+        }
+        nodes[count] = tag_node{tag, hash, static_cast<std::int16_t>(parent)};
+        slots[slot] = count;
+        return count++;
+    }
+
+    array<tag_node, MaxNodes + 1> nodes{};   /**< Stores the nodes, starting at root. */
+    array<std::int16_t, slot_count> slots{}; /**< Maps hash values to nodes. */
+    std::int16_t count{1};                   /**< Number of nodes including the root. */
+};
+
+/**
+ * @brief Counts the number of unique nodes within the paths of tag-names of a given
+ * container of settings.
+ * 
+ * @details This function is intended to be used for determining the exact capacity of a
+ * @ref tag_table in compile time.
+ * 
+ * @tparam Settings Container type that stores its contents in a contiguous sequence.
+ * 
+ * @param[in] settings Container with settings to obtain the paths of tag-names from.
+ * 
+ * @return Number of unique nodes, excluding the root node.
+ */
+template<typename Settings,
+    typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
+[[nodiscard]]
+constexpr auto count_tag_nodes(Settings const& settings) -> int {
+    auto const max_depth = int{Settings::value_type::max_tag_depth};
+    auto const shares_path = [&](std::size_t lhs, std::size_t rhs, int depth) {
+        for (auto level = 0; level <= depth; ++level) {
+            if (not detail::tags_match(
+                settings[lhs].tag(level), settings[rhs].tag(level))) return false;
+        }
+        return true;
+    };
+    auto count = 0;
+    for (auto idx = std::size_t{}; idx < std::size(settings); ++idx) {
+        for (auto depth = 0; depth < max_depth; ++depth) {
+            if (settings[idx].is_tag_empty(depth)) break;
+
+            auto is_unique = true;
+            for (auto prev = std::size_t{}; prev < idx and is_unique; ++prev) {
+                is_unique = not shares_path(prev, idx, depth);
+            }
+            count += is_unique;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Makes a tag-table from the paths of tag-names of a given container of settings.
+ * 
+ * @tparam MaxNodes Maximum number of nodes the table can store.
+ * @tparam Settings Container type that stores its contents in a contiguous sequence.
+ * 
+ * @param[in] settings Container with settings to obtain the paths of tag-names from.
+ * 
+ * @return Tag-table object.
+ */
+template<int MaxNodes, typename Settings,
+    typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
+[[nodiscard]]
+constexpr auto make_tag_table(Settings const& settings) -> tag_table<MaxNodes>
+{ return tag_table<MaxNodes>{settings}; }
+
+} // namespace cfg
+
+#endif
@@ -19,7 +19,10 @@
 
 #include "config-parser.h"
 #include "file-pointer.h"
+#include "tag-pool.h"
+#include "tag-table.h"
 
+#include <checking/validation-mode.h>
 #include <errors/error-handler.h>
 #include <errors/error-types.h>
 #include <traits/class-traits.h>
@@ -32,8 +35,10 @@
 #define SAXML_MAX_STRING_LENGTH 64
 #include <libraries/saxml.h>
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <string_view>
 #include <type_traits>
@@ -45,6 +50,37 @@
  */
 namespace cfg {
 
+/**
+ * @namespace detail
+ * 
+ * @brief Provides helper/meta functions/types local to this header file.
+ */
+namespace detail {
+
+/**
+ * @brief Gets the size of the buffer that the SAXML library stores parsed strings in.
+ * 
+ * @details The SAXML library stores two characters less than the size of its buffer,
+ * including the null-character. One more character than the longest tag-name or value
+ * is stored, so that a string that is too long is never mistaken for one that fits. If
+ * the longest tag-name is not known in compile time, the default size is used instead.
+ * 
+ * @tparam Setting Type of the settings that the parsed strings are mapped to.
+ * 
+ * @return Number of characters of the buffer.
+ */
+template<typename Setting>
+[[nodiscard]]
+constexpr auto saxml_string_size() -> std::size_t {
+    if constexpr (has_max_tag_length_v<Setting>) {
+        return std::max(Setting::max_tag_length, Setting::max_value_size) + 3;
+    } else {
+        return std::size_t{SAXML_MAX_STRING_LENGTH};
+    }
+}
+
+} // namespace detail
+
 /**
  * @class xml_parser
  * 
@@ -72,6 +108,13 @@ class xml_parser : public config_parser<xml_parser<SettingIter, MaxSettings>> {
      */
     using settings_range = range<SettingIter>;
 
+    /**
+     * @typedef setting_t
+     * 
+     * @brief Type of the settings.
+     */
+    using setting_t = typename settings_range::value_type;
+
     /**
      * @{
      * @brief Grants the public interface access to its implementation.
@@ -80,6 +123,8 @@ class xml_parser : public config_parser<xml_parser<SettingIter, MaxSettings>> {
     friend constexpr auto base_type::parse_config(Config const&) -> void;
     friend auto base_type::report_parsing_errors() const -> void;
     friend constexpr auto base_type::has_parsing_errors() const -> bool;
+    friend constexpr auto base_type::export_parsing_errors(
+        std::byte*, std::size_t) const -> std::size_t;
     /** @} */
 
 public:
@@ -90,6 +135,13 @@ public:
      */
     static constexpr auto max_settings = int{MaxSettings};
 
+    /**
+     * @var validation
+     * 
+     * @brief Indicates how the values that an XML parser sets should be validated.
+     */
+    static constexpr auto validation = validation_mode::config_file;
+
     /**
      * @var max_tag_depth
      * 
@@ -98,6 +150,21 @@ public:
     static constexpr auto max_tag_depth
         = int{settings_range::value_type::max_tag_depth};
 
+    /**
+     * @var string_size
+     * 
+     * @brief Size of the buffer that parsed tag-names and values are stored in.
+     */
+    static constexpr auto string_size = detail::saxml_string_size<setting_t>();
+
+    /**
+     * @typedef setting_parsed_fn
+     * 
+     * @brief Function type that is notified with the index of each setting of which the
+     * value has been parsed completely, along with a type-erased context object.
+     */
+    using setting_parsed_fn = auto (*)(void*, std::uint_fast16_t) -> void;
+
     /**
      * @brief Default constructs an XML parser.
      */
@@ -116,6 +183,21 @@ public:
     constexpr explicit xml_parser(Settings& settings)
         : settings_{settings} {}
 
+    /**
+     * @brief Constructs an XML parser with a range of settings to operate on and a
+     * lookup that resolves tag-names to these settings.
+     * 
+     * @tparam Settings Container type that stores its contents in a contiguous sequence.
+     * 
+     * @param[in,out] settings Container with settings. Their values will be set based on
+     * the contents of the parsed XML data.
+     * @param[in] lookup Lookup of a @ref tag_table that is made from the same settings.
+     */
+    template<typename Settings,
+        typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
+    constexpr xml_parser(Settings& settings, tag_lookup lookup)
+        : settings_{settings}, lookup_table{lookup} {}
+
     /**
      * @brief Clears all of the parsing errors.
      */
@@ -128,6 +210,9 @@ public:
      * @details If the distance of the new range of settings exceeds the MaxSettings
      * value, the new range is ignored and no changes are made.
      * 
+     * The lookup that resolves tag-names is cleared, since it most likely does not
+     * match the new range of settings. Use @ref set_tag_lookup to provide a new one.
+     * 
      * @param[in] settings New range of settings to operate on. This can also be a
      * reference to a container type, due to the extensive constructors of the range
      * class.
@@ -136,64 +221,131 @@ public:
         auto const distance = settings.distance();
         if (distance <= 0 or distance > MaxSettings) return;
         settings_ = settings;
+        lookup_table = {};
     }
 
-private:
     /**
-     * @brief Parses XML-formatted data.
+     * @brief Sets the lookup that resolves tag-names to the range of settings.
      * 
-     * @details Walks through each character of the provided configuration data. The
-     * SAXML library performs the core parsing procedures. Every raised SAX-event is
-     * dispatched to the corresponding member functions prefixed with a 'handle' name.
-     * 
-     * Any potential parsing error is added to the error-handler. A file-pointer is used
-     * to keep track of the line and column position within the XML file.
+     * @details With a lookup, each parsed tag-name is resolved with a single hash-table
+     * lookup instead of being compared with the tag-name of every setting. Without a
+     * lookup (i.e.: an empty one), the tag-names of all the settings are searched.
      * 
-     * @param[in] config XML-formatted data to parse.
+     * @param[in] lookup Lookup of a @ref tag_table that is made from the same range of
+     * settings this parser operates on.
      */
-    constexpr auto parse_config_impl(std::string_view config) -> void {
-        if (config.empty()) {
-            err_handler.add_error(parsing_error::empty_config, position);
-            return;
-        }
-        reset_parsing();
-        execute_parsing(config);
-        verify_parsing();
-    }
+    constexpr auto set_tag_lookup(tag_lookup lookup) -> void
+    { lookup_table = lookup; }
 
     /**
-     * @brief Resets all the state that changes during the parsing of the XML file.
+     * @brief Sets the handler that is notified whenever the value of a setting has been
+     * parsed completely.
+     * 
+     * @details The handler is invoked right after the contents of a setting's tag are
+     * stored, while the XML data is still being parsed. This allows a value to be
+     * processed further while it is still in cache, instead of after the whole file has
+     * been parsed. The handler must not modify the values of any other settings.
+     * 
+     * @param[in] handler Function to notify, or a null pointer to stop notifying.
+     * @param[in] context Type-erased object that is passed along to the handler.
      */
-    constexpr auto reset_parsing() -> void {
-        position.reset();
-        err_handler.clear_errors();
-        cfg::fill_n(tag_levels, settings_.distance(), std::int8_t{});
-        handle_tag_called = false;
+    constexpr auto set_setting_parsed_handler(
+        setting_parsed_fn handler, void* context) -> void
+    {
+        parsed_handler = handler;
+        parsed_context = context;
     }
 
     /**
-     * @brief Executes the parsing process.
+     * @brief Prepares the parser for parsing XML-formatted data in blocks.
      * 
-     * @details Interacts with the SAXML library to carry out the core parsing mechanics
-     * with the provided XML-formatted data.
+     * @details Resets all the parsing state and initializes the SAXML library. The XML
+     * data can then be provided block by block with @ref parse_block, after which the
+     * parsing should be completed with @ref end_parsing. The parser must not be copied
+     * or moved in the meantime.
      * 
-     * @param[in] config XML-formatted data to parse.
+     * The state and string buffer of the SAXML library are stored within this parser,
+     * so multiple parsers can be used at the same time without sharing any state.
      */
-    auto execute_parsing(std::string_view config) -> void {
-        auto saxml_context = tSaxmlContext{
+    auto begin_parsing() -> void {
+        reset_parsing();
+        saxml_context = tSaxmlContext{
             this,
             invoke<&xml_parser::handle_tag>,
             invoke<&xml_parser::handle_tag_end>,
-            nullptr,
+            invoke<&xml_parser::handle_attribute_value>,
             invoke<&xml_parser::handle_content>,
-            nullptr
+            invoke<&xml_parser::handle_attribute>
         };
-        auto saxml = saxml_Initialize(&saxml_context, SAXML_MAX_STRING_LENGTH);
+        saxml = saxml_InitializeWithStorage(
+            &saxml_state, &saxml_context, saxml_buffer.data(), saxml_buffer.size());
+    }
 
-        for (auto const character : config) {
-            saxml_HandleCharacter(saxml, character);
-            update_position(character);
+    /**
+     * @brief Parses the next block of XML-formatted data.
+     * 
+     * @details The block does not have to end at the boundary of a tag or its contents,
+     * as the SAXML library keeps track of its state between blocks.
+     * 
+     * @param[in] block Next block of XML-formatted data to parse.
+     */
+    auto parse_block(std::string_view block) -> void {
+        saxml_HandleBuffer(saxml, block.data(), block.size());
+        bytes_parsed += static_cast<std::uint_least32_t>(block.size());
+    }
+
+    /**
+     * @brief Completes the parsing of XML-formatted data that was provided in blocks.
+     * 
+     * @details If no data was parsed at all, a matching parsing-error is added to the
+     * error-handler. Otherwise, the parsing process is verified.
+     */
+    auto end_parsing() -> void {
+        if (bytes_parsed == 0) {
+            err_handler.add_error(parsing_error::empty_config, current_position());
+            return;
+        }
+        verify_parsing();
+    }
+
+private:
+    /**
+     * @brief Parses XML-formatted data.
+     * 
+     * @details Walks through each character of the provided configuration data. The
+     * SAXML library performs the core parsing procedures. Every raised SAX-event is
+     * dispatched to the corresponding member functions prefixed with a 'handle' name.
+     * 
+     * Any potential parsing error is added to the error-handler, along with the line
+     * and column position within the XML file where applicable.
+     * 
+     * @param[in] config XML-formatted data to parse.
+     */
+    auto parse_config_impl(std::string_view config) -> void {
+        begin_parsing();
+        parse_block(config);
+        end_parsing();
+    }
+
+    /**
+     * @brief Resets all the state that changes during the parsing of the XML file.
+     * 
+     * @details The values of the settings are cleared as well, so that a setting that
+     * was parsed before but that is left out now is reported as not set.
+     */
+    constexpr auto reset_parsing() -> void {
+        err_handler.clear_errors();
+        cfg::fill_n(tag_levels, settings_.distance(), std::int8_t{});
+        cfg::fill(values_parsed, false);
+        for (auto&& setting_obj : settings_) {
+            setting_obj.set_value(std::string_view{});
         }
+        cfg::fill(tag_path, static_cast<std::int_least16_t>(tag_lookup::no_node));
+        tag_path.front() = tag_lookup::root_node;
+        bytes_parsed = 0;
+        tag_depth = 0;
+        handle_tag_called = false;
+        attribute_open = false;
     }
 
     /**
@@ -212,18 +364,33 @@ private:
     { (static_cast<xml_parser*>(object)->*MemberFunc)(value); }
 
     /**
-     * @brief Updates the position of the file-pointer based on the given character.
+     * @brief Invokes member-function calls for content that is written into a sink.
      * 
-     * @details If the character is a carriage return, it is simply ignored.
+     * @tparam MemberFunc Pointer to a member-function used for handling sunk contents.
+     * 
+     * @param[in] object Instance of an XML parser object to operate on.
+     * @param[in] length Number of characters written into the sink.
+     * @param[in] truncated Non-zero if the contents did not fit in the sink.
+     */
+    template<void (xml_parser::*MemberFunc)(std::uint32_t, bool)>
+    static auto invoke_sink(void* object, std::uint32_t length, int truncated) -> void
+    { (static_cast<xml_parser*>(object)->*MemberFunc)(length, truncated != 0); }
+
+    /**
+     * @brief Gets the position of the file-pointer.
      * 
-     * @param[in] character Character that is being parsed.
+     * @details The SAXML library keeps track of the line and column position while it
+     * scans the XML data. Within an event-handler, this is the position of the
+     * character that raised the SAX-event. Carriage returns are not counted as columns.
      */
-    constexpr auto update_position(char character) -> void {
-        if (character == '\n') {
-            position.next_line();
-        } else if (character != '\r') {
-            position.next_column();
+    [[nodiscard]]
+    auto current_position() const -> file_ptr {
+        auto line = std::uint32_t{1};
+        auto column = std::uint32_t{1};
+        if (saxml != nullptr) {
+            saxml_GetPosition(saxml, &line, &column);
         }
+        return {static_cast<int>(column), static_cast<int>(line)};
     }
 
     /**
@@ -233,14 +400,14 @@ private:
      * match zero exactly, or if no tags were found, a matching parsing-error is added
      * to the error-handler.
      */
-    constexpr auto verify_parsing() -> void {
+    auto verify_parsing() -> void {
         if (tag_depth > 0) {
             err_handler.add_error(parsing_error::missing_closing_tag, tag_depth);
         } else if (tag_depth < 0) {
             err_handler.add_error(parsing_error::missing_opening_tag, -tag_depth);
         }
         if (not handle_tag_called) {
-            err_handler.add_error(parsing_error::no_tags_found, position);
+            err_handler.add_error(parsing_error::no_tags_found, current_position());
         }
     }
 
@@ -263,12 +430,24 @@ private:
             "[ERROR]Some errors occurred while parsing the config file:\n");
     }
 
+    /**
+     * @brief Exports the errors that occurred during the parsing of an XML file
+     * as a binary error record.
+     * 
+     * @param[out] buffer Buffer to write the error record to.
+     * @param[in] buffer_size Capacity of the buffer, in number of bytes.
+     * 
+     * @return Number of bytes written.
+     */
+    constexpr auto export_parsing_errors_impl(
+        std::byte* buffer, std::size_t buffer_size) const -> std::size_t
+    { return err_handler.export_errors(error_source::parsing, buffer, buffer_size); }
+
     /**
      * @brief Handles SAX-events whenever an XML-tag is being parsed.
      * 
-     * @details Whenever the parsed tag-name matches the tag-name of a setting at the
-     * right tag-depth, that setting is selected as the new target setting. The target
-     * setting will be of interest for other event-handlers.
+     * @details The parsed tag-name is either resolved by the tag-lookup, or matched
+     * against the tag-names of all the settings when there is no tag-lookup available.
      * 
      * If there are no tags found in the XML-file, this function is never called and
      * the 'handle_tag_called' flag remains set to false.
@@ -276,18 +455,77 @@ private:
      * @param[in] tag Name of the tag that is being parsed.
      */
     constexpr auto handle_tag(char const* tag) -> void {
-        if (tag_depth < max_tag_depth) {
-            for (auto [it, end, idx] = settings_.enumerate(); it != end; ++it, ++idx) {
-                if (not tag_depth_matches(idx))     continue;
-                if (not tag_name_matches(tag, idx)) continue;
-                increase_tag_level(idx);
-                select_setting(idx);
-            }
+        close_attribute();
+        if (lookup_table.empty()) {
+            match_tag(tag);
+        } else {
+            resolve_tag(tag);
         }
         ++tag_depth;
         handle_tag_called = true;
     }
 
+    /**
+     * @brief Resolves a tag-name with the tag-lookup.
+     * 
+     * @details The node of the parsed tag-name is looked up as a child of the node that
+     * was resolved at the previous tag-depth. The resolved node is tracked for every
+     * tag-depth. If the tag-name does not belong to any setting, or if its parent could
+     * not be resolved, the node is tracked as unresolved.
+     * 
+     * If the node is the final tag of a setting that has not been parsed yet, the SAXML
+     * library is instructed to write the contents of the tag straight into the value
+     * buffer of that setting.
+     * 
+     * @param[in] tag Name of the tag that is being parsed.
+     */
+    auto resolve_tag(std::string_view tag) -> void {
+        if (tag_depth < 0 or tag_depth >= max_tag_depth) return;
+        auto const node = lookup_table.find(tag_path[tag_depth], tag);
+        tag_path[tag_depth + 1] = static_cast<std::int_least16_t>(node);
+
+        auto const index = lookup_table.setting_index(node);
+        if (index < 0 or values_parsed[index]) return;
+
+        auto&& setting_obj = settings_[index];
+        auto const capacity = setting_obj.value_capacity();
+        saxml_SetContentSink(saxml, setting_obj.value_buffer(), capacity,
+            invoke_sink<&xml_parser::handle_content_sink>);
+    }
+
+    /**
+     * @brief Matches a tag-name against the tag-names of all the settings.
+     * 
+     * @details Whenever the parsed tag-name matches the tag-name of a setting at the
+     * right tag-depth, that setting is selected as the new target setting. The target
+     * setting will be of interest for other event-handlers. Once a setting of which the
+     * path of tag-names ends at this tag is selected, it stays selected. Hence, when
+     * multiple settings have the exact same path, the one that comes first is the target.
+     * 
+     * If the settings refer to interned tag-names, the parsed tag-name is resolved to its
+     * identifier once, after which the tag-names of the settings are matched as integers.
+     * 
+     * @param[in] tag Name of the tag that is being parsed.
+     */
+    constexpr auto match_tag(char const* tag) -> void {
+        if (tag_depth >= max_tag_depth) return;
+        auto const resolved_tag = intern_tag(tag);
+        if constexpr (has_interned_tags_v<setting_t>) {
+            if (resolved_tag == unknown_tag_id) return;
+        }
+        auto is_final_selected = false;
+        for (auto [it, end, idx] = settings_.enumerate(); it != end; ++it, ++idx) {
+            if (not tag_depth_matches(idx))              continue;
+            if (not tag_name_matches(resolved_tag, idx)) continue;
+            increase_tag_level(idx);
+            if (is_final_selected) continue;
+
+            select_setting(idx);
+            is_final_selected = tag_depth + 1 == max_tag_depth
+                or it->is_tag_empty(tag_depth + 1);
+        }
+    }
+
     /**
      * @brief Checks if the current tag-depth matches the tracked tag-level of a given
      * setting.
@@ -310,6 +548,35 @@ private:
         std::string_view tag, std::uint_fast16_t index) const -> bool
     { return settings_[index].tag(tag_depth) == tag; }
 
+    /**
+     * @brief Checks if the identifier of an interned tag-name matches the tag-name of a
+     * given setting at the current tag-depth.
+     * 
+     * @param[in] tag Identifier of the interned tag-name to compare.
+     * @param[in] index Index of the setting to check.
+     */
+    [[nodiscard]]
+    constexpr auto tag_name_matches(tag_id tag, std::uint_fast16_t index) const -> bool
+    { return settings_[index].interned_tag(tag_depth) == tag; }
+
+    /**
+     * @brief Converts a parsed tag-name to the form in which it is matched against the
+     * tag-names of the settings.
+     * 
+     * @param[in] tag Name of the tag that is being parsed.
+     * 
+     * @return Identifier of the interned tag-name if the settings support it, otherwise
+     * the tag-name itself.
+     */
+    [[nodiscard]]
+    static constexpr auto intern_tag(char const* tag) {
+        if constexpr (has_interned_tags_v<setting_t>) {
+            return setting_t::find_tag(tag);
+        } else {
+            return tag;
+        }
+    }
+
     /**
      * @brief Increases the tracked tag-level of a given setting.
      * 
@@ -335,32 +602,115 @@ private:
     /**
      * @brief Handles SAX-events whenever a closing tag is being parsed.
      * 
-     * @details Simply decrements the current tag depth.
+     * @details Decrements the current tag depth. Any content-sink that is still set
+     * belonged to the tag that is closed, such as an empty tag, and is cleared.
      */
-    constexpr auto handle_tag_end(char const*) -> void
-    { --tag_depth; }
+    auto handle_tag_end(char const*) -> void {
+        close_attribute();
+        if (not lookup_table.empty()) {
+            saxml_SetContentSink(saxml, nullptr, 0, nullptr);
+        }
+        --tag_depth;
+    }
 
     /**
      * @brief Handles SAX-events whenever the contents of an XML-tag is being parsed.
      * 
      * @details Sets the value of the targeted setting to the parsed content as long as
-     * the content matches the right tag. If the size of the content exceeds the size of
-     * a setting's value-buffer, the content is only copied partially and a matching
-     * parser-error is added to the error-handler.
+     * the content matches the right tag. When a tag-lookup is used, the targeted
+     * setting is the one that ends at the node resolved at the current tag-depth. Only
+     * the first occurrence of a setting's tag is used, similarly to when all the
+     * tag-names are searched.
      * 
      * @param[in] content Zero-terminated string that refers to the actual contents of an
      * XML-tag.
      */
     constexpr auto handle_content(char const* content) -> void {
-        if (not tag_depth_matches(target_setting))    return;
-        if (not is_final_tag_reached(target_setting)) return;
+        close_attribute();
+        store_content(content);
+    }
 
-        auto const string_value = std::string_view{content};
-        if (string_value.size() > settings_range::value_type::max_value_size) {
-            err_handler.add_error(parsing_error::exceeds_max_value_length, position);
+    /**
+     * @brief Stores the parsed contents of an XML-tag or the value of an attribute.
+     * 
+     * @details Refer to @ref handle_content for more details.
+     * 
+     * @param[in] content Zero-terminated string that refers to the parsed contents.
+     */
+    constexpr auto store_content(char const* content) -> void {
+        if (lookup_table.empty()) {
+            if (not tag_depth_matches(target_setting))    return;
+            if (not is_final_tag_reached(target_setting)) return;
+
+            set_setting_value(target_setting, content);
+            reset_tag_level(target_setting);
+            notify_setting_parsed(target_setting);
+        } else {
+            if (tag_depth <= 0 or tag_depth > max_tag_depth) return;
+
+            auto const index = lookup_table.setting_index(tag_path[tag_depth]);
+            if (index < 0 or values_parsed[index]) return;
+
+            set_setting_value(index, content);
+            values_parsed[index] = true;
+            notify_setting_parsed(index);
         }
-        settings_[target_setting].set_value(string_value);
-        reset_tag_level(target_setting);
+    }
+
+    /**
+     * @brief Handles SAX-events whenever the contents of an XML-tag have been written
+     * into the value-buffer of the setting at the current tag-depth.
+     * 
+     * @details If the contents did not fit in the value-buffer, they are truncated and a
+     * matching parser-error is added to the error-handler.
+     * 
+     * @param[in] length Number of characters written into the value-buffer.
+     * @param[in] truncated Indicates whether the contents were truncated.
+     */
+    auto handle_content_sink(std::uint32_t length, bool truncated) -> void {
+        if (tag_depth <= 0 or tag_depth > max_tag_depth) return;
+
+        auto const index = lookup_table.setting_index(tag_path[tag_depth]);
+        if (index < 0 or values_parsed[index]) return;
+
+        if (truncated) {
+            err_handler.add_error(
+                parsing_error::exceeds_max_value_length, current_position());
+        }
+        settings_[index].set_value_size(length);
+        values_parsed[index] = true;
+        notify_setting_parsed(index);
+    }
+
+    /**
+     * @brief Sets the value of a given setting to the parsed content.
+     * 
+     * @details If the size of the content exceeds the size of a setting's value-buffer,
+     * the content is only copied partially and a matching parser-error is added to the
+     * error-handler.
+     * 
+     * @param[in] index Index of the setting.
+     * @param[in] content Actual contents of an XML-tag.
+     */
+    auto set_setting_value(
+        std::uint_fast16_t index, std::string_view content) -> void
+    {
+        if (content.size() > settings_[index].value_capacity()) {
+            err_handler.add_error(
+                parsing_error::exceeds_max_value_length, current_position());
+        }
+        settings_[index].set_value(content);
+    }
+
+    /**
+     * @brief Notifies the setting-parsed handler (if any) that the value of a given
+     * setting has been parsed completely.
+     * 
+     * @param[in] index Index of the setting.
+     */
+    constexpr auto notify_setting_parsed(std::uint_fast16_t index) const -> void {
+        if (parsed_handler == nullptr) return;
+        parsed_handler(parsed_context, index);
     }
 
     /**
@@ -383,19 +733,59 @@ private:
     { tag_levels[index] = 0; }
 
     /**
-     * @brief Handles SAX-events whenever the attribute of an XML-tag is being parsed.
+     * @brief Handles SAX-events whenever the name of an attribute of an XML-tag has been
+     * parsed.
+     * 
+     * @details An attribute is treated as a child tag of the tag that it belongs to, so
+     * that <time enabled="1"/> sets the same setting as a nested <enabled> tag would.
+     * Its name is resolved or matched like a tag-name, one tag-level deeper. With a
+     * tag-lookup, its value is thus written straight into the value buffer of its setting
+     * while the value is streamed, just like the contents of a tag. The tag-level of the
+     * attribute stays open until the next SAX-event, since an attribute has no end-event.
      * 
-     * @note There is no implementation provided, as there is currently no use for it.
+     * @param[in] name Name of the attribute that is being parsed.
      */
-    constexpr auto handle_attribute(char const*) -> void {}
+    auto handle_attribute(char const* name) -> void {
+        handle_tag(name);
+        attribute_open = true;
+    }
+
+    /**
+     * @brief Handles SAX-events whenever the value of an attribute has been parsed, and
+     * was not written into the value buffer of a setting.
+     * 
+     * @param[in] value Zero-terminated string that refers to the value of the attribute.
+     */
+    constexpr auto handle_attribute_value(char const* value) -> void
+    { store_content(value); }
+
+    /**
+     * @brief Closes the tag-level of the attribute that was parsed last, if it is still
+     * open.
+     */
+    constexpr auto close_attribute() -> void {
+        if (not attribute_open) return;
+        attribute_open = false;
+        --tag_depth;
+    }
 
     settings_range settings_;                     /**< Range of all the settings. */
-    file_ptr position;                            /**< Position of the file-pointer. */
+    tag_lookup lookup_table;                      /**< Resolves tag-names to settings. */
     error_handler<MaxSettings> err_handler;       /**< Handles parsing-errors. */
     array<std::int8_t, MaxSettings> tag_levels{}; /**< Tracks tag levels of settings. */
+    array<bool, MaxSettings> values_parsed{};     /**< Tracks which values are parsed. */
+    array<std::int_least16_t, max_tag_depth + 1> tag_path{}; /**< Resolved tag nodes. */
+    tSaxmlContext saxml_context{};                /**< Handlers of the SAX-events. */
+    tSaxmlState saxml_state{};                    /**< State of the SAXML parser. */
+    array<char, string_size> saxml_buffer{};      /**< Parsed SAXML strings. */
+    tSaxmlParser saxml{};                         /**< Handle to the SAXML parser. */
+    setting_parsed_fn parsed_handler{};           /**< Notified of parsed settings. */
+    void* parsed_context{};                       /**< Context of the parsed handler. */
+    std::uint_least32_t bytes_parsed{};           /**< Number of bytes parsed. */
     std::uint_least16_t target_setting{};         /**< Index of the selected setting. */
     std::int_least8_t tag_depth{};                /**< Tracks the depth of a tag. */
     bool handle_tag_called{};                     /**< Tracks if any tag was parsed. */
+    bool attribute_open{};                        /**< Tracks an open attribute level. */
 };
 
 /**
@@ -19,11 +19,14 @@
 
 #include "default-setting-ids.h"
 #include "setting.h"
+#include "setting-table.h"
 #include "setting-validators.h"
 
 #include <checking/validators.h>
 #include <core/main-config.h>
+#include <parsing/message-decoder.h>
 #include <parsing/node.h>
+#include <parsing/tag-table.h>
 #include <utilities/bitwise.h>
 
 // warning: implicitly includes 'all.h'
@@ -48,6 +51,9 @@ namespace cfg {
  * customized. The bitspan of a setting indicates which part of a config message contains
  * the value to obtain.
  * 
+ * The settings of a trigger are enabled by its 'enabled' setting, so that they are not
+ * validated, nor reported as unset, while the trigger is disabled.
+ * 
  * The definitons of the @link default-setting-ids.h default settings @endlink are
  * strongly coupled to the default @link setting_identifier setting-identfiers @endlink.
  * When adding a new default setting, it should have a new corresponding default
@@ -109,7 +115,8 @@ constexpr auto get_default_settings() {
             bitspan::make<64, 32>,
             validate<std::uint32_t, 1'000>,
             +[](setting_data data, main_config& config)
-            { config.framework.trigger.time.interval_ms = data.uint32; }},
+            { config.framework.trigger.time.interval_ms = data.uint32; }
+        }.enabled_by(id::time_trigger_enabled),
         setting{
             id::time_trigger_thp,
             time_sensors / "thp",
@@ -127,7 +134,7 @@ constexpr auto get_default_settings() {
                     config.framework.bme280.measure_pressure    = false;
                     config.framework.trigger.time.measure.thp   = false;
                 }
-            }},
+            }}.enabled_by(id::time_trigger_enabled),
         setting{
             id::time_trigger_acc_gyro,
             time_sensors / "accel-gyro",
@@ -143,7 +150,7 @@ constexpr auto get_default_settings() {
                     config.framework.bmx160.measure_gyroscope        = false;
                     config.framework.trigger.time.measure.accel_gyro = false;
                 }
-            }},
+            }}.enabled_by(id::time_trigger_enabled),
         setting{
             id::time_trigger_magnetometer,
             time_sensors / "magnet",
@@ -157,7 +164,7 @@ constexpr auto get_default_settings() {
                     config.framework.bmx160.measure_magnetometer = false;
                     config.framework.trigger.time.measure.magnet = false;
                 }
-            }},
+            }}.enabled_by(id::time_trigger_enabled),
         setting{
             id::time_trigger_light_intensity,
             time_sensors / "light",
@@ -171,28 +178,31 @@ constexpr auto get_default_settings() {
                     config.framework.veml6030.measure_light     = false;
                     config.framework.trigger.time.measure.light = false;
                 }
-            }},
+            }}.enabled_by(id::time_trigger_enabled),
         setting{
             id::time_trigger_lora_priority,
             time / "write-to" / "lorawan-priority",
             bitspan::make<128, 2>,
             validate<std::int8_t, 0, 3>,
             +[](setting_data data, main_config& config)
-            { config.framework.trigger.time.lorawan_priority = data.int8; }},
+            { config.framework.trigger.time.lorawan_priority = data.int8; }
+        }.enabled_by(id::time_trigger_enabled),
         setting{
             id::time_trigger_write_to_lora,
             time / "write-to" / "lora",
             bitspan::make<130>,
             validate<bool>,
             +[](setting_data data, main_config& config)
-            { config.framework.trigger.time.write_to.lora = data.flag; }},
+            { config.framework.trigger.time.write_to.lora = data.flag; }
+        }.enabled_by(id::time_trigger_enabled),
         setting{
             id::time_trigger_write_to_sd,
             time / "write-to" / "sd",
             bitspan::make<131>,
             validate<bool>,
             +[](setting_data data, main_config& config)
-            { config.framework.trigger.time.write_to.sd = data.flag; }},
+            { config.framework.trigger.time.write_to.sd = data.flag; }
+        }.enabled_by(id::time_trigger_enabled),
         setting{
             id::light_trigger_enabled,
             light / "enabled",
@@ -206,14 +216,16 @@ constexpr auto get_default_settings() {
             bitspan::make<112, 16>,
             validate<std::uint16_t>,
             +[](setting_data data, main_config& config)
-            { config.framework.trigger.light.low_threshold = data.uint16; }},
+            { config.framework.trigger.light.low_threshold = data.uint16; }
+        }.enabled_by(id::light_trigger_enabled),
         setting{
             id::light_trigger_high_threshold,
             light / "high-threshold",
             bitspan::make<96, 16>,
             validate<std::uint16_t>,
             +[](setting_data data, main_config& config)
-            { config.framework.trigger.light.high_threshold = data.uint16; }},
+            { config.framework.trigger.light.high_threshold = data.uint16; }
+        }.enabled_by(id::light_trigger_enabled),
         setting{
             id::light_trigger_thp,
             light_sensors / "thp",
@@ -225,7 +237,7 @@ constexpr auto get_default_settings() {
                 } else {
                     config.framework.trigger.light.measure.thp = false;
                 }
-            }},
+            }}.enabled_by(id::light_trigger_enabled),
         setting{
             id::light_trigger_acc_gyro,
             light_sensors / "accel-gyro",
@@ -237,7 +249,7 @@ constexpr auto get_default_settings() {
                 } else {
                     config.framework.trigger.light.measure.accel_gyro = false;
                 }
-            }},
+            }}.enabled_by(id::light_trigger_enabled),
         setting{
             id::light_trigger_magnetometer,
             light_sensors / "magnet",
@@ -249,7 +261,7 @@ constexpr auto get_default_settings() {
                 } else {
                     config.framework.trigger.light.measure.magnet = false;
                 }
-            }},
+            }}.enabled_by(id::light_trigger_enabled),
         setting{
             id::light_trigger_light_intensity,
             light_sensors / "light",
@@ -261,28 +273,31 @@ constexpr auto get_default_settings() {
                 } else {
                     config.framework.trigger.light.measure.light = false;
                 }
-            }},
+            }}.enabled_by(id::light_trigger_enabled),
         setting{
             id::light_trigger_lora_priority,
             light / "write-to" / "lorawan-priority",
             bitspan::make<132, 2>,
             validate<std::int8_t, 0, 3>,
             +[](setting_data data, main_config& config)
-            { config.framework.trigger.light.lorawan_priority = data.int8; }},
+            { config.framework.trigger.light.lorawan_priority = data.int8; }
+        }.enabled_by(id::light_trigger_enabled),
         setting{
             id::light_trigger_write_to_lora,
             light / "write-to" / "lora",
             bitspan::make<134>,
             validate<bool>,
             +[](setting_data data, main_config& config)
-            { config.framework.trigger.light.write_to.lora = data.flag; }},
+            { config.framework.trigger.light.write_to.lora = data.flag; }
+        }.enabled_by(id::light_trigger_enabled),
         setting{
             id::light_trigger_write_to_sd,
             light / "write-to" / "sd",
             bitspan::make<135>,
             validate<bool>,
             +[](setting_data data, main_config& config)
-            { config.framework.trigger.light.write_to.sd = data.flag; }},
+            { config.framework.trigger.light.write_to.sd = data.flag; }
+        }.enabled_by(id::light_trigger_enabled),
         setting{
             id::acceleration_trigger_enabled,
             acceleration / "enabled",
@@ -301,7 +316,7 @@ constexpr auto get_default_settings() {
                 } else {
                     config.framework.trigger.acceleration.measure.thp = false;
                 }
-            }},
+            }}.enabled_by(id::acceleration_trigger_enabled),
         setting{
             id::acceleration_trigger_acc_gyro,
             accel_sensors / "accel-gyro",
@@ -313,7 +328,7 @@ constexpr auto get_default_settings() {
                 } else {
                     config.framework.trigger.acceleration.measure.accel_gyro = false;
                 }
-            }},
+            }}.enabled_by(id::acceleration_trigger_enabled),
         setting{
             id::acceleration_trigger_magnetometer,
             accel_sensors / "magnet",
@@ -325,7 +340,7 @@ constexpr auto get_default_settings() {
                 } else {
                     config.framework.trigger.acceleration.measure.magnet = false;
                 }
-            }},
+            }}.enabled_by(id::acceleration_trigger_enabled),
         setting{
             id::acceleration_trigger_light_intensity,
             accel_sensors / "light",
@@ -337,28 +352,31 @@ constexpr auto get_default_settings() {
                 } else {
                     config.framework.trigger.acceleration.measure.light = false;
                 }
-            }},
+            }}.enabled_by(id::acceleration_trigger_enabled),
         setting{
             id::acceleration_trigger_lora_priority,
             acceleration / "write-to" / "lorawan-priority",
             bitspan::make<136, 2>,
             validate<std::int8_t, 0, 3>,
             +[](setting_data data, main_config& config)
-            { config.framework.trigger.acceleration.lorawan_priority = data.int8; }},
+            { config.framework.trigger.acceleration.lorawan_priority = data.int8; }
+        }.enabled_by(id::acceleration_trigger_enabled),
         setting{
             id::acceleration_trigger_write_to_lora,
             acceleration / "write-to" / "lora",
             bitspan::make<138>,
             validate<bool>,
             +[](setting_data data, main_config& config)
-            { config.framework.trigger.acceleration.write_to.lora = data.flag; }},
+            { config.framework.trigger.acceleration.write_to.lora = data.flag; }
+        }.enabled_by(id::acceleration_trigger_enabled),
         setting{
             id::acceleration_trigger_write_to_sd,
             acceleration / "write-to" / "sd",
             bitspan::make<139>,
             validate<bool>,
             +[](setting_data data, main_config& config)
-            { config.framework.trigger.acceleration.write_to.sd = data.flag; }},
+            { config.framework.trigger.acceleration.write_to.sd = data.flag; }
+        }.enabled_by(id::acceleration_trigger_enabled),
         setting{
             id::orientation_trigger_enabled,
             orientation / "enabled",
@@ -377,7 +395,7 @@ constexpr auto get_default_settings() {
                 } else {
                     config.framework.trigger.orientation.measure.thp = false;
                 }
-            }},
+            }}.enabled_by(id::orientation_trigger_enabled),
         setting{
             id::orientation_trigger_acc_gyro,
             orien_sensors / "accel-gyro",
@@ -389,7 +407,7 @@ constexpr auto get_default_settings() {
                 } else {
                     config.framework.trigger.orientation.measure.accel_gyro = false;
                 }
-            }},
+            }}.enabled_by(id::orientation_trigger_enabled),
         setting{
             id::orientation_trigger_magnetometer,
             orien_sensors / "magnet",
@@ -401,7 +419,7 @@ constexpr auto get_default_settings() {
                 } else {
                     config.framework.trigger.orientation.measure.magnet = false;
                 }
-            }},
+            }}.enabled_by(id::orientation_trigger_enabled),
         setting{
             id::orientation_trigger_light_intensity,
             orien_sensors / "light",
@@ -413,21 +431,23 @@ constexpr auto get_default_settings() {
                 } else {
                     config.framework.trigger.orientation.measure.light = false;
                 }
-            }},
+            }}.enabled_by(id::orientation_trigger_enabled),
         setting{
             id::orientation_trigger_lora_priority,
             orientation / "write-to" / "lorawan-priority",
             bitspan::make<140, 2>,
             validate<std::int8_t, 0, 3>,
             +[](setting_data data, main_config& config)
-            { config.framework.trigger.orientation.lorawan_priority = data.int8; }},
+            { config.framework.trigger.orientation.lorawan_priority = data.int8; }
+        }.enabled_by(id::orientation_trigger_enabled),
         setting{
             id::orientation_trigger_write_to_lora,
             orientation / "write-to" / "lora",
             bitspan::make<142>,
             validate<bool>,
             +[](setting_data data, main_config& config)
-            { config.framework.trigger.orientation.write_to.lora = data.flag; }},
+            { config.framework.trigger.orientation.write_to.lora = data.flag; }
+        }.enabled_by(id::orientation_trigger_enabled),
         setting{
             id::orientation_trigger_write_to_sd,
             orientation / "write-to" / "sd",
@@ -435,11 +455,44 @@ constexpr auto get_default_settings() {
             validate<bool>,
             +[](setting_data data, main_config& config)
             { config.framework.trigger.orientation.write_to.sd = data.flag; }
-        }
+        }.enabled_by(id::orientation_trigger_enabled)
     );
     return settings;
 }
 
+/**
+ * @brief Gets the tag-table of the default settings.
+ * 
+ * @details The table is made in compile time from the tag-names of the @ref
+ * get_default_settings "default settings", and sized to hold exactly the number of
+ * unique tag-names within their paths. Its lookup allows the XML-parser to resolve
+ * each tag-name directly rather than comparing it with every setting.
+ * 
+ * @return Reference to a statically stored @ref tag_table object.
+ */
+[[nodiscard]]
+inline auto get_default_tag_table() -> auto const& {
+    constexpr auto node_count = count_tag_nodes(get_default_settings());
+    static constexpr auto table = make_tag_table<node_count>(get_default_settings());
+    return table;
+}
+
+/**
+ * @typedef default_message_decoder
+ * 
+ * @brief Decoder of config messages that is generated in compile time from the bitspans
+ * of the @ref get_default_settings "default settings".
+ */
+using default_message_decoder = message_decoder<get_default_settings>;
+
+/**
+ * @typedef default_setting_table
+ * 
+ * @brief Table of the @ref get_default_settings "default settings", of which only the
+ * values are stored in RAM.
+ */
+using default_setting_table = setting_table<get_default_settings>;
+
 } // namespace cfg
 
 #endif
@@ -25,9 +25,14 @@
 #include <errors/error-types.h>
 #include <traits/class-traits.h>
 #include <traits/iterator-traits.h>
+#include <utilities/checksum.h>
 #include <utilities/range.h>
 
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
 #include <type_traits>
 
 /**
@@ -37,6 +42,46 @@
  */
 namespace cfg {
 
+/**
+ * @brief Checks if a setting is disabled by the flag-setting that enables it.
+ * 
+ * @details Both the setting-handler and @ref check_config_settings gate the settings
+ * that are made with @link setting::enabled_by enabled_by @endlink through this
+ * function, so that a configuration is checked the same way as it is processed. Only
+ * the caller knows whether a flag-setting has been applied and with what value, which
+ * it tells with the given predicate.
+ * 
+ * @tparam Setting Type of the setting to check.
+ * @tparam Settings Container type that stores its contents in a contiguous sequence.
+ * @tparam IsSwitchedOff Type of the predicate.
+ * 
+ * @param[in] setting_obj Object of the setting to check.
+ * @param[in] settings Container with the settings, which contains the flag-setting.
+ * @param[in] is_switched_off Predicate that is invoked with the index and the object of
+ * the flag-setting, which returns true if the flag-setting has been applied with a
+ * value of false.
+ * 
+ * @return True if the setting is gated and its flag-setting is switched off. Otherwise,
+ * false.
+ */
+template<typename Setting, typename Settings, typename IsSwitchedOff>
+[[nodiscard]]
+constexpr auto is_disabled_by_flag(
+    Setting const& setting_obj,
+    Settings const& settings,
+    IsSwitchedOff&& is_switched_off
+) -> bool {
+    if (not setting_obj.is_gated()) return false;
+
+    auto const dependency = setting_obj.dependency();
+    auto index = std::uint_fast16_t{};
+    for (auto const& flag_obj : settings) {
+        if (flag_obj.id() == dependency) return is_switched_off(index, flag_obj);
+        ++index;
+    }
+    return false;
+}
+
 /**
  * @class setting_handler
  * 
@@ -44,14 +89,37 @@ namespace cfg {
  * 
  * @details Possibly unset or invalid settings are tracked with the use of error-codes.
  * 
+ * The setting-handler also keeps track of the values that it applied. When it processes
+ * a range of settings again, such as after a delta message or a re-read config file,
+ * only the settings of which the value changed are validated and applied again. The
+ * other settings leave their part of the main configuration object untouched.
+ * 
+ * Settings can also be validated one at a time while they are being parsed, with @ref
+ * validate_parsed_setting. The outcome is kept until the settings are applied, so that
+ * the values are converted while they are still in cache, whereas the actions are still
+ * performed in the order of the range of settings.
+ * 
+ * The validation mode is fixed in compile time, so that each setting is validated by
+ * the validator that is specialized for that mode, without dispatching on the mode for
+ * every setting. A config-handler takes it from the validation mode of its parser.
+ * 
  * @tparam Iterator Iterator type of the settings container.
  * @tparam MaxSettings Maximum number of settings to operate on.
+ * @tparam Mode Validation mode that specifies how each setting should be validated.
  */
 template<typename Iterator, int MaxSettings,
+    validation_mode Mode = validation_mode::config_file,
     typename = std::enable_if_t<is_random_access_iter_v<Iterator>>,
     typename = std::enable_if_t<(MaxSettings > 0)>>
 class setting_handler {
 public:
+    /**
+     * @var validation
+     * 
+     * @brief Indicates how the settings are validated.
+     */
+    static constexpr auto validation = Mode;
+
     /**
      * @brief Default constructs a setting handler.
      */
@@ -65,13 +133,11 @@ public:
      * @param[in,out] settings Container with settings. Each of these settings can be
      * validated and applied by invoking their self-contained validator and action
      * object, respectively.
-     * @param[in] mode Validation mode that specifies how each setting should be
-     * validated.
      */
     template<typename Settings,
         typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
-    constexpr setting_handler(Settings& settings, validation_mode mode)
-        : settings_{settings}, mode_{mode} {}
+    constexpr explicit setting_handler(Settings& settings)
+        : settings_{settings} {}
 
     /**
      * @brief Validates each setting by invoking their self-contained validator.
@@ -82,7 +148,7 @@ public:
      */
     constexpr auto validate_settings() -> void {
         for (auto const& setting_obj : settings_) {
-            if (auto const error = setting_obj.validate(mode_); error) {
+            if (auto const error = validate_setting(setting_obj); error) {
                 handle_invalid_setting(setting_obj, *error);
             }
         }
@@ -104,6 +170,31 @@ public:
         }
     }
 
+    /**
+     * @brief Validates a single setting as soon as its value has been parsed.
+     * 
+     * @details The outcome of the validation is kept until the next call to @ref
+     * apply_valid_settings, which then uses it instead of validating the setting again.
+     * Settings that are not set, or of which the value is the same as when it was last
+     * applied, are left to be handled when the settings are applied. The same goes for
+     * a setting of which the value is moved or replaced after it has been validated.
+     * A setting that is disabled by its flag-setting is not validated at all.
+     * 
+     * @param[in] index Index of the setting within the range of settings.
+     */
+    constexpr auto validate_parsed_setting(std::uint_fast16_t index) -> void {
+        if (index >= static_cast<std::uint_fast16_t>(settings_.distance())) return;
+
+        auto&& setting_obj = *(settings_.begin() + index);
+        auto const value = setting_obj.view_value();
+        validated_values[index] = nullptr;
+        if (not setting_obj.is_set() or is_disabled(setting_obj)) return;
+        if (is_applied_value(index, value)) return;
+
+        validated_errors[index] = validate_setting(setting_obj);
+        validated_values[index] = value.data();
+    }
+
     /**
      * @brief Applies the settings after successfully validating them.
      * 
@@ -112,6 +203,17 @@ public:
      * object). Otherwise, when a setting is not valid, a validation error is added to
      * one of the applicable error-buffers.
      * 
+     * A setting that has the same value as when it was last applied is skipped, unless
+     * the setting it depends on is applied in the same pass. Settings that are not set
+     * are always validated, so that they are still reported. Settings that have already
+     * been validated by @ref validate_parsed_setting are not validated again.
+     * 
+     * A setting that is made with @link setting::enabled_by enabled_by @endlink is
+     * neither validated, applied nor reported while its flag-setting is applied with a
+     * value of false, so its part of the configuration object keeps its current value.
+     * The flag-setting precedes the settings that it enables, so it is applied first
+     * within each pass.
+     * 
      * @tparam MainConfig Data-structure type of the configuration object.
      * 
      * @param[in,out] config Configuration object which can be used by a setting's
@@ -121,15 +223,76 @@ public:
     template<typename MainConfig,
         typename = std::enable_if_t<is_data_type_v<MainConfig>>>
     constexpr auto apply_valid_settings(MainConfig& config) -> void {
-        for (auto const& setting_obj : settings_) {
-            if (auto const error = setting_obj.validate(mode_); error) {
-                handle_invalid_setting(setting_obj, *error);
-            } else {
-                setting_obj.apply(config);
+        auto applied_now = std::array<bool, MaxSettings>{};
+        for (auto [it, end, idx] = settings_.enumerate(); it != end; ++it, ++idx) {
+            if (is_disabled(*it)) {
+                disable_setting(idx);
+                continue;
+            }
+            if (is_unchanged(*it, idx, applied_now)) continue;
+
+            applied_now[idx] = apply_setting(*it, idx, config);
+        }
+        validated_values = {};
+    }
+
+    /**
+     * @brief Validates and applies a single setting.
+     * 
+     * @details Works similarly to @ref apply_valid_settings, except that only the given
+     * setting is validated and applied, regardless of whether its value changed. The
+     * settings that depend on it and that have been applied before are applied again
+     * with their current values, since their actions read the value of the setting.
+     * Settings that it enables or disables are validated and applied, or disabled,
+     * accordingly. A setting that is disabled itself is accepted without validating it.
+     * 
+     * @tparam MainConfig Data-structure type of the configuration object.
+     * 
+     * @param[in] index Index of the setting within the range of settings.
+     * @param[in,out] config Configuration object which can be used by a setting's
+     * validator to read values from. It can also be used by its action-object to write
+     * converted values to.
+     * 
+     * @return True if the setting was valid and has been applied, false otherwise.
+     */
+    template<typename MainConfig,
+        typename = std::enable_if_t<is_data_type_v<MainConfig>>>
+    constexpr auto apply_valid_setting(std::uint_fast16_t index, MainConfig& config)
+    -> bool {
+        if (index >= static_cast<std::uint_fast16_t>(settings_.distance())) return false;
+
+        auto&& setting_obj = *(settings_.begin() + index);
+        validated_values[index] = nullptr;
+        if (is_disabled(setting_obj)) {
+            disable_setting(index);
+            return true;
+        }
+        if (not apply_setting(setting_obj, index, config)) return false;
+
+        for (auto [it, end, idx] = settings_.enumerate(); it != end; ++it, ++idx) {
+            if (it->dependency() != setting_obj.id()) continue;
+            if (is_disabled(*it)) {
+                disable_setting(idx);
+            } else if (applied[idx]) {
+                it->apply(config);
+            } else if (it->is_gated() and it->is_set()) {
+                validated_values[idx] = nullptr;
+                apply_setting(*it, idx, config);
             }
         }
+        return true;
     }
 
+    /**
+     * @brief Forgets which values have been applied.
+     * 
+     * @details The next time that the settings are applied, all of them are validated
+     * and applied again. This is required whenever the configuration object that the
+     * settings are applied to is replaced or reset.
+     */
+    constexpr auto reset_applied_settings() -> void
+    { applied = {}; }
+
     /**
      * @brief Reports any error that might have occurred during the validation process.
      * 
@@ -162,6 +325,33 @@ public:
     auto report_invalid_value_errors() const -> void
     { invalid_value_errors.log_errors("[ERROR]Some values are not valid:\n"); }
 
+    /**
+     * @brief Exports the validation errors as binary error records.
+     * 
+     * @details The unset-setting errors and the invalid-value errors are exported as
+     * separate records, one after another. Error-buffers without any errors are left
+     * out. Refer to @ref error_record_format for the layout of the records.
+     * 
+     * @param[out] buffer Buffer to write the error records to.
+     * @param[in] buffer_size Capacity of the buffer, in number of bytes.
+     * 
+     * @return Number of bytes written.
+     */
+    constexpr auto export_validation_errors(
+        std::byte* buffer, std::size_t buffer_size) const -> std::size_t
+    {
+        auto written = std::size_t{};
+        if (has_unset_setting_errors()) {
+            written += unset_setting_errors.export_errors(
+                error_source::unset_setting, buffer, buffer_size);
+        }
+        if (has_invalid_value_errors()) {
+            written += invalid_value_errors.export_errors(
+                error_source::invalid_value, buffer + written, buffer_size - written);
+        }
+        return written;
+    }
+
     /**
      * @brief Clears all of the buffered validation errors.
      * 
@@ -213,15 +403,7 @@ public:
      * @brief Gets the validation mode.
      */
     constexpr auto get_validation_mode() const -> validation_mode
-    { return mode_; }
-
-    /**
-     * @brief Sets the validation mode.
-     * 
-     * @param[in] mode New validation mode.
-     */
-    constexpr auto set_validation_mode(validation_mode mode) -> void
-    { mode_ = mode; }
+    { return Mode; }
 
     /**
      * @brief Sets the new range of settings to operate on.
@@ -229,6 +411,9 @@ public:
      * @details If the distance of the new range of settings exceeds the MaxSettings
      * value, the new range is ignored and no changes are made.
      * 
+     * The applied values are forgotten, since they most likely do not match the new
+     * range of settings.
+     * 
      * @param[in] settings New range of settings to operate on. This can also be a
      * reference to a container type, due to the extensive constructors of the range
      * class.
@@ -237,6 +422,7 @@ public:
         auto const distance = settings.distance();
         if (distance <= 0 or distance > MaxSettings) return;
         settings_ = settings;
+        reset_applied_settings();
     }
 
 private:
@@ -247,12 +433,163 @@ private:
      */
     using setting_t = typename range<Iterator>::value_type;
 
+    /**
+     * @brief Checks if a setting still has the value that was last applied.
+     * 
+     * @param[in] setting_obj Object of the setting to check.
+     * @param[in] index Index of the setting within the range of settings.
+     * @param[in] applied_now Indicates which settings are applied in the current pass.
+     * 
+     * @return True if the setting is set, its value was applied before and the setting
+     * it depends on (if any) is not applied in the current pass. Otherwise, false.
+     */
+    [[nodiscard]]
+    constexpr auto is_unchanged(
+        setting_t const& setting_obj,
+        std::uint_fast16_t index,
+        std::array<bool, MaxSettings> const& applied_now
+    ) const -> bool {
+        if (not setting_obj.is_set()) return false;
+        if (not is_applied_value(index, setting_obj.view_value())) return false;
+
+        auto const dependency = setting_obj.dependency();
+        if (dependency == setting_identifier::unspecified) return true;
+        for (auto [it, end, idx] = settings_.enumerate(); it != end; ++it, ++idx) {
+            if (it->id() == dependency) return not applied_now[idx];
+        }
+        return true;
+    }
+
+    /**
+     * @brief Checks if a setting still holds the value that it was last applied with.
+     * 
+     * @details The CRC-32 checksum of the value is compared with the one that was kept
+     * when it was applied, regardless of the size of the value. Unlike a general-purpose
+     * hash, the checksum tells apart any two values of the same size that differ within
+     * four consecutive bytes, which covers each integral value in its binary form.
+     * 
+     * @param[in] index Index of the setting within the range of settings.
+     * @param[in] value Current value of the setting.
+     * 
+     * @return True if the setting has been applied with the same value, false otherwise.
+     */
+    [[nodiscard]]
+    constexpr auto is_applied_value(std::uint_fast16_t index, std::string_view value) const
+    -> bool { return applied[index] and applied_checksums[index] == crc32(value); }
+
+    /**
+     * @brief Keeps the checksum of the value that a setting has been applied with.
+     * 
+     * @param[in] index Index of the setting within the range of settings.
+     * @param[in] value Value that the setting has been applied with.
+     */
+    constexpr auto keep_applied_value(std::uint_fast16_t index, std::string_view value)
+    -> void { applied_checksums[index] = crc32(value); }
+
+    /**
+     * @brief Checks if a setting is disabled by the flag-setting that enables it.
+     * 
+     * @param[in] setting_obj Object of the setting to check.
+     * 
+     * @return True if the setting is made with @link setting::enabled_by enabled_by
+     * @endlink and its flag-setting has been applied with a value of false. Otherwise,
+     * false.
+     */
+    [[nodiscard]]
+    constexpr auto is_disabled(setting_t const& setting_obj) const -> bool {
+        return is_disabled_by_flag(setting_obj, settings_,
+            [this](auto index, auto const& flag_obj)
+            { return applied[index] and not flag_obj.get_data().flag; });
+    }
+
+    /**
+     * @brief Skips a disabled setting.
+     * 
+     * @details The action of the setting is not invoked, so that its part of the
+     * configuration object keeps the value it had before the setting was disabled. The
+     * setting is not marked as applied, so that it is validated and applied as soon as
+     * it is enabled again, if it has a value by then.
+     * 
+     * @param[in] index Index of the setting within the range of settings.
+     */
+    constexpr auto disable_setting(std::uint_fast16_t index) -> void
+    { applied[index] = false; }
+
+    /**
+     * @brief Validates a setting and applies it if it is valid.
+     * 
+     * @tparam MainConfig Data-structure type of the configuration object.
+     * 
+     * @param[in] setting_obj Object of the setting to apply.
+     * @param[in] index Index of the setting within the range of settings.
+     * @param[in,out] config Configuration object to write to.
+     * 
+     * @return True if the setting was valid and has been applied, false otherwise.
+     */
+    template<typename MainConfig>
+    constexpr auto apply_setting(
+        setting_t const& setting_obj,
+        std::uint_fast16_t index,
+        MainConfig& config
+    ) -> bool {
+        if (auto const error = validation_result(setting_obj, index); error) {
+            handle_invalid_setting(setting_obj, *error);
+            applied[index] = false;
+            return false;
+        }
+        setting_obj.apply(config);
+        applied[index] = true;
+        keep_applied_value(index, setting_obj.view_value());
+        return true;
+    }
+
+    /**
+     * @brief Gets the outcome of validating a setting.
+     * 
+     * @details The outcome of @ref validate_parsed_setting is used as long as the value
+     * that it validated is still in place. Otherwise, the setting is validated now.
+     * 
+     * @param[in] setting_obj Object of the setting to validate.
+     * @param[in] index Index of the setting within the range of settings.
+     * 
+     * @return Validation error if the setting is not valid, or an empty optional if the
+     * setting is valid.
+     */
+    [[nodiscard]]
+    constexpr auto validation_result(
+        setting_t const& setting_obj,
+        std::uint_fast16_t index
+    ) const -> std::optional<validation_error> {
+        auto const validated_value = validated_values[index];
+        if (validated_value and validated_value == setting_obj.view_value().data()) {
+            return validated_errors[index];
+        }
+        return validate_setting(setting_obj);
+    }
+
+    /**
+     * @brief Validates a setting in the validation mode of the setting-handler.
+     * 
+     * @details The validator of the setting that is specialized for the mode is invoked
+     * directly, instead of dispatching on the mode within the validator itself.
+     * 
+     * @param[in] setting_obj Object of the setting to validate.
+     * 
+     * @return Validation error if the setting is not valid, or an empty optional if the
+     * setting is valid.
+     */
+    [[nodiscard]]
+    constexpr auto validate_setting(setting_t const& setting_obj) const
+    -> std::optional<validation_error>
+    { return setting_obj.template validate<Mode>(); }
+
     /**
      * @brief Handles a setting that was not validated successfully.
      * 
-     * @details If the invalid was not set and is marked as optional, no action is
-     * performed and the validation error is discarded. Otherwise, the validation error
-     * is added to the corresponding error-buffer.
+     * @details If the invalid setting was not set and is marked as optional, or if a
+     * delta message is validated (which only sets the settings that change), no action
+     * is performed and the validation error is discarded. Otherwise, the validation
+     * error is added to the corresponding error-buffer.
      * 
      * @param[in] setting_obj Object of an invalid setting.
      * @param[in] error_id Identifier of the validation error.
@@ -264,6 +601,7 @@ private:
         switch (error_id) {
         case validation_error::setting_unset:
             if (setting_obj.type() == setting_type::optional) return;
+            if constexpr (Mode == validation_mode::config_delta) return;
             unset_setting_errors.add_error(error_id, setting_obj.id());
             break;
         default:
@@ -275,19 +613,42 @@ private:
     range<Iterator> settings_;                       /**< Range of all the settings. */
     error_handler<MaxSettings> unset_setting_errors; /**< Stores unset-setting errors. */
     error_handler<MaxSettings> invalid_value_errors; /**< Stores invalid-value errors. */
-    validation_mode mode_{validation_mode::config_file}; /**< Mode of the validator. */
+    std::array<std::uint32_t, MaxSettings> applied_checksums{}; /**< Of applied values. */
+    std::array<bool, MaxSettings> applied{};                 /**< Indicates applied settings. */
+    std::array<char const*, MaxSettings> validated_values{}; /**< Values validated early. */
+    std::array<std::optional<validation_error>, MaxSettings>
+        validated_errors{};                   /**< Outcomes of the early validations. */
 };
 
 /**
- * @remark Allows a setting-handler to be constructed from a container type.
+ * @remark Allows a setting-handler that validates the settings of a config file to be
+ * constructed from a container type.
  * 
  * @tparam Settings Container type that stores its contents in a contiguous sequence.
  */
 template<typename Settings,
     typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
-setting_handler(Settings&, validation_mode)
+setting_handler(Settings&)
     -> setting_handler<iterator_type<Settings>, std::tuple_size<Settings>{}>;
 
+/**
+ * @brief Makes a setting-handler that operates on a container of settings.
+ * 
+ * @tparam Mode Validation mode that specifies how each setting should be validated.
+ * @tparam Settings Container type that stores its contents in a contiguous sequence.
+ * 
+ * @param[in,out] settings Container with settings to validate and apply.
+ * 
+ * @return Setting-handler object.
+ */
+template<validation_mode Mode, typename Settings,
+    typename = std::enable_if_t<is_contiguous_container_v<Settings>>>
+[[nodiscard]]
+constexpr auto make_setting_handler(Settings& settings) {
+    return setting_handler<iterator_type<Settings>, std::tuple_size<Settings>{}, Mode>{
+        settings};
+}
+
 } // namespace cfg
 
 #endif
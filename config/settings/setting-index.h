@@ -0,0 +1,134 @@
+/**
+ * @file setting-index.h
+ * @brief Direct lookup of settings by their identifier.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_CONFIG_SETTINGS_SETTING_INDEX_H
+#define CFG_CONFIG_SETTINGS_SETTING_INDEX_H
+
+#include "setting-identifiers.h"
+
+#include <utilities/enum.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @namespace cfg
+ * 
+ * @brief Contains everything related to the processing of configuration files.
+ */
+namespace cfg {
+
+/**
+ * @brief Counts the number of setting-identifiers that a container of settings spans.
+ * 
+ * @tparam Settings Container type of the settings.
+ * 
+ * @param[in] settings Container of settings.
+ * 
+ * @return One more than the underlying value of the highest setting-identifier.
+ */
+template<typename Settings>
+[[nodiscard]]
+constexpr auto count_setting_ids(Settings const& settings) -> std::size_t {
+    auto count = std::size_t{};
+    for (auto const& setting_obj : settings) {
+        auto const id = static_cast<std::size_t>(to_underlying(setting_obj.id()));
+        if (id >= count) count = id + 1;
+    }
+    return count;
+}
+
+/**
+ * @class setting_index
+ * 
+ * @brief Maps setting-identifiers to the index of their setting within a container.
+ * 
+ * @details The setting-identifiers are consecutive, so the underlying value of an
+ * identifier is used as the position within the index directly. Finding a setting thus
+ * takes a single load, rather than comparing the identifier with every setting. The
+ * index is intended to be made in compile time, so that it resides in read-only memory.
+ * 
+ * @tparam IdCount Number of setting-identifiers that the index spans.
+ */
+template<std::size_t IdCount,
+    typename = std::enable_if_t<(IdCount > 0 and IdCount <= UINT8_MAX)>>
+class setting_index {
+public:
+    /**
+     * @var not_found
+     * 
+     * @brief Index of an identifier that does not belong to any setting.
+     */
+    static constexpr auto not_found = std::size_t{UINT8_MAX};
+
+    /**
+     * @brief Constructs the index of a container of settings.
+     * 
+     * @details If multiple settings have the same identifier, the first one is indexed.
+     * 
+     * @tparam Settings Container type of the settings.
+     * 
+     * @param[in] settings Container of settings.
+     */
+    template<typename Settings>
+    constexpr explicit setting_index(Settings const& settings) {
+        for (auto& index : indices) index = static_cast<std::uint8_t>(not_found);
+
+        auto index = std::size_t{};
+        for (auto const& setting_obj : settings) {
+            auto const id = static_cast<std::size_t>(to_underlying(setting_obj.id()));
+            if (indices[id] == not_found) indices[id] = static_cast<std::uint8_t>(index);
+            ++index;
+        }
+    }
+
+    /**
+     * @brief Finds the index of the setting with a given identifier.
+     * 
+     * @param[in] id Identifier of the setting.
+     * 
+     * @return Index of the setting, or @ref not_found if no setting has the identifier.
+     */
+    [[nodiscard]]
+    constexpr auto find(setting_identifier id) const -> std::size_t {
+        auto const position = static_cast<std::size_t>(to_underlying(id));
+        return position < IdCount ? std::size_t{indices[position]} : not_found;
+    }
+
+private:
+    std::array<std::uint8_t, IdCount> indices{}; /**< Index of each identifier. */
+};
+
+/**
+ * @brief Makes the index of a container of settings in compile time.
+ * 
+ * @tparam GetSettings Function that returns the container of settings in compile time,
+ * such as @ref get_default_settings.
+ * 
+ * @return Index sized to span exactly the identifiers of the settings.
+ */
+template<auto GetSettings>
+[[nodiscard]]
+constexpr auto make_setting_index() {
+    constexpr auto id_count = count_setting_ids(GetSettings());
+    return setting_index<id_count>{GetSettings()};
+}
+
+} // namespace cfg
+
+#endif
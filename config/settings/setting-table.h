@@ -0,0 +1,1071 @@
+/**
+ * @file setting-table.h
+ * @brief Struct-of-arrays container of settings, of which only the values reside in RAM.
+ * 
+ * @version 1.0
+ * @date December 2021
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_CONFIG_SETTINGS_SETTING_TABLE_H
+#define CFG_CONFIG_SETTINGS_SETTING_TABLE_H
+
+#include "setting.h"
+#include "setting-index.h"
+
+#include <parsing/tag-pool.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <optional>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @namespace cfg
+ * 
+ * @brief Contains everything related to the processing of configuration files.
+ */
+namespace cfg {
+
+/**
+ * @namespace detail
+ * 
+ * @brief Provides helper/meta functions/types local to this header file.
+ */
+namespace detail {
+
+/**
+ * @brief Collects a single property of each setting into an array.
+ * 
+ * @tparam Settings Container type of the settings.
+ * @tparam Getter Type of a callable that gets the property of a setting.
+ * 
+ * @param[in] settings Container of settings to collect the property of.
+ * @param[in] get Callable that gets the property of a setting.
+ * 
+ * @return Array containing the property of each setting, in the same order.
+ * 
+ * @{
+ */
+template<typename Settings, typename Getter, std::size_t... Indices>
+[[nodiscard]]
+constexpr auto collect_property(
+    Settings const& settings, Getter get, std::index_sequence<Indices...>)
+{
+    using property_type = std::decay_t<decltype(get(settings[0]))>;
+    return std::array<property_type, sizeof...(Indices)>{get(settings[Indices])...};
+}
+
+template<typename Settings, typename Getter>
+[[nodiscard]]
+constexpr auto collect_property(Settings const& settings, Getter get) {
+    constexpr auto setting_count = std::tuple_size_v<Settings>;
+    return collect_property(settings, get, std::make_index_sequence<setting_count>{});
+}
+/** @} */
+
+} // namespace detail
+
+/**
+ * @class setting_table
+ * 
+ * @brief Stores a container of settings as separate arrays of their properties.
+ * 
+ * @details The description of each setting, i.e. its identifier, tag-names, bitspan,
+ * type, dependency, gate, validator and action, is known in compile time. These
+ * properties are collected into constant arrays, which are placed in read-only memory,
+ * so that only the values, their sizes and the cached converted values take up RAM.
+ * 
+ * Since each property is stored in an array of its own, a loop that only needs one of
+ * them (such as the bitspans while decoding a config message) does not have to walk
+ * through the other properties. The tag-names of the settings are resolved with a @ref
+ * tag_table, which is made in compile time as well.
+ * 
+ * Each unique tag-name is interned once within a @ref tag_pool, so that the paths of
+ * tag-names are stored as small identifiers rather than copies of pointers.
+ * 
+ * The elements of the table are accessed through lightweight references that have the
+ * same interface as a @ref setting. As such, the table can be used in place of an array
+ * of settings by the parsers and the setting-handler.
+ * 
+ * The values of all the settings share a single arena, in which each setting occupies
+ * only as many bytes as its value requires. Settings that hold small values therefore
+ * do not take up a full value-buffer, while a value may still be as long as
+ * MaxValueSize characters. When a value no longer fits in its slot, it is moved to the
+ * free end of the arena. The arena is compacted whenever that end runs out of space.
+ * 
+ * Unlike a @ref setting, the converted value is cached without an optional wrapper. A
+ * setting is only applied after it has been validated successfully, so the presence of
+ * the cached data does not have to be tracked separately.
+ * 
+ * @tparam GetSettings Function that returns the container of settings in compile time,
+ * such as @ref get_default_settings.
+ * @tparam ArenaSize Number of bytes that the values of all the settings share.
+ * @tparam MaxValueSize Maximum number of characters of a single value.
+ */
+template<auto GetSettings,
+    std::size_t ArenaSize = 16 * std::tuple_size_v<decltype(GetSettings())>,
+    std::size_t MaxValueSize = decltype(GetSettings())::value_type::max_value_size,
+    typename = std::enable_if_t<(ArenaSize <= UINT16_MAX and MaxValueSize <= UINT8_MAX)>>
+class setting_table {
+    /**
+     * @typedef descriptions_type
+     * 
+     * @brief Type of the container of settings that describes the table.
+     */
+    using descriptions_type = decltype(GetSettings());
+
+    /**
+     * @typedef description_type
+     * 
+     * @brief Type of the setting that describes a single element of the table.
+     */
+    using description_type = typename descriptions_type::value_type;
+
+public:
+    /**
+     * @var setting_count
+     * 
+     * @brief Number of settings stored by the table.
+     */
+    static constexpr auto setting_count = std::tuple_size_v<descriptions_type>;
+
+    /**
+     * @var max_tag_depth
+     * 
+     * @brief Maximum depth of the path of tag-names.
+     */
+    static constexpr auto max_tag_depth = int{description_type::max_tag_depth};
+
+    /**
+     * @var max_value_size
+     * 
+     * @brief Maximum number of characters that a buffered value can hold.
+     */
+    static constexpr auto max_value_size = std::size_t{MaxValueSize};
+
+    /**
+     * @var max_tag_length
+     * 
+     * @brief Number of characters of the longest tag-name of any of the settings.
+     */
+    static constexpr auto max_tag_length = cfg::max_tag_length(GetSettings());
+
+    /**
+     * @var arena_size
+     * 
+     * @brief Number of bytes that the values of all the settings share.
+     */
+    static constexpr auto arena_size = std::size_t{ArenaSize};
+
+    template<bool IsConst>
+    class basic_reference;
+
+    template<bool IsConst>
+    class basic_iterator;
+
+    /**
+     * @{
+     * @brief Types of the container interface.
+     */
+    using value_type      = basic_reference<false>;
+    using reference       = basic_reference<false>;
+    using const_reference = basic_reference<true>;
+    using iterator        = basic_iterator<false>;
+    using const_iterator  = basic_iterator<true>;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    /** @} */
+
+    /**
+     * @brief Default constructs a setting table.
+     * 
+     * @details None of the settings have a value.
+     */
+    constexpr setting_table() = default;
+
+    /**
+     * @brief Gets an iterator to the first setting.
+     * 
+     * @{
+     */
+    [[nodiscard]]
+    constexpr auto begin() -> iterator
+    { return {this, 0}; }
+
+    [[nodiscard]]
+    constexpr auto begin() const -> const_iterator
+    { return {this, 0}; }
+
+    [[nodiscard]]
+    constexpr auto cbegin() const -> const_iterator
+    { return begin(); }
+    /** @} */
+
+    /**
+     * @brief Gets an iterator past the last setting.
+     * 
+     * @{
+     */
+    [[nodiscard]]
+    constexpr auto end() -> iterator
+    { return {this, difference_type{setting_count}}; }
+
+    [[nodiscard]]
+    constexpr auto end() const -> const_iterator
+    { return {this, difference_type{setting_count}}; }
+
+    [[nodiscard]]
+    constexpr auto cend() const -> const_iterator
+    { return end(); }
+    /** @} */
+
+    /**
+     * @brief Gets the number of settings.
+     */
+    [[nodiscard]]
+    constexpr auto size() const -> size_type
+    { return setting_count; }
+
+    /**
+     * @brief Accesses the setting at a given index.
+     * 
+     * @details This function does not perform any bounds checking.
+     * 
+     * @param[in] index Index of the setting to access.
+     * 
+     * @return Reference to the setting.
+     * 
+     * @{
+     */
+    [[nodiscard]]
+    constexpr auto operator[](size_type index) -> reference
+    { return {this, index}; }
+
+    [[nodiscard]]
+    constexpr auto operator[](size_type index) const -> const_reference
+    { return {this, index}; }
+    /** @} */
+
+    /**
+     * @brief Finds the index of the setting with a given identifier.
+     * 
+     * @details The index is looked up in a @ref setting_index that is made in compile
+     * time, so no setting has to be compared with the identifier.
+     * 
+     * @param[in] id Identifier of the setting.
+     * 
+     * @return Index of the setting, or the number of settings if no setting has the
+     * identifier.
+     */
+    [[nodiscard]]
+    static constexpr auto find_index(setting_identifier id) -> size_type {
+        auto const index = id_index.find(id);
+        return index == id_index.not_found ? setting_count : index;
+    }
+
+private:
+    /**
+     * @var descriptions
+     * 
+     * @brief Container of settings from which the properties are collected. It is only
+     * used in compile time.
+     */
+    static constexpr auto descriptions = GetSettings();
+
+    /**
+     * @{
+     * @brief Properties of the settings, which reside in read-only memory.
+     */
+    static constexpr auto ids = detail::collect_property(
+        descriptions, [](auto const& setting_obj) { return setting_obj.id(); });
+    static constexpr auto tag_names
+        = tag_pool<count_unique_tags(descriptions)>{descriptions};
+    static constexpr auto tag_ids = detail::collect_property(
+        descriptions, [](auto const& setting_obj) {
+            auto ids = array<tag_id, max_tag_depth>{};
+            for (auto depth = 0; depth < max_tag_depth; ++depth) {
+                ids[depth] = tag_names.find(setting_obj.tag(depth));
+            }
+            return ids;
+        });
+    static constexpr auto bitspans = detail::collect_property(
+        descriptions, [](auto const& setting_obj) { return setting_obj.config_bits(); });
+    static constexpr auto types = detail::collect_property(
+        descriptions, [](auto const& setting_obj) { return setting_obj.type(); });
+    static constexpr auto dependencies = detail::collect_property(
+        descriptions, [](auto const& setting_obj) { return setting_obj.dependency(); });
+    static constexpr auto gates = detail::collect_property(
+        descriptions, [](auto const& setting_obj) { return setting_obj.is_gated(); });
+    static constexpr auto validators = detail::collect_property(
+        descriptions, [](auto const& setting_obj) { return setting_obj.validator(); });
+    static constexpr auto actions = detail::collect_property(
+        descriptions, [](auto const& setting_obj) { return setting_obj.action(); });
+    /** @} */
+
+    /**
+     * @brief Validates a value with the validator of a given setting, in a validation
+     * mode that is fixed in compile time.
+     * 
+     * @details Both the validator and the validation mode are constants, so that the
+     * validator is called directly and its choice of validation function for the mode is
+     * resolved in compile time.
+     * 
+     * @tparam Mode Validation mode in effect.
+     * @tparam Index Index of the setting.
+     * 
+     * @param[in] value Value to validate.
+     * @param[in] decoded Integral value that was last set, as passed to the validator.
+     */
+    template<validation_mode Mode, std::size_t Index>
+    [[nodiscard]]
+    static constexpr auto validate_fixed(std::string_view value, setting_data decoded)
+    { return validators[Index](value, Mode, decoded); }
+
+    /**
+     * @brief Makes the validators of all the settings for a given validation mode.
+     * 
+     * @tparam Mode Validation mode in effect.
+     * @tparam Indices Indices of all the settings.
+     */
+    template<validation_mode Mode, std::size_t... Indices>
+    [[nodiscard]]
+    static constexpr auto make_mode_validators(std::index_sequence<Indices...>)
+    { return std::array{&validate_fixed<Mode, Indices>...}; }
+
+    /**
+     * @var mode_validators
+     * 
+     * @brief Validators of the settings that are specialized for a validation mode.
+     * 
+     * @tparam Mode Validation mode in effect.
+     */
+    template<validation_mode Mode>
+    static constexpr auto mode_validators
+        = make_mode_validators<Mode>(std::make_index_sequence<setting_count>{});
+
+    /**
+     * @var id_index
+     * 
+     * @brief Index of the settings by their identifier.
+     */
+    static constexpr auto id_index = make_setting_index<GetSettings>();
+
+    /**
+     * @brief Gets the number of characters that the next value of a setting can hold.
+     * 
+     * @details The slot of the setting itself is reused, or otherwise all of the space
+     * that the other settings leave free after compacting the arena.
+     * 
+     * @param[in] index Index of the setting.
+     */
+    [[nodiscard]]
+    constexpr auto value_capacity(std::size_t index) const -> std::size_t {
+        auto used = std::size_t{};
+        for (auto idx = std::size_t{}; idx < setting_count; ++idx) {
+            if (idx != index) used += value_sizes[idx];
+        }
+        auto const capacity = std::max(std::size_t{slot_sizes[index]}, arena_size - used);
+        return std::min(capacity, max_value_size);
+    }
+
+    /**
+     * @brief Reserves space within the arena for the next value of a setting.
+     * 
+     * @details The value is cleared. If the slot of the setting is too small, a new slot
+     * is taken from the free end of the arena, which is compacted when necessary.
+     * 
+     * @param[in] index Index of the setting.
+     * @param[in] size Number of bytes to reserve.
+     * 
+     * @return Number of bytes that were reserved, which is less than the requested size
+     * if the arena could not provide enough space.
+     */
+    constexpr auto reserve_value(std::size_t index, std::size_t size) -> std::size_t {
+        size = std::min(size, max_value_size);
+        value_sizes[index] = 0;
+        if (size <= slot_sizes[index]) return size;
+
+        slot_sizes[index] = 0;
+        if (arena_size - arena_top < size) compact_arena();
+
+        size = std::min(size, arena_size - arena_top);
+        offsets[index] = static_cast<std::uint16_t>(arena_top);
+        slot_sizes[index] = static_cast<std::uint8_t>(size);
+        arena_top += size;
+        return size;
+    }
+
+    /**
+     * @brief Sets the size of the value that was written into the reserved slot.
+     * 
+     * @details If the slot of the setting sits at the free end of the arena, the unused
+     * remainder of the slot is given back.
+     * 
+     * @param[in] index Index of the setting.
+     * @param[in] size Number of bytes written, limited to the size of the slot.
+     */
+    constexpr auto commit_value(std::size_t index, std::size_t size) -> void {
+        size = std::min(size, std::size_t{slot_sizes[index]});
+        if (offsets[index] + slot_sizes[index] == arena_top) {
+            arena_top = offsets[index] + size;
+            slot_sizes[index] = static_cast<std::uint8_t>(size);
+        }
+        value_sizes[index] = static_cast<std::uint8_t>(size);
+    }
+
+    /**
+     * @brief Moves all the values to the beginning of the arena, in their current order.
+     * 
+     * @details The slots of settings that have no value are released, and every other
+     * slot is shrunk to the size of its value.
+     */
+    constexpr auto compact_arena() -> void {
+        auto top = std::size_t{};
+        auto scan = std::size_t{};
+        while (true) {
+            auto next = setting_count;
+            for (auto idx = std::size_t{}; idx < setting_count; ++idx) {
+                if (slot_sizes[idx] == 0 or offsets[idx] < scan) continue;
+                if (next == setting_count or offsets[idx] < offsets[next]) next = idx;
+            }
+            if (next == setting_count) break;
+
+            scan = offsets[next] + std::size_t{1};
+            auto const source = arena.data() + offsets[next];
+            cfg::copy_n(source, value_sizes[next], arena.data() + top);
+            offsets[next] = static_cast<std::uint16_t>(top);
+            slot_sizes[next] = value_sizes[next];
+            top += value_sizes[next];
+        }
+        for (auto idx = std::size_t{}; idx < setting_count; ++idx) {
+            if (value_sizes[idx] == 0) slot_sizes[idx] = 0;
+        }
+        arena_top = top;
+    }
+
+    std::array<char, arena_size> arena{};                     /**< Values of all settings. */
+    std::array<std::uint16_t, setting_count> offsets{};       /**< Offsets of the slots. */
+    std::array<std::uint8_t, setting_count> slot_sizes{};     /**< Sizes of the slots. */
+    std::array<std::uint8_t, setting_count> value_sizes{};    /**< Sizes of the values. */
+    std::size_t arena_top{};                                  /**< Start of free space. */
+    mutable std::array<setting_data, setting_count> caches{}; /**< Converted values. */
+};
+
+/**
+ * @class setting_table::basic_reference
+ * 
+ * @brief Refers to a single setting of a setting table.
+ * 
+ * @details Provides the same interface as a @ref setting. A reference does not own any
+ * data, so it is cheap to copy. Whether the value of the setting can be modified depends
+ * on the constness of the table, rather than the constness of the reference itself.
+ * 
+ * @tparam IsConst Indicates whether the referenced table is read-only.
+ */
+template<auto GetSettings, std::size_t ArenaSize, std::size_t MaxValueSize, typename E>
+template<bool IsConst>
+class setting_table<GetSettings, ArenaSize, MaxValueSize, E>::basic_reference {
+    /**
+     * @typedef table_type
+     * 
+     * @brief Type of the (const-qualified) table.
+     */
+    using table_type = std::conditional_t<IsConst, setting_table const, setting_table>;
+
+public:
+    /**
+     * @{
+     * @brief Properties and types that match those of a @ref setting.
+     */
+    static constexpr auto max_tag_depth = setting_table::max_tag_depth;
+    static constexpr auto max_value_size = setting_table::max_value_size;
+    using tag_type = typename description_type::tag_type;
+    using setting_id = typename description_type::setting_id;
+    /** @} */
+
+    /**
+     * @var max_tag_length
+     * 
+     * @brief Number of characters of the longest tag-name of any setting of the table.
+     */
+    static constexpr auto max_tag_length = setting_table::max_tag_length;
+
+    /**
+     * @brief Constructs a reference to a setting of a table.
+     * 
+     * @param[in] table Pointer to the table.
+     * @param[in] index Index of the setting within the table.
+     */
+    constexpr basic_reference(table_type* table, std::size_t index)
+        : table_{table}, index_{index} {}
+
+    /**
+     * @brief Converts a reference to a modifiable setting to a read-only reference.
+     * 
+     * @param[in] other Reference to convert.
+     */
+    template<bool IsConstOther,
+        typename = std::enable_if_t<(IsConst and not IsConstOther)>>
+    constexpr basic_reference(basic_reference<IsConstOther> const& other)
+        : table_{other.table_}, index_{other.index_} {}
+
+    /**
+     * @brief Validates the stored value and caches the converted data.
+     * 
+     * @details Refer to @ref setting::validate for more details.
+     * 
+     * @tparam Ts Types of the optional arguments.
+     * 
+     * @param[in] args Optional number of arguments that will be forwarded to the
+     * validator.
+     * 
+     * @return An optional validation error.
+     */
+    template<typename... Ts,
+        typename = std::enable_if_t<std::is_invocable_v<
+            decltype(validators[0]), std::string_view, Ts&&..., setting_data>>>
+    constexpr auto validate(Ts&&... args) const -> std::optional<validation_error> {
+        if (not is_set()) return validation_error::setting_unset;
+
+        auto const [data, status] = validators[index_](
+            view_value(), std::forward<Ts>(args)..., table_->caches[index_]);
+        table_->caches[index_] = data.value_or(setting_data{});
+        return status;
+    }
+
+    /**
+     * @brief Validates the stored value in a validation mode that is fixed in compile
+     * time, and caches the converted data.
+     * 
+     * @details The validator of the setting is specialized for the validation mode, so
+     * that the validation mode is not dispatched on for every validated value.
+     * 
+     * @tparam Mode Validation mode in effect.
+     * 
+     * @return An optional validation error.
+     */
+    template<validation_mode Mode,
+        typename = std::enable_if_t<std::is_invocable_v<
+            decltype(validators[0]), std::string_view, validation_mode, setting_data>>>
+    constexpr auto validate() const -> std::optional<validation_error> {
+        if (not is_set()) return validation_error::setting_unset;
+
+        auto const [data, status] = mode_validators<Mode>[index_](
+            view_value(), table_->caches[index_]);
+        table_->caches[index_] = data.value_or(setting_data{});
+        return status;
+    }
+
+    /**
+     * @brief Applies the action of the setting with the cached converted data.
+     * 
+     * @details Refer to @ref setting::apply for more details.
+     * 
+     * @tparam Ts Types of the optional arguments.
+     * 
+     * @param[in] args Optional number of arguments that will be forwarded to the action.
+     * 
+     * @return Matches the return value of the action.
+     */
+    template<typename... Ts,
+        typename = std::enable_if_t<std::is_invocable_v<
+            decltype(actions[0]), setting_data, Ts&&...>>>
+    constexpr auto apply(Ts&&... args) const -> decltype(auto)
+    { return actions[index_](table_->caches[index_], std::forward<Ts>(args)...); }
+
+    /**
+     * @brief Checks whether the tag at a given index is empty.
+     * 
+     * @param[in] index Index of the possibly empty tag.
+     */
+    [[nodiscard]]
+    constexpr auto is_tag_empty(int index) const -> bool
+    { return tag_ids[index_][index] == empty_tag_id; }
+
+    /**
+     * @brief Checks whether the setting has been set and stores a value.
+     */
+    [[nodiscard]]
+    constexpr auto is_set() const -> bool
+    { return table_->value_sizes[index_] != 0; }
+
+    /**
+     * @brief Gets the setting's identifier.
+     */
+    [[nodiscard]]
+    constexpr auto id() const -> setting_id
+    { return ids[index_]; }
+
+    /**
+     * @brief Gets the type of setting.
+     */
+    [[nodiscard]]
+    constexpr auto type() const -> setting_type
+    { return types[index_]; }
+
+    /**
+     * @brief Gets the span of bits that refers to some part within a config message.
+     */
+    [[nodiscard]]
+    constexpr auto config_bits() const -> bitspan
+    { return bitspans[index_]; }
+
+    /**
+     * @brief Gets the identifier of the setting that this setting depends on.
+     */
+    [[nodiscard]]
+    constexpr auto dependency() const -> setting_id
+    { return dependencies[index_]; }
+
+    /**
+     * @brief Checks whether the setting only takes effect while the setting it depends
+     * on is enabled.
+     */
+    [[nodiscard]]
+    constexpr auto is_gated() const -> bool
+    { return gates[index_]; }
+
+    /**
+     * @brief Gets the name of a tag at a given depth.
+     */
+    [[nodiscard]]
+    constexpr auto tag(std::int_fast8_t depth) const -> tag_type
+    { return tag_names.name(tag_ids[index_][depth]); }
+
+    /**
+     * @brief Gets the identifier of the interned tag-name at a given depth.
+     * 
+     * @details Two settings share a tag-name at some depth if their identifiers match.
+     */
+    [[nodiscard]]
+    constexpr auto interned_tag(std::int_fast8_t depth) const -> tag_id
+    { return tag_ids[index_][depth]; }
+
+    /**
+     * @brief Finds the identifier of an interned tag-name.
+     * 
+     * @param[in] tag Tag-name to find.
+     * 
+     * @return Identifier of the tag-name, or @ref unknown_tag_id if none of the settings
+     * of the table have the tag-name.
+     */
+    [[nodiscard]]
+    static constexpr auto find_tag(char const* tag) -> tag_id
+    { return tag_names.find(tag); }
+
+    /**
+     * @brief Gets all of the tag-names.
+     */
+    [[nodiscard]]
+    constexpr auto tags() const -> node_sz<max_tag_depth>
+    { return make_tags(std::make_index_sequence<max_tag_depth>{}); }
+
+    /**
+     * @brief Gets the invocable validator object.
+     */
+    [[nodiscard]]
+    constexpr auto validator() const -> auto const&
+    { return validators[index_]; }
+
+    /**
+     * @brief Gets the invocable action object.
+     */
+    [[nodiscard]]
+    constexpr auto action() const -> auto const&
+    { return actions[index_]; }
+
+    /**
+     * @brief Gets the converted data that was cached by the last validation.
+     */
+    [[nodiscard]]
+    constexpr auto get_data() const -> setting_data
+    { return table_->caches[index_]; }
+
+    /**
+     * @brief Gets a view of the buffered value.
+     * 
+     * @return String-view of the buffered value. If no value is set, the string-view is
+     * empty.
+     */
+    [[nodiscard]]
+    constexpr auto view_value() const -> std::string_view {
+        auto const offset = table_->offsets[index_];
+        return {table_->arena.data() + offset, table_->value_sizes[index_]};
+    }
+
+    /**
+     * @brief Gets the number of characters that the next value of the setting can hold.
+     * 
+     * @details This is limited by #max_value_size, as well as by the space that the
+     * values of the other settings of the table leave free.
+     */
+    [[nodiscard]]
+    constexpr auto value_capacity() const -> std::size_t
+    { return table_->value_capacity(index_); }
+
+    /**
+     * @brief Sets the buffered value to the contents of a given string.
+     * 
+     * @details Refer to @ref setting::set_value for more details.
+     * 
+     * @param[in] content Contents of a string.
+     */
+    template<bool IsConstSelf = IsConst,
+        typename = std::enable_if_t<not IsConstSelf>>
+    constexpr auto set_value(std::string_view content) const -> void {
+        auto const value_size = table_->reserve_value(index_, content.size());
+        cfg::copy_n(content.data(), value_size, value_data());
+        table_->commit_value(index_, value_size);
+        table_->caches[index_] = decode_binary_value(view_value());
+    }
+
+    /**
+     * @brief Gets the value-buffer to write the contents of a value into directly.
+     * 
+     * @details Reserves as many characters as @ref value_capacity reports, which is the
+     * maximum number of characters that may be written. The size of the written value
+     * is to be set afterwards with @ref set_value_size, which gives back the unused part
+     * of the reserved space.
+     */
+    template<bool IsConstSelf = IsConst,
+        typename = std::enable_if_t<not IsConstSelf>>
+    [[nodiscard]]
+    auto value_buffer() const -> char* {
+        table_->reserve_value(index_, value_capacity());
+        return value_data();
+    }
+
+    /**
+     * @brief Sets the size of a value that is written into the value-buffer directly.
+     * 
+     * @param[in] size Number of characters written, limited to the reserved space.
+     */
+    template<bool IsConstSelf = IsConst,
+        typename = std::enable_if_t<not IsConstSelf>>
+    auto set_value_size(std::size_t size) const -> void
+    { table_->commit_value(index_, size); }
+
+    /**
+     * @brief Sets the buffered value to the binary equivalence of a given integral value.
+     * 
+     * @details Refer to @ref setting::set_value for more details.
+     * 
+     * @param[in] content Content of an integral value.
+     * @param[in] size Number of bytes to store.
+     */
+    template<bool IsConstSelf = IsConst,
+        typename = std::enable_if_t<not IsConstSelf>>
+    constexpr auto set_value(
+        std::uint_fast64_t content, std::size_t size = sizeof(std::uint_fast64_t)) const
+        -> void
+    {
+        size = table_->reserve_value(index_, std::min(size, sizeof(content)));
+        std::memcpy(value_data(), &content, size);
+        table_->commit_value(index_, size);
+        table_->caches[index_] = setting_data{static_cast<std::uint32_t>(content)};
+    }
+
+    /**
+     * @brief Compares two references for (in)equality.
+     * 
+     * @param[in] lhs Reference on the left-hand side of the operator.
+     * @param[in] rhs Reference on the right-hand side of the operator.
+     * 
+     * @return Two references are considered to be equal when the identifiers of the
+     * settings they refer to match, alike to a @ref setting.
+     * 
+     * @{
+     */
+    [[nodiscard]]
+    friend constexpr auto operator!=(
+        basic_reference const& lhs, basic_reference const& rhs) -> bool
+    { return not (lhs == rhs); }
+
+    [[nodiscard]]
+    friend constexpr auto operator==(
+        basic_reference const& lhs, basic_reference const& rhs) -> bool
+    { return lhs.id() == rhs.id(); }
+    /** @} */
+
+private:
+    /**
+     * @brief Gets a pointer to the slot of the setting within the arena.
+     */
+    [[nodiscard]]
+    constexpr auto value_data() const -> char*
+    { return table_->arena.data() + table_->offsets[index_]; }
+
+    /**
+     * @brief Makes a node of the tag-names of the setting.
+     * 
+     * @tparam Depths Sequence of all tag-depths.
+     */
+    template<std::size_t... Depths>
+    [[nodiscard]]
+    constexpr auto make_tags(std::index_sequence<Depths...>) const
+        -> node_sz<max_tag_depth>
+    { return node_sz<max_tag_depth>{tag(Depths)...}; }
+
+    template<bool>
+    friend class basic_reference;
+
+    table_type* table_;  /**< Table that contains the setting. */
+    std::size_t index_;  /**< Index of the setting within the table. */
+};
+
+/**
+ * @class setting_table::basic_iterator
+ * 
+ * @brief Random-access iterator over the settings of a setting table.
+ * 
+ * @details Dereferencing the iterator yields a @ref basic_reference by value.
+ * 
+ * @tparam IsConst Indicates whether the iterated table is read-only.
+ */
+template<auto GetSettings, std::size_t ArenaSize, std::size_t MaxValueSize, typename E>
+template<bool IsConst>
+class setting_table<GetSettings, ArenaSize, MaxValueSize, E>::basic_iterator {
+    /**
+     * @typedef table_type
+     * 
+     * @brief Type of the (const-qualified) table.
+     */
+    using table_type = std::conditional_t<IsConst, setting_table const, setting_table>;
+
+public:
+    /**
+     * @struct arrow_proxy
+     * 
+     * @brief Allows the member-access operator to be used on an iterator, by holding the
+     * reference that it points to.
+     */
+    struct arrow_proxy {
+        basic_reference<IsConst> ref; /**< Reference to the setting. */
+
+        /**
+         * @brief Accesses the reference to the setting.
+         */
+        constexpr auto operator->() const -> basic_reference<IsConst> const*
+        { return &ref; }
+    };
+
+    /**
+     * @{
+     * @brief Types of the iterator interface.
+     */
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = basic_reference<IsConst>;
+    using difference_type   = std::ptrdiff_t;
+    using reference         = basic_reference<IsConst>;
+    using pointer           = arrow_proxy;
+    /** @} */
+
+    /**
+     * @brief Default constructs a singular iterator.
+     */
+    constexpr basic_iterator() = default;
+
+    /**
+     * @brief Constructs an iterator to a setting of a table.
+     * 
+     * @param[in] table Pointer to the table.
+     * @param[in] index Index of the setting within the table.
+     */
+    constexpr basic_iterator(table_type* table, difference_type index)
+        : table_{table}, index_{index} {}
+
+    /**
+     * @brief Converts an iterator over a modifiable table to a read-only iterator.
+     * 
+     * @param[in] other Iterator to convert.
+     */
+    template<bool IsConstOther,
+        typename = std::enable_if_t<(IsConst and not IsConstOther)>>
+    constexpr basic_iterator(basic_iterator<IsConstOther> const& other)
+        : table_{other.table_}, index_{other.index_} {}
+
+    /**
+     * @brief Dereferences the iterator.
+     */
+    [[nodiscard]]
+    constexpr auto operator*() const -> reference
+    { return {table_, static_cast<std::size_t>(index_)}; }
+
+    /**
+     * @brief Accesses a member of the setting the iterator points to.
+     */
+    [[nodiscard]]
+    constexpr auto operator->() const -> pointer
+    { return {**this}; }
+
+    /**
+     * @brief Accesses the setting at an offset relative to the iterator.
+     * 
+     * @param[in] offset Offset relative to the iterator.
+     */
+    [[nodiscard]]
+    constexpr auto operator[](difference_type offset) const -> reference
+    { return *(*this + offset); }
+
+    /**
+     * @brief Increments or decrements the iterator.
+     * 
+     * @{
+     */
+    constexpr auto operator++() -> basic_iterator& {
+        ++index_;
+        return *this;
+    }
+
+    constexpr auto operator++(int) -> basic_iterator {
+        auto const copy = *this;
+        ++index_;
+        return copy;
+    }
+
+    constexpr auto operator--() -> basic_iterator& {
+        --index_;
+        return *this;
+    }
+
+    constexpr auto operator--(int) -> basic_iterator {
+        auto const copy = *this;
+        --index_;
+        return copy;
+    }
+
+    constexpr auto operator+=(difference_type offset) -> basic_iterator& {
+        index_ += offset;
+        return *this;
+    }
+
+    constexpr auto operator-=(difference_type offset) -> basic_iterator& {
+        index_ -= offset;
+        return *this;
+    }
+    /** @} */
+
+    /**
+     * @brief Arithmetic operators of a random-access iterator.
+     * 
+     * @{
+     */
+    [[nodiscard]]
+    friend constexpr auto operator+(basic_iterator it, difference_type offset)
+        -> basic_iterator
+    { return it += offset; }
+
+    [[nodiscard]]
+    friend constexpr auto operator+(difference_type offset, basic_iterator it)
+        -> basic_iterator
+    { return it += offset; }
+
+    [[nodiscard]]
+    friend constexpr auto operator-(basic_iterator it, difference_type offset)
+        -> basic_iterator
+    { return it -= offset; }
+
+    [[nodiscard]]
+    friend constexpr auto operator-(basic_iterator const& lhs, basic_iterator const& rhs)
+        -> difference_type
+    { return lhs.index_ - rhs.index_; }
+    /** @} */
+
+    /**
+     * @brief Compares the positions of two iterators.
+     * 
+     * @{
+     */
+    [[nodiscard]]
+    friend constexpr auto operator==(
+        basic_iterator const& lhs, basic_iterator const& rhs) -> bool
+    { return lhs.table_ == rhs.table_ and lhs.index_ == rhs.index_; }
+
+    [[nodiscard]]
+    friend constexpr auto operator!=(
+        basic_iterator const& lhs, basic_iterator const& rhs) -> bool
+    { return not (lhs == rhs); }
+
+    [[nodiscard]]
+    friend constexpr auto operator<(
+        basic_iterator const& lhs, basic_iterator const& rhs) -> bool
+    { return lhs.index_ < rhs.index_; }
+
+    [[nodiscard]]
+    friend constexpr auto operator>(
+        basic_iterator const& lhs, basic_iterator const& rhs) -> bool
+    { return rhs < lhs; }
+
+    [[nodiscard]]
+    friend constexpr auto operator<=(
+        basic_iterator const& lhs, basic_iterator const& rhs) -> bool
+    { return not (rhs < lhs); }
+
+    [[nodiscard]]
+    friend constexpr auto operator>=(
+        basic_iterator const& lhs, basic_iterator const& rhs) -> bool
+    { return not (lhs < rhs); }
+    /** @} */
+
+private:
+    template<bool>
+    friend class basic_iterator;
+
+    table_type* table_{};     /**< Table that contains the settings. */
+    difference_type index_{}; /**< Index of the setting within the table. */
+};
+
+/**
+ * @remark Checks if a type is a setting table.
+ * 
+ * @tparam T Type to check.
+ * 
+ * @{
+ */
+template<typename T>
+struct is_setting_table : std::false_type {};
+
+template<auto GetSettings, std::size_t ArenaSize, std::size_t MaxValueSize, typename E>
+struct is_setting_table<setting_table<GetSettings, ArenaSize, MaxValueSize, E>>
+    : std::true_type {};
+/** @} */
+
+/**
+ * @var is_setting_table_v
+ * 
+ * @brief Helper variable template for the @ref is_setting_table type trait.
+ * 
+ * @tparam T Type to check.
+ */
+template<typename T>
+inline constexpr auto is_setting_table_v
+    = bool{is_setting_table<T>{}};
+
+} // namespace cfg
+
+/**
+ * @remark Provides the number of settings of a setting table, alike to std::array.
+ * 
+ * @tparam GetSettings Function that returns the container of settings in compile time.
+ */
+template<auto GetSettings, std::size_t ArenaSize, std::size_t MaxValueSize, typename E>
+struct std::tuple_size<cfg::setting_table<GetSettings, ArenaSize, MaxValueSize, E>>
+    : std::integral_constant<std::size_t,
+        cfg::setting_table<GetSettings, ArenaSize, MaxValueSize, E>::setting_count> {};
+
+#endif
@@ -55,7 +55,8 @@ namespace cfg {
  */
 template<auto (&Validator)(std::string_view), typename... Ts>
 [[nodiscard]]
-constexpr auto dispatch_validator(std::string_view value, validation_mode, Ts...)
+constexpr auto dispatch_validator(
+    std::string_view value, validation_mode, setting_data, Ts...)
     -> validate_result<setting_data>
 { return Validator(value); }
 
@@ -82,7 +83,8 @@ template<
     auto (&MsgValidator)(std::string_view),
     typename... Ts>
 [[nodiscard]]
-constexpr auto dispatch_validator(std::string_view value, validation_mode mode, Ts...)
+constexpr auto dispatch_validator(
+    std::string_view value, validation_mode mode, setting_data, Ts...)
 -> validate_result<setting_data> {
     return invoke_validator(mode,
         [&]{ return FileValidator(value); },
@@ -99,9 +101,11 @@ constexpr auto dispatch_validator(std::string_view value, validation_mode mode,
  * object.
  * 
  * Which @link validators.h validation function @endlink will be invoked depends on the
- * given validation mode. When validating the value of a config message, the underlying
- * bits will first be converted to an integral value that matches the instantiated type
- * of this function.
+ * given validation mode. When validating the value of a config message, the integral
+ * value that was decoded from the message is validated directly, instead of converting
+ * the bytes of the value-buffer back to an integral value. A decoded value that takes up
+ * more bytes than the instantiated type of this function is treated as zero, alike to
+ * @ref convert_bits.
  * 
  * @tparam T Integral type of the @p MinMax arguments passed to a @ref validate_value
  * function.
@@ -110,17 +114,25 @@ constexpr auto dispatch_validator(std::string_view value, validation_mode mode,
  * validate_value_range function.
  * 
  * @param[in] value Data-value to validate.
+ * @param[in] mode Indicates which validation mode is in effect.
+ * @param[in] decoded Integral value decoded from a config message, with its
+ * #setting_data::uint32 member active.
  * 
  * @return @link validate_result Validation result @endlink that stores a @ref
  * setting_data object.
  */
 template<typename T, std::enable_if_t<std::is_integral_v<T>, T>... MinMax>
 [[nodiscard]]
-constexpr auto validate(std::string_view value, validation_mode mode)
+constexpr auto validate(
+    std::string_view value, validation_mode mode, setting_data decoded)
 -> validate_result<setting_data> {
     return invoke_validator(mode,
         [&]{ return validate_value<T>(value, MinMax...); },
-        [&]{ return validate_value_range<T>(convert_bits<T>(value), MinMax...); });
+        [&]{
+            auto const bits = value.size() > sizeof(T)
+                ? T{} : static_cast<T>(decoded.uint32);
+            return validate_value_range<T>(bits, MinMax...);
+        });
 }
 
 } // namespace cfg
@@ -20,6 +20,7 @@
 
 #include "setting-identifiers.h"
 
+#include <checking/validation-mode.h>
 #include <errors/error-types.h>
 #include <parsing/node.h>
 #include <utilities/algorithm.h>
@@ -165,6 +166,27 @@ union setting_data {
     bool flag;                 /**< Represents a boolean value. */
 };
 
+/**
+ * @brief Decodes the integral value that a value-buffer holds in its binary form.
+ * 
+ * @details The binary form is the one that is stored by @ref setting::set_value(
+ * std::uint_fast64_t, std::size_t), so at most the four lower order bytes of the value
+ * are read, in little-endian order. A value that holds text decodes to a meaningless
+ * integral value, which is never read as a validator converts text itself.
+ * 
+ * @param[in] value Contents of a value-buffer.
+ * 
+ * @return Setting-data with #setting_data::uint32 active.
+ */
+[[nodiscard]]
+constexpr auto decode_binary_value(std::string_view value) -> setting_data {
+    auto result = std::uint32_t{};
+    for (auto idx = std::min(value.size(), sizeof(result)); idx > 0; --idx) {
+        result = (result << 8u) | static_cast<unsigned char>(value[idx - 1]);
+    }
+    return setting_data{result};
+}
+
 /**
  * @class setting
  * 
@@ -330,7 +352,9 @@ public:
         validator_fn{other.validator()},
         action_fn{other.action()},
         cfg_bits{other.config_bits()},
-        type_{other.type()}
+        type_{other.type()},
+        dependency_{other.dependency()},
+        gated_{other.is_gated()}
     {}
 
     /**
@@ -342,6 +366,11 @@ public:
      * a value. If the value is not set, a validation error of type 'setting_unset' is
      * returned. Otherwise, the optional @ref setting_data object is cached.
      * 
+     * Besides the stored value and the optional arguments, the validator is given the
+     * integral value that was last set, as decoded by @ref decode_binary_value, as a
+     * @ref setting_data object with #setting_data::uint32 active. This allows the value
+     * of a config message to be validated without decoding the value-buffer again.
+     * 
      * @tparam Ts Types of the optional arguments.
      * 
      * @param[in] args Optional number of arguments that will be forwarded to the
@@ -353,15 +382,36 @@ public:
      */
     template<typename... Ts,
         typename = std::enable_if_t<
-            std::is_invocable_v<Validator, std::string_view, Ts&&...>>>
+            std::is_invocable_v<Validator, std::string_view, Ts&&..., setting_data>>>
     constexpr auto validate(Ts&&... args) const -> std::optional<validation_error> {
         if (not is_set()) return validation_error::setting_unset;
 
-        auto const [data, status] = validator_fn(value_view, std::forward<Ts>(args)...);
+        auto const decoded = cache.value_or(setting_data{});
+        auto const [data, status] = validator_fn(
+            value_view, std::forward<Ts>(args)..., decoded);
         cache = data;
         return status;
     }
 
+    /**
+     * @brief Validates the stored value in a validation mode that is fixed in compile
+     * time.
+     * 
+     * @details Works similarly to the other overload of this function, with the
+     * validation mode as the only argument for the validator. Refer to @ref
+     * setting_table::basic_reference::validate for a table of settings, which has its
+     * validators specialized for each validation mode.
+     * 
+     * @tparam Mode Validation mode in effect.
+     * 
+     * @return An optional @link error::type::validation validation error @endlink.
+     */
+    template<validation_mode Mode,
+        typename = std::enable_if_t<std::is_invocable_v<
+            Validator, std::string_view, validation_mode, setting_data>>>
+    constexpr auto validate() const -> std::optional<validation_error>
+    { return validate(Mode); }
+
     /**
      * @brief Applies the action of the invocable action object.
      * 
@@ -422,6 +472,67 @@ public:
     constexpr auto type() const -> setting_type
     { return type_; }
 
+    /**
+     * @brief Gets the identifier of the setting that this setting depends on.
+     * 
+     * @return Identifier of the setting whose value the action of this setting reads
+     * from the main configuration object, or setting_id::unspecified if there is none.
+     */
+    [[nodiscard]]
+    constexpr auto dependency() const -> setting_id
+    { return dependency_; }
+
+    /**
+     * @brief Checks whether the setting only takes effect while the setting it depends
+     * on is enabled.
+     * 
+     * @return True if the setting is made with @ref enabled_by, false otherwise.
+     */
+    [[nodiscard]]
+    constexpr auto is_gated() const -> bool
+    { return gated_; }
+
+    /**
+     * @brief Makes a copy of the setting that depends on another setting.
+     * 
+     * @details A setting depends on another setting when its action reads a value from
+     * the main configuration object that is written by the action of the other setting.
+     * The setting-handler then applies this setting again whenever the other setting is
+     * applied, even if the value of this setting did not change.
+     * 
+     * @param[in] id Identifier of the setting to depend on.
+     * 
+     * @return Copy of this setting with the given dependency.
+     */
+    [[nodiscard]]
+    constexpr auto depends_on(setting_id id) const -> setting {
+        auto result = *this;
+        result.dependency_ = id;
+        return result;
+    }
+
+    /**
+     * @brief Makes a copy of the setting that only takes effect while a flag-setting is
+     * enabled, such as a setting of a trigger that can be disabled.
+     * 
+     * @details The setting depends on the flag-setting, as if it was made with @ref
+     * depends_on. Whenever the flag-setting has been applied with a value of false, the
+     * setting-handler does not validate this setting, nor does it report the setting as
+     * unset. Its action is not invoked either, so that the configuration object keeps
+     * the values of the disabled subsystem. Enabling the flag-setting again, such as with
+     * a delta message that only contains the flag-setting, thus restores the subsystem.
+     * 
+     * @param[in] id Identifier of the flag-setting to be enabled by.
+     * 
+     * @return Copy of this setting that is gated by the given flag-setting.
+     */
+    [[nodiscard]]
+    constexpr auto enabled_by(setting_id id) const -> setting {
+        auto result = depends_on(id);
+        result.gated_ = true;
+        return result;
+    }
+
     /**
      * @brief Gets the span of bits that refers to some part within a config message.
      * 
@@ -492,6 +603,15 @@ public:
     constexpr auto get_value() const -> value_type const&
     { return value; }
 
+    /**
+     * @brief Gets the converted data that was cached by the last validation.
+     * 
+     * @return Cached setting-data, or zero-initialized setting-data if none is cached.
+     */
+    [[nodiscard]]
+    constexpr auto get_data() const -> setting_data
+    { return cache.value_or(setting_data{}); }
+
     /**
      * @brief Sets the buffered value to the contents of a given string.
      * 
@@ -499,6 +619,10 @@ public:
      * the buffer of the stored value, where N is determined by #max_value_size. The
      * buffered value is not null-terminated.
      * 
+     * The content is decoded as a binary value with @ref decode_binary_value as well, so
+     * that a value that was set in its binary form, as a config message holds it, is
+     * passed on to the validator by @ref validate alike to the integral overload.
+     * 
      * @param[in] content Contents of a string.
      */
     constexpr auto set_value(std::string_view content) -> void {
@@ -506,17 +630,62 @@ public:
         auto const content_data = reinterpret_cast<std::byte const*>(content.data());
         cfg::copy_n(content_data, value_size, value.data());
         value_view = {reinterpret_cast<char*>(value.data()), value_size};
+        cache = decode_binary_value(value_view);
     }
 
+    /**
+     * @brief Gets the number of characters that the next value can hold.
+     * 
+     * @details The value-buffer of a setting is of a fixed size, so this always equals
+     * #max_value_size. Containers that share storage between settings may offer less.
+     */
+    [[nodiscard]]
+    static constexpr auto value_capacity() -> std::size_t
+    { return max_value_size; }
+
+    /**
+     * @brief Gets the value-buffer to write the contents of a value into directly.
+     * 
+     * @details This allows a parser to write a value in place, without copying it from
+     * an intermediate buffer. At most #max_value_size characters can be written. The
+     * size of the written value is to be set afterwards with @ref set_value_size.
+     * 
+     * @return Pointer to the first character of the value-buffer.
+     */
+    [[nodiscard]]
+    auto value_buffer() -> char*
+    { return reinterpret_cast<char*>(value.data()); }
+
+    /**
+     * @brief Sets the size of a value that is written into the value-buffer directly.
+     * 
+     * @param[in] size Number of characters written, limited to #max_value_size.
+     */
+    auto set_value_size(std::size_t size) -> void
+    { value_view = {value_buffer(), std::min(size, max_value_size)}; }
+
     /**
      * @brief Sets the buffered value to the binary equivalence of a given integral value.
      * 
+     * @details Only the first bytes of the native representation of the integral value
+     * are stored, which are its lower order bytes on a little-endian target. This allows
+     * a value to be converted to an integral type that is smaller than 64 bits.
+     * 
+     * The lower 32 bits of the integral value are cached as well, to be passed on to the
+     * validator by @ref validate.
+     * 
      * @param[in] content Content of an integral value.
+     * @param[in] size Number of bytes to store. The default value is the size of the
+     * integral value itself.
      */
-    constexpr auto set_value(std::uint_fast64_t content) -> void {
+    constexpr auto set_value(
+        std::uint_fast64_t content, std::size_t size = sizeof(std::uint_fast64_t)) -> void
+    {
         static_assert(sizeof(content) <= max_value_size);
-        std::memcpy(value.data(), &content, sizeof(content));
-        value_view = {reinterpret_cast<char*>(value.data()), sizeof(content)};
+        size = std::min(size, sizeof(content));
+        std::memcpy(value.data(), &content, size);
+        value_view = {reinterpret_cast<char*>(value.data()), size};
+        cache = setting_data{static_cast<std::uint32_t>(content)};
     }
 
     /**
@@ -550,6 +719,8 @@ private:
     Action action_fn{};                          /**< Applies an action. */
     bitspan cfg_bits{};                          /**< Span of config message bits. */
     setting_type type_{};                        /**< Type of the setting.  */
+    setting_id dependency_{setting_id::unspecified}; /**< Setting depended upon. */
+    bool gated_{};                               /**< Enabled by its dependency. */
 };
 
 /**
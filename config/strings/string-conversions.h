@@ -20,11 +20,16 @@
 #include "zstring-view.h"
 
 #include <traits/iterator-traits.h>
+#include <utilities/bitwise.h>
 
+#include <algorithm>
 #include <charconv>
+#include <cstddef>
 #include <cstdint>
-#include <cstdlib>
 #include <iterator>
+#include <limits>
+#include <string_view>
+#include <system_error>
 #include <type_traits>
 
 /**
@@ -117,6 +122,207 @@ auto from_chars(Container const& input, T& value, int base = 10)
     return std::from_chars(data(input), data(input) + size(input), value, base);
 }
 
+namespace detail {
+
+/**
+ * @var digit_lanes
+ * 
+ * @brief Word that has a value of one in each of its eight bytes.
+ */
+inline constexpr auto digit_lanes = std::uint64_t{0x0101'0101'0101'0101};
+
+/**
+ * @brief Loads up to eight characters into a word, with the first character in the most
+ * significant byte.
+ * 
+ * @param[in] chars Characters to load.
+ * @param[in] count Number of characters to load, at most eight. The remaining bytes of
+ * the word are zero.
+ * 
+ * @return Word that contains the characters.
+ */
+[[nodiscard]]
+constexpr auto load_chars(char const* chars, unsigned count) -> std::uint64_t {
+    if (count == 0) return 0;
+    return load_big_endian<std::uint64_t>(chars, count) << (8u * (8u - count));
+}
+
+/**
+ * @brief Counts the number of decimal digits at the beginning of a word of characters.
+ * 
+ * @details Each byte is checked at once to fall within the range of '0' to '9'. The
+ * checks are done on the lower seven bits of each byte, so that no carry or borrow
+ * crosses over into a neighbouring byte.
+ * 
+ * @param[in] chars Word of characters, as loaded by @ref load_chars.
+ * @param[in] count Number of characters that the word contains.
+ * 
+ * @return Number of leading digits.
+ */
+[[nodiscard]]
+constexpr auto count_leading_digits(std::uint64_t chars, unsigned count) -> unsigned {
+    constexpr auto high_bits = digit_lanes * 0x80u;
+    auto const low_bits = chars & ~high_bits;
+    auto const at_least_zero = ((low_bits | high_bits) - digit_lanes * '0') & high_bits;
+    auto const above_nine = (low_bits + digit_lanes * (0x80u - '9' - 1u)) & high_bits;
+    auto const padding = count < 8u ? ~std::uint64_t{} >> (8u * count) : 0u;
+
+    auto non_digits = (~at_least_zero | above_nine | chars | padding) & high_bits;
+    non_digits |= non_digits >> 8u;
+    non_digits |= non_digits >> 16u;
+    non_digits |= non_digits >> 32u;
+    return 8u - static_cast<unsigned>(((non_digits >> 7u) * digit_lanes) >> 56u);
+}
+
+/**
+ * @brief Converts the leading decimal digits of a word of characters to an integer.
+ * 
+ * @details The digits are combined in pairs, quadruples and octets with a multiply-add
+ * of all the pairs at once, instead of handling one digit at a time.
+ * 
+ * @param[in] chars Word of characters, as loaded by @ref load_chars.
+ * @param[in] digits Number of leading digits to convert, at most eight.
+ * 
+ * @return Integral value of the digits.
+ */
+[[nodiscard]]
+constexpr auto digits_to_integer(std::uint64_t chars, unsigned digits) -> std::uint32_t {
+    if (digits == 0) return 0;
+
+    auto word = (chars >> (8u * (8u - digits))) & (digit_lanes * 0x0Fu);
+    word = ((word >> 8u) & 0x00FF'00FF'00FF'00FFu) * 10u
+        + (word & 0x00FF'00FF'00FF'00FFu);
+    word = ((word >> 16u) & 0x0000'FFFF'0000'FFFFu) * 100u
+        + (word & 0x0000'FFFF'0000'FFFFu);
+    return static_cast<std::uint32_t>((word >> 32u) * 10'000u + (word & 0xFFFF'FFFFu));
+}
+
+/**
+ * @brief Checks if a character is a decimal digit.
+ * 
+ * @param[in] character Character to check.
+ */
+[[nodiscard]]
+constexpr auto is_digit(char character) -> bool
+{ return static_cast<unsigned char>(character - '0') < 10u; }
+
+} // namespace detail
+
+/**
+ * @brief Converts the decimal number at the beginning of a string to an integral value.
+ * 
+ * @details Behaves like std::from_chars with a base of 10, but converts up to eight
+ * digits at once. Values in config files are short decimal numbers, so all of their
+ * digits are usually validated and converted with a few word operations. Integral types
+ * wider than 32 bits are converted with std::from_chars instead.
+ * 
+ * @tparam T Integral type of the converted value.
+ * 
+ * @param[in] input String that contains the decimal number.
+ * @param[out] value Stores the converted value, if the conversion was successful.
+ * 
+ * @return A std::from_chars_result object, which points past the last digit and contains
+ * an error if there are no digits or the number does not fit in T.
+ */
+template<typename T,
+    typename = std::enable_if_t<std::is_integral_v<T> and not std::is_same_v<T, bool>>>
+[[nodiscard]]
+constexpr auto decimal_from_chars(std::string_view input, T& value)
+-> std::from_chars_result {
+    auto const first = input.data();
+    auto const last = first + input.size();
+    if constexpr (sizeof(T) > sizeof(std::uint32_t)) {
+        return std::from_chars(first, last, value);
+    } else {
+        constexpr std::uint32_t powers[] = {
+            1, 10, 100, 1'000, 10'000, 100'000, 1'000'000, 10'000'000, 100'000'000};
+
+        auto it = first;
+        auto negative = false;
+        if constexpr (std::is_signed_v<T>) {
+            negative = it != last and *it == '-';
+            it += negative;
+        }
+        auto const digits_first = it;
+        while (it != last and *it == '0') ++it;
+
+        auto magnitude = std::uint64_t{};
+        auto significant = 0u;
+        for (auto chunk = 0; chunk < 2; ++chunk) {
+            auto const count = static_cast<unsigned>(std::min<std::ptrdiff_t>(last - it, 8));
+            auto const chars = detail::load_chars(it, count);
+            auto const digits = detail::count_leading_digits(chars, count);
+            magnitude = magnitude * powers[digits] + detail::digits_to_integer(chars, digits);
+            significant += digits;
+            it += digits;
+            if (digits < 8u) break;
+        }
+        while (it != last and detail::is_digit(*it)) {
+            ++significant;
+            ++it;
+        }
+        if (it == digits_first) return {first, std::errc::invalid_argument};
+
+        using limits = std::numeric_limits<T>;
+        auto const limit = static_cast<std::uint64_t>(limits::max()) + negative;
+        if (significant > 16u or magnitude > limit) {
+            return {it, std::errc::result_out_of_range};
+        }
+        value = negative
+            ? static_cast<T>(-static_cast<std::int64_t>(magnitude))
+            : static_cast<T>(magnitude);
+        return {it, std::errc{}};
+    }
+}
+
+namespace detail {
+
+/**
+ * @brief Checks the conversion of decimal numbers against known results.
+ * 
+ * @return True if all conversions match, false otherwise.
+ */
+[[nodiscard]]
+constexpr auto check_decimal_from_chars() -> bool {
+    auto const converts = [](std::string_view input, auto expected, std::size_t length) {
+        auto value = decltype(expected){};
+        auto const [ptr, error] = decimal_from_chars(input, value);
+        return error == std::errc{} and value == expected
+            and ptr == input.data() + length;
+    };
+    auto const fails = [](std::string_view input, auto type, std::errc expected) {
+        auto value = decltype(type){};
+        return decimal_from_chars(input, value).ec == expected;
+    };
+    return converts("0", std::uint8_t{0}, 1)
+        and converts("1", std::uint8_t{1}, 1)
+        and converts("255", std::uint8_t{255}, 3)
+        and converts("1000", std::uint32_t{1'000}, 4)
+        and converts("12345678", std::uint32_t{12'345'678}, 8)
+        and converts("123456789", std::uint32_t{123'456'789}, 9)
+        and converts("4294967295", std::uint32_t{4'294'967'295}, 10)
+        and converts("0000000000000000000042", std::uint16_t{42}, 22)
+        and converts("-2147483648", std::int32_t{INT32_MIN}, 11)
+        and converts("-0", std::int8_t{0}, 2)
+        and converts("3</", std::int8_t{3}, 1)
+        and converts("15000 ", std::uint32_t{15'000}, 5)
+        and fails("256", std::uint8_t{}, std::errc::result_out_of_range)
+        and fails("4294967296", std::uint32_t{}, std::errc::result_out_of_range)
+        and fails("-2147483649", std::int32_t{}, std::errc::result_out_of_range)
+        and fails("99999999999999999", std::uint32_t{}, std::errc::result_out_of_range)
+        and fails("", std::uint32_t{}, std::errc::invalid_argument)
+        and fails("-", std::int32_t{}, std::errc::invalid_argument)
+        and fails("-1", std::uint32_t{}, std::errc::invalid_argument)
+        and fails("+1", std::int32_t{}, std::errc::invalid_argument)
+        and fails("a1", std::uint16_t{}, std::errc::invalid_argument)
+        and fails(":", std::uint16_t{}, std::errc::invalid_argument)
+        and fails("/", std::uint16_t{}, std::errc::invalid_argument);
+}
+
+static_assert(check_decimal_from_chars());
+
+} // namespace detail
+
 /**
  * @brief Converts a character to a boolean value.
  * 
@@ -149,8 +355,11 @@ constexpr auto bool_from_zstring(zstring_view zstring) -> bool
  * converted correctly, the return value is zero.
  */
 [[nodiscard]]
-inline auto int32_from_zstring(zstring_view zstring) -> std::int32_t
-{ return std::int32_t{std::strtol(zstring.data(), nullptr, 10)}; }
+constexpr auto int32_from_zstring(zstring_view zstring) -> std::int32_t {
+    auto value = std::int32_t{};
+    static_cast<void>(decimal_from_chars({zstring.data(), zstring.size()}, value));
+    return value;
+}
 
 /**
  * @brief Converts a zero-terminated string to a 32-bit unsigned integer value.
@@ -161,8 +370,11 @@ inline auto int32_from_zstring(zstring_view zstring) -> std::int32_t
  * converted correctly, the return value is zero.
  */
 [[nodiscard]]
-inline auto uint32_from_zstring(zstring_view zstring) -> std::uint32_t
-{ return std::uint32_t{std::strtoul(zstring.data(), nullptr, 10)}; }
+constexpr auto uint32_from_zstring(zstring_view zstring) -> std::uint32_t {
+    auto value = std::uint32_t{};
+    static_cast<void>(decimal_from_chars({zstring.data(), zstring.size()}, value));
+    return value;
+}
 
 /**
  * @brief Converts a zero-terminated string to a boolean value.
@@ -181,7 +393,7 @@ constexpr auto convert(zstring_view value, bool& result) -> void
  * @param[out] result Receives the decimal equivalent of the converted string. If the
  * string could not be converted correctly, the result is zero.
  */
-inline auto convert(zstring_view value, std::int32_t& result) -> void
+constexpr auto convert(zstring_view value, std::int32_t& result) -> void
 { result = int32_from_zstring(value); }
 
 /**
@@ -191,7 +403,7 @@ inline auto convert(zstring_view value, std::int32_t& result) -> void
  * @param[out] result Receives the decimal equivalent of the converted string. If the
  * string could not be converted correctly, the result is zero.
  */
-inline auto convert(zstring_view value, std::uint32_t& result) -> void
+constexpr auto convert(zstring_view value, std::uint32_t& result) -> void
 { result = uint32_from_zstring(value); }
 
 } // namespace cfg
@@ -0,0 +1,113 @@
+/**
+ * @file string-formatting.h
+ * @brief Compile time sizing of buffers for formatted strings.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_CONFIG_STRINGS_STRING_FORMATTING_H
+#define CFG_CONFIG_STRINGS_STRING_FORMATTING_H
+
+#include <cstddef>
+#include <string_view>
+
+/**
+ * @namespace cfg
+ * 
+ * @brief Contains everything related to the processing of configuration files.
+ */
+namespace cfg {
+
+/**
+ * @namespace detail
+ * 
+ * @brief Provides helper/meta functions/types local to this header file.
+ */
+namespace detail {
+
+/**
+ * @brief Gets the maximum number of characters of a single integral conversion.
+ * 
+ * @details The sizes cover the widest integral types that the length modifiers refer
+ * to on any target, including the sign and the prefix of the alternative form.
+ * 
+ * @param[in] conversion Conversion specifier, such as 'i' or 'X'.
+ * @param[in] length Number of 'h' (negative) or 'l' (positive) length modifiers.
+ * 
+ * @return Maximum number of characters, or zero if the conversion is not integral.
+ */
+[[nodiscard]]
+constexpr auto max_integral_size(char conversion, int length) -> std::size_t {
+    auto const bytes = length <= -2 ? 1u : length == -1 ? 2u : length == 0 ? 4u : 8u;
+    switch (conversion) {
+    case 'd': case 'i': return bytes == 1 ? 4 : bytes == 2 ? 6 : bytes == 4 ? 11 : 20;
+    case 'u':           return bytes == 1 ? 3 : bytes == 2 ? 5 : bytes == 4 ? 10 : 20;
+    case 'o':           return bytes * 3 + 1;
+    case 'x': case 'X': return bytes * 2 + 2;
+    default:            return 0;
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Computes the maximum number of characters that a format string can produce.
+ * 
+ * @details The format string is scanned in compile time, so that a buffer that is
+ * passed to std::sprintf can be sized exactly rather than by guesswork. The width of a
+ * conversion is taken into account, but values are assumed not to be padded further.
+ * Floating-point conversions are not supported, and make the format string unfit to be
+ * sized.
+ * 
+ * @param[in] format Format string, as passed to std::sprintf.
+ * @param[in] max_string_length Maximum number of characters of each string argument.
+ * 
+ * @return Maximum number of characters, including the terminating null-character.
+ */
+[[nodiscard]]
+constexpr auto max_formatted_size(std::string_view format, std::size_t max_string_length)
+-> std::size_t {
+    auto size = std::size_t{1};
+    for (auto pos = std::size_t{}; pos < format.size(); ++pos) {
+        if (format[pos] != '%') {
+            ++size;
+            continue;
+        }
+        ++pos;
+        while (pos < format.size() and std::string_view{"-+ #0"}.find(format[pos])
+            != std::string_view::npos) ++pos;
+
+        auto width = std::size_t{};
+        for (; pos < format.size() and format[pos] >= '0' and format[pos] <= '9'; ++pos) {
+            width = width * 10 + static_cast<std::size_t>(format[pos] - '0');
+        }
+
+        auto length = 0;
+        for (; pos < format.size(); ++pos) {
+            if (format[pos] == 'h')      --length;
+            else if (format[pos] == 'l') ++length;
+            else break;
+        }
+        if (pos == format.size()) break;
+
+        auto conversion_size = detail::max_integral_size(format[pos], length);
+        if (format[pos] == 's')      conversion_size = max_string_length;
+        else if (format[pos] == 'c') conversion_size = 1;
+        else if (format[pos] == '%') conversion_size = 1;
+        size += width > conversion_size ? width : conversion_size;
+    }
+    return size;
+}
+
+} // namespace cfg
+
+#endif
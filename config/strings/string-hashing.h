@@ -0,0 +1,59 @@
+/**
+ * @file string-hashing.h
+ * @brief Helper functions for computing hash values of strings.
+ * 
+ * @version 1.0
+ * @date December 2021
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_CONFIG_STRINGS_STRING_HASHING_H
+#define CFG_CONFIG_STRINGS_STRING_HASHING_H
+
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @namespace cfg
+ * 
+ * @brief Contains everything related to the processing of configuration files.
+ */
+namespace cfg {
+
+/**
+ * @brief Computes the 32-bit FNV-1a hash value of a string.
+ * 
+ * @details The FNV-1a algorithm only requires a multiplication and an exclusive-or per
+ * character, which makes it cheap enough to be used on short strings such as tag-names.
+ * It can be evaluated in compile time as well as in run time, and yields the same hash
+ * value in both cases.
+ * 
+ * @param[in] value String to compute the hash value of.
+ * @param[in] seed Initial value of the hash. The default value is the 32-bit FNV offset
+ * basis.
+ * 
+ * @return Unsigned 32-bit hash value.
+ */
+[[nodiscard]]
+constexpr auto hash_string(
+    std::string_view value,
+    std::uint32_t seed = 2'166'136'261u
+) -> std::uint32_t {
+    auto hash = seed;
+    for (auto const character : value) {
+        hash ^= static_cast<unsigned char>(character);
+        hash *= 16'777'619u;
+    }
+    return hash;
+}
+
+} // namespace cfg
+
+#endif
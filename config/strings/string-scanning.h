@@ -18,8 +18,6 @@
 #ifndef CFG_CONFIG_STRINGS_STRING_SCANNING_H
 #define CFG_CONFIG_STRINGS_STRING_SCANNING_H
 
-#include <algorithm>
-#include <cctype>
 #include <string_view>
 
 /**
@@ -41,17 +39,18 @@ namespace cfg {
  * value of this parameter is: "()-_".
  */
 [[nodiscard]]
-inline auto contains_special_character(
+constexpr auto contains_special_character(
     std::string_view source,
     std::string_view exceptions = "()-_"
 ) -> bool {
-    return not std::all_of(source.cbegin(), source.cend(),
-        [&](unsigned char character) -> bool {
-            return std::isalnum(character)
-                or exceptions.find_first_of(character)
-                    != std::string_view::npos;
-        }
-    );
+    for (auto const character : source) {
+        auto const is_alnum = (character >= '0' and character <= '9')
+            or (character >= 'a' and character <= 'z')
+            or (character >= 'A' and character <= 'Z');
+        if (not is_alnum and exceptions.find(character) == std::string_view::npos)
+            return true;
+    }
+    return false;
 }
 
 } // namespace cfg
@@ -0,0 +1,216 @@
+/**
+ * @file config-benchmarks.cpp
+ * @brief Microbenchmarks of the stages of the config pipeline on a host.
+ * 
+ * @details Each benchmark is repeated until it has run for a minimum amount of time,
+ * after which its cost per run and per byte of input is reported, as well as the number
+ * of heap allocations per run. The config library is not expected to allocate at all.
+ * Passing --quick shortens the minimum time, so that the benchmarks can be run as a
+ * smoke test.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#include <config.h>
+#include <logger.hpp>
+#include <sample-configs.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <random>
+#include <string>
+#include <string_view>
+
+namespace {
+
+/**
+ * @var allocation_count
+ * 
+ * @brief Number of heap allocations made since the start of the program.
+ */
+auto allocation_count = std::size_t{};
+
+/**
+ * @var minimum_duration
+ * 
+ * @brief Minimum amount of time that each benchmark runs for.
+ */
+auto minimum_duration = std::chrono::nanoseconds{std::chrono::milliseconds{200}};
+
+/**
+ * @var sink
+ * 
+ * @brief Receives a value of each run, so that the compiler cannot discard the run.
+ */
+auto volatile sink = std::uint_fast64_t{};
+
+/**
+ * @brief Runs a benchmark and prints its results.
+ * 
+ * @param[in] name Name of the benchmark.
+ * @param[in] input_size Number of bytes of input that each run processes.
+ * @param[in] run Function that performs a single run.
+ */
+template<typename Run>
+auto benchmark(char const* name, std::size_t input_size, Run&& run) -> void {
+    using clock = std::chrono::steady_clock;
+
+    run();
+    auto const allocations_before = allocation_count;
+    auto runs = std::size_t{};
+    auto const start = clock::now();
+    auto elapsed = clock::duration{};
+    do {
+        for (auto idx = 0; idx < 16; ++idx) run();
+        runs += 16;
+        elapsed = clock::now() - start;
+    } while (elapsed < minimum_duration);
+
+    auto const ns = std::chrono::duration<double, std::nano>{elapsed}.count();
+    auto const ns_per_run = ns / static_cast<double>(runs);
+    auto const allocations = allocation_count - allocations_before;
+    std::printf("%-32s %7zu B %12.1f ns/run %9.3f ns/B %8.2f allocs/run\n",
+        name, input_size, ns_per_run,
+        input_size ? ns_per_run / static_cast<double>(input_size) : 0.0,
+        static_cast<double>(allocations) / static_cast<double>(runs));
+}
+
+/**
+ * @brief Benchmarks the XML parser on its own, which only fills the setting table.
+ */
+auto benchmark_xml_parser(char const* name, std::string_view config) -> void {
+    benchmark(name, config.size(), [config] {
+        auto settings = cfg::default_setting_table{};
+        auto parser = cfg::xml_parser{settings};
+        parser.parse_config(config);
+        sink = sink + settings[0].view_value().size();
+    });
+}
+
+/**
+ * @brief Benchmarks the complete processing of a config file.
+ */
+auto benchmark_process_config(char const* name, std::string_view config) -> void {
+    benchmark(name, config.size(), [config] {
+        auto cfg_handler = cfg::config_handler<cfg::xml_parser>{};
+        auto const changes = cfg_handler.process_config(config);
+        auto const verification = cfg_handler.verify_main_config(changes);
+        sink = sink + verification.contains_errors();
+    });
+}
+
+/**
+ * @brief Makes a config message of pseudo-random bytes.
+ */
+auto make_random_message() -> std::array<std::byte, cfg::bitspan::byte_boundary> {
+    auto message = std::array<std::byte, cfg::bitspan::byte_boundary>{};
+    auto generator = std::mt19937{21};
+    for (auto& byte : message) byte = static_cast<std::byte>(generator());
+    return message;
+}
+
+} // namespace
+
+/**
+ * @brief Tracks every heap allocation of the program.
+ * 
+ * @{
+ */
+auto operator new(std::size_t size) -> void* {
+    ++allocation_count;
+    if (auto* const memory = std::malloc(size ? size : 1)) return memory;
+    throw std::bad_alloc{};
+}
+
+auto operator delete(void* memory) noexcept -> void
+{ std::free(memory); }
+
+auto operator delete(void* memory, std::size_t) noexcept -> void
+{ std::free(memory); }
+/** @} */
+
+int main(int argc, char* argv[]) {
+    for (auto idx = 1; idx < argc; ++idx) {
+        if (std::strcmp(argv[idx], "--quick") == 0) {
+            minimum_duration = std::chrono::milliseconds{5};
+        }
+    }
+    logger::enabled = false;
+
+    auto const full = std::string{cfg::test::full_config};
+    auto const wide = cfg::test::widen_indentation(full, 4);
+    auto const wider = cfg::test::widen_indentation(full, 16);
+    auto const minimal = std::string{cfg::test::minimal_config};
+
+    benchmark_xml_parser("xml_parser/full", full);
+    benchmark_xml_parser("xml_parser/full-indent-x4", wide);
+    benchmark_xml_parser("xml_parser/full-indent-x16", wider);
+    benchmark_xml_parser("xml_parser/minimal", minimal);
+
+    auto message = make_random_message();
+    auto const bitspans = [] {
+        auto settings = cfg::default_setting_table{};
+        auto spans = std::array<cfg::bitspan, std::tuple_size_v<decltype(settings)>>{};
+        for (auto idx = std::size_t{}; idx < spans.size(); ++idx) {
+            spans[idx] = settings[idx].config_bits();
+        }
+        return spans;
+    }();
+    benchmark("extract_bits/all-settings", message.size(), [&] {
+        auto sum = std::uint_fast64_t{};
+        for (auto const bits : bitspans) {
+            if (bits.size() != 0) sum += cfg::extract_bits(message.data(), bits);
+        }
+        sink = sink + sum;
+    });
+    benchmark("message_parser/full", message.size(), [&] {
+        auto settings = cfg::default_setting_table{};
+        auto parser = cfg::message_parser{settings};
+        parser.parse_config(cfg::message_data{
+            message.data(), static_cast<std::uint_least8_t>(message.size())});
+        sink = sink + settings[1].view_value().size();
+    });
+
+    auto parsed = cfg::default_setting_table{};
+    auto parser = cfg::xml_parser{parsed};
+    parser.parse_config(std::string_view{full});
+    auto main_cfg = cfg::main_config{};
+    auto handler = cfg::make_setting_handler<cfg::validation_mode::config_file>(parsed);
+    benchmark("apply_valid_settings/full", full.size(), [&] {
+        handler.reset_applied_settings();
+        handler.clear_errors();
+        handler.apply_valid_settings(main_cfg);
+        sink = sink + main_cfg.framework.trigger.time.interval_ms;
+    });
+    benchmark("apply_valid_settings/unchanged", full.size(), [&] {
+        handler.apply_valid_settings(main_cfg);
+        sink = sink + main_cfg.framework.trigger.time.interval_ms;
+    });
+
+    auto verifier = cfg::config_handler<cfg::xml_parser>{};
+    verifier.process_config(std::string_view{full});
+    benchmark("verify_main_config/complete", 0, [&] {
+        sink = sink + verifier.verify_main_config().contains_errors();
+    });
+
+    benchmark_process_config("process_config/full", full);
+    benchmark_process_config("process_config/full-indent-x16", wider);
+    benchmark_process_config("process_config/minimal", minimal);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,181 @@
+/**
+ * @file throughput-test.cpp
+ * @brief Throughput regression test of the XML parser and the message parser.
+ * 
+ * @details The throughput of each parser is measured over the sample config files and
+ * config messages, as the median of several samples. The results are compared with a
+ * baseline file, and the test fails if any throughput dropped by more than a threshold.
+ * If the baseline file does not exist yet, or if --update is passed, the results are
+ * written to it instead, so that the first run of a build records its own baseline.
+ * 
+ * Usage: throughput-test --baseline FILE [--threshold FRACTION] [--update]
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#include <config.h>
+#include <logger.hpp>
+#include <sample-configs.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+/**
+ * @var sink
+ * 
+ * @brief Receives a value of each run, so that the compiler cannot discard the run.
+ */
+auto volatile sink = std::size_t{};
+
+/**
+ * @brief Measures the throughput of a parser, in bytes per second.
+ * 
+ * @param[in] input_size Number of bytes that each run parses.
+ * @param[in] run Function that performs a single run.
+ * 
+ * @return Median throughput over several samples.
+ */
+template<typename Run>
+auto measure(std::size_t input_size, Run&& run) -> double {
+    using clock = std::chrono::steady_clock;
+    constexpr auto sample_count = 7;
+    constexpr auto sample_duration = std::chrono::milliseconds{40};
+
+    auto samples = std::array<double, sample_count>{};
+    for (auto& sample : samples) {
+        auto runs = std::size_t{};
+        auto const start = clock::now();
+        auto elapsed = clock::duration{};
+        do {
+            for (auto idx = 0; idx < 8; ++idx) run();
+            runs += 8;
+            elapsed = clock::now() - start;
+        } while (elapsed < sample_duration);
+        auto const seconds = std::chrono::duration<double>{elapsed}.count();
+        sample = static_cast<double>(runs * input_size) / seconds;
+    }
+    std::nth_element(samples.begin(), samples.begin() + sample_count / 2, samples.end());
+    return samples[sample_count / 2];
+}
+
+/**
+ * @brief Measures the throughput of the XML parser over a config file.
+ */
+auto measure_xml_parser(std::string_view config) -> double {
+    return measure(config.size(), [config] {
+        auto settings = cfg::default_setting_table{};
+        auto parser = cfg::xml_parser{settings};
+        parser.parse_config(config);
+        sink = sink + settings[0].view_value().size();
+    });
+}
+
+/**
+ * @brief Measures the throughput of the message parser over a config message.
+ */
+auto measure_message_parser(std::array<std::byte, cfg::bitspan::byte_boundary> message)
+-> double {
+    return measure(message.size(), [&message] {
+        auto settings = cfg::default_setting_table{};
+        auto parser = cfg::message_parser{settings};
+        parser.set_decoder(cfg::default_message_decoder{});
+        parser.parse_config(cfg::message_data{
+            message.data(), static_cast<std::uint_least8_t>(message.size())});
+        sink = sink + settings[1].view_value().size();
+    });
+}
+
+/**
+ * @brief Reads the throughputs of a baseline file, one name and value per line.
+ */
+auto read_baseline(char const* filename) -> std::map<std::string, double> {
+    auto baseline = std::map<std::string, double>{};
+    auto stream = std::ifstream{filename};
+    auto name = std::string{};
+    auto throughput = 0.0;
+    while (stream >> name >> throughput) baseline[name] = throughput;
+    return baseline;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    auto const* baseline_file = static_cast<char const*>(nullptr);
+    auto threshold = 0.25;
+    auto update = false;
+    for (auto idx = 1; idx < argc; ++idx) {
+        if (std::strcmp(argv[idx], "--baseline") == 0 and idx + 1 < argc) {
+            baseline_file = argv[++idx];
+        } else if (std::strcmp(argv[idx], "--threshold") == 0 and idx + 1 < argc) {
+            threshold = std::strtod(argv[++idx], nullptr);
+        } else if (std::strcmp(argv[idx], "--update") == 0) {
+            update = true;
+        }
+    }
+    if (baseline_file == nullptr) {
+        std::fprintf(stderr,
+            "usage: %s --baseline FILE [--threshold FRACTION] [--update]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    logger::enabled = false;
+
+    auto message = std::array<std::byte, cfg::bitspan::byte_boundary>{};
+    auto generator = std::mt19937{39};
+    for (auto& byte : message) byte = static_cast<std::byte>(generator());
+
+    auto const results = std::vector<std::pair<std::string, double>>{
+        {"xml_parser/full", measure_xml_parser(cfg::test::full_config)},
+        {"xml_parser/full-indent-x16", measure_xml_parser(
+            cfg::test::widen_indentation(cfg::test::full_config, 16))},
+        {"xml_parser/minimal", measure_xml_parser(cfg::test::minimal_config)},
+        {"message_parser/full", measure_message_parser(message)}};
+
+    auto baseline = read_baseline(baseline_file);
+    if (update or baseline.empty()) {
+        auto stream = std::ofstream{baseline_file};
+        for (auto const& [name, throughput] : results) {
+            stream << name << ' ' << throughput << '\n';
+            std::printf("%-28s %10.2f MB/s (recorded)\n", name.c_str(), throughput / 1e6);
+        }
+        return stream ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    auto regressed = false;
+    for (auto const& [name, throughput] : results) {
+        auto const entry = baseline.find(name);
+        if (entry == baseline.end()) {
+            std::printf("%-28s %10.2f MB/s (no baseline)\n", name.c_str(), throughput / 1e6);
+            continue;
+        }
+        auto const ratio = throughput / entry->second;
+        auto const slower = ratio < 1.0 - threshold;
+        regressed = regressed or slower;
+        std::printf("%-28s %10.2f MB/s, baseline %10.2f MB/s (%+.1f%%)%s\n",
+            name.c_str(), throughput / 1e6, entry->second / 1e6, (ratio - 1.0) * 100.0,
+            slower ? " REGRESSED" : "");
+    }
+    return regressed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,40 @@
+/**
+ * @file fuzz-seeds.h
+ * @brief Seed inputs of a fuzzer, for the replay driver.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_TESTS_FUZZING_FUZZ_SEEDS_H
+#define CFG_TESTS_FUZZING_FUZZ_SEEDS_H
+
+#include <string>
+#include <vector>
+
+/**
+ * @namespace cfg::fuzz
+ * 
+ * @brief Contains the fuzz targets of the host build.
+ */
+namespace cfg::fuzz {
+
+/**
+ * @brief Gets the inputs that the replay driver starts mutating from.
+ * 
+ * @details Each fuzzer defines its own seed inputs. When a fuzzer is built with
+ * libFuzzer, the seed inputs are not used, and a corpus directory is passed instead.
+ */
+auto seed_inputs() -> std::vector<std::string>;
+
+} // namespace cfg::fuzz
+
+#endif
@@ -0,0 +1,259 @@
+/**
+ * @file fuzz-targets.h
+ * @brief Fuzz targets of the SAXML tokenizer, the XML parser and the message parser.
+ * 
+ * @details Each target feeds arbitrary bytes to a parser and aborts when a property
+ * that must hold for every input is violated. Memory errors are left to the sanitizers
+ * that the fuzzers are built with. The properties are:
+ * 
+ * - SAXML reports the same events, at the same positions, whether it is fed block by
+ *   block with saxml_HandleBuffer or character by character with
+ *   saxml_HandleCharacter, for any split of the input into blocks.
+ * - Processing a config file at once or block by block results in the same main
+ *   configuration object and the same errors.
+ * - A config message decodes to the same values with or without its generated
+ *   decoder, and writing the decoded values back results in the same message.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_TESTS_FUZZING_FUZZ_TARGETS_H
+#define CFG_TESTS_FUZZING_FUZZ_TARGETS_H
+
+#include <config.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+/**
+ * @namespace cfg::fuzz
+ * 
+ * @brief Contains the fuzz targets of the host build.
+ */
+namespace cfg::fuzz {
+
+/**
+ * @namespace detail
+ * 
+ * @brief Provides helper/meta functions/types local to this header file.
+ */
+namespace detail {
+
+/**
+ * @brief Aborts the fuzzer, so that it records the input that violated a property.
+ * 
+ * @param[in] property Description of the violated property.
+ */
+[[noreturn]]
+inline auto violated(char const* property) -> void {
+    std::fprintf(stderr, "property violated: %s\n", property);
+    std::abort();
+}
+
+/**
+ * @class saxml_trace
+ * 
+ * @brief Records every event of a SAXML parser, along with the position it occurs at.
+ */
+class saxml_trace {
+public:
+    /**
+     * @brief Constructs a trace with its own parser state and string buffer.
+     */
+    saxml_trace() {
+        context = tSaxmlContext{this,
+            &on_event<'<'>, &on_event<'/'>, &on_event<'='>, &on_event<'#'>,
+            &on_event<'@'>};
+        parser = saxml_InitializeWithStorage(
+            &state, &context, buffer.data(), static_cast<std::uint32_t>(buffer.size()));
+    }
+
+    saxml_trace(saxml_trace const&) = delete;
+    auto operator=(saxml_trace const&) -> saxml_trace& = delete;
+
+    /**
+     * @brief Feeds a single character to the parser.
+     */
+    auto handle_character(char character) -> void
+    { saxml_HandleCharacter(parser, character); }
+
+    /**
+     * @brief Feeds a block of characters to the parser.
+     */
+    auto handle_buffer(std::string_view block) -> void
+    { saxml_HandleBuffer(parser, block.data(), block.size()); }
+
+    /**
+     * @brief Gets the recorded events.
+     */
+    [[nodiscard]]
+    auto events() const -> std::string const&
+    { return events_; }
+
+private:
+    /**
+     * @brief Records an event of the given kind.
+     */
+    template<char Kind>
+    static auto on_event(void* cookie, char const* text) -> void {
+        auto& trace = *static_cast<saxml_trace*>(cookie);
+        auto line = std::uint32_t{};
+        auto column = std::uint32_t{};
+        saxml_GetPosition(trace.parser, &line, &column);
+        trace.events_ += Kind;
+        trace.events_ += text;
+        trace.events_ += '\0';
+        trace.events_ += std::to_string(line) + ':' + std::to_string(column) + '\n';
+    }
+
+    tSaxmlState state{};              /**< Storage of the parser. */
+    tSaxmlContext context{};          /**< Event handlers of the parser. */
+    std::array<char, 32> buffer{};    /**< Storage of the parsed strings. */
+    tSaxmlParser parser{};            /**< Instance of the parser. */
+    std::string events_;              /**< Recorded events. */
+};
+
+/**
+ * @brief Splits data into blocks of sizes that are derived from the data itself.
+ * 
+ * @param[in] data Data to split.
+ * @param[in] seed Byte that selects the sizes of the blocks.
+ * @param[in] handle_block Invoked with each block, in order.
+ */
+template<typename BlockHandler>
+auto split_blocks(std::string_view data, std::uint8_t seed, BlockHandler&& handle_block)
+-> void {
+    auto size = std::size_t{seed % 64u} + 1;
+    while (not data.empty()) {
+        auto const block = data.substr(0, size);
+        handle_block(block);
+        data.remove_prefix(block.size());
+        size = (size * 5 + seed) % 64 + 1;
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Checks that SAXML tokenizes blocks the same way as single characters.
+ * 
+ * @param[in] data Input to tokenize. Its first byte selects how it is split into blocks.
+ * @param[in] size Number of bytes of input.
+ */
+inline auto fuzz_saxml(std::uint8_t const* data, std::size_t size) -> void {
+    if (size == 0) return;
+    auto const seed = data[0];
+    auto const input = std::string_view{reinterpret_cast<char const*>(data) + 1, size - 1};
+
+    auto by_character = detail::saxml_trace{};
+    for (auto const character : input) by_character.handle_character(character);
+
+    auto by_block = detail::saxml_trace{};
+    detail::split_blocks(input, seed, [&](std::string_view block) {
+        by_block.handle_buffer(block);
+    });
+
+    if (by_character.events() != by_block.events()) {
+        detail::violated("saxml_HandleBuffer differs from saxml_HandleCharacter");
+    }
+}
+
+/**
+ * @brief Checks that a config file is processed the same way, at once or in blocks.
+ * 
+ * @param[in] data Contents of the config file. Its first byte selects how it is split
+ * into blocks.
+ * @param[in] size Number of bytes of input.
+ */
+inline auto fuzz_xml_parser(std::uint8_t const* data, std::size_t size) -> void {
+    if (size == 0) return;
+    auto const seed = data[0];
+    auto const config = std::string_view{reinterpret_cast<char const*>(data) + 1, size - 1};
+
+    auto at_once = config_handler<xml_parser>{};
+    at_once.process_config(config);
+    auto in_blocks = config_handler<xml_parser>{};
+    in_blocks.process_config_blocks([&](auto&& handle_block) {
+        detail::split_blocks(config, seed, handle_block);
+        return true;
+    });
+
+    if (at_once.get_main_config() != in_blocks.get_main_config()) {
+        detail::violated("config file in blocks results in another main config");
+    }
+    if (at_once.has_config_errors() != in_blocks.has_config_errors()) {
+        detail::violated("config file in blocks results in other errors");
+    }
+    static_cast<void>(at_once.verify_main_config());
+}
+
+/**
+ * @brief Checks that config messages are decoded and written back consistently.
+ * 
+ * @param[in] data Contents of the config message, of which at most the first 64 bytes
+ * are used.
+ * @param[in] size Number of bytes of input.
+ */
+inline auto fuzz_message_parser(std::uint8_t const* data, std::size_t size) -> void {
+    auto message = std::array<std::byte, bitspan::byte_boundary>{};
+    size = std::min(size, message.size());
+    std::transform(data, data + size, message.begin(),
+        [](std::uint8_t byte) { return static_cast<std::byte>(byte); });
+    auto const input = message_data{message.data(), static_cast<std::uint_least8_t>(size)};
+
+    auto decoded = default_setting_table{};
+    auto decoding = message_parser{decoded};
+    decoding.set_decoder(default_message_decoder{});
+    decoding.parse_config(input);
+
+    auto extracted = default_setting_table{};
+    auto extracting = message_parser{extracted};
+    extracting.parse_config(input);
+
+    if (decoding.has_parsing_errors() != extracting.has_parsing_errors()) {
+        detail::violated("message decoder reports other errors than extraction");
+    }
+    for (auto idx = std::size_t{}; idx < decoded.size(); ++idx) {
+        if (decoded[idx].view_value() != extracted[idx].view_value()) {
+            detail::violated("message decoder differs from extraction");
+        }
+    }
+
+    auto cfg_handler = config_handler<message_parser>{};
+    static_cast<void>(cfg_handler.process_config(input));
+    static_cast<void>(cfg_handler.verify_main_config());
+    if (decoding.has_parsing_errors()) return;
+
+    auto written = std::array<std::byte, bitspan::byte_boundary>{};
+    if (write_config_message(decoded, written.data(), written.size()) != size) {
+        detail::violated("decoded message cannot be written back");
+    }
+    auto reparsed = default_setting_table{};
+    auto reparsing = message_parser{reparsed};
+    reparsing.parse_config(
+        message_data{written.data(), static_cast<std::uint_least8_t>(size)});
+    for (auto idx = std::size_t{}; idx < decoded.size(); ++idx) {
+        if (decoded[idx].view_value() != reparsed[idx].view_value()) {
+            detail::violated("written message decodes to other values");
+        }
+    }
+}
+
+} // namespace cfg::fuzz
+
+#endif
@@ -0,0 +1,38 @@
+/**
+ * @file message-fuzzer.cpp
+ * @brief Fuzzer of the message parser and its writer.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#include "fuzz-targets.h"
+#include "fuzz-seeds.h"
+
+#include <config.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(std::uint8_t const* data, std::size_t size) {
+    cfg::fuzz::fuzz_message_parser(data, size);
+    return 0;
+}
+
+auto cfg::fuzz::seed_inputs() -> std::vector<std::string> {
+    auto random_message = std::string(cfg::bitspan::byte_boundary, '\0');
+    auto generator = std::mt19937{39};
+    for (auto& byte : random_message) byte = static_cast<char>(generator());
+    return {std::string(cfg::bitspan::byte_boundary, '\0'), random_message};
+}
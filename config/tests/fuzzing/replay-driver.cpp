@@ -0,0 +1,138 @@
+/**
+ * @file replay-driver.cpp
+ * @brief Runs a fuzzer without libFuzzer, so that every compiler can build it.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#include "fuzz-seeds.h"
+
+#include <logger.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(std::uint8_t const* data, std::size_t size);
+
+namespace {
+
+/**
+ * @brief Runs the fuzz target on a single input.
+ */
+auto run(std::string const& input) -> void {
+    LLVMFuzzerTestOneInput(
+        reinterpret_cast<std::uint8_t const*>(input.data()), input.size());
+}
+
+/**
+ * @brief Mutates an input in one of the ways that libFuzzer mutates inputs.
+ * 
+ * @param[in,out] input Input to mutate.
+ * @param[in] other Another input, which is spliced into the input by some mutations.
+ * @param[in,out] generator Source of the pseudo-random choices.
+ */
+auto mutate(std::string& input, std::string const& other, std::mt19937& generator)
+-> void {
+    auto const pick = [&](std::size_t bound) {
+        return bound == 0 ? std::size_t{} : std::size_t{generator()} % bound;
+    };
+    auto const position = pick(input.size() + 1);
+    switch (pick(6)) {
+    case 0:
+        if (position < input.size()) input[position] ^= static_cast<char>(1u << pick(8));
+        break;
+    case 1:
+        if (position < input.size()) input[position] = static_cast<char>(generator());
+        break;
+    case 2:
+        input.insert(position, 1, static_cast<char>(generator()));
+        break;
+    case 3:
+        input.erase(position, pick(8) + 1);
+        break;
+    case 4: {
+        auto const start = pick(input.size() + 1);
+        input.insert(position, input.substr(start, pick(16) + 1));
+        break;
+    }
+    default: {
+        auto const start = pick(other.size() + 1);
+        input.replace(position, pick(16), other.substr(start, pick(32) + 1));
+        break;
+    }
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Replays the given inputs, or mutates the seed inputs of the fuzzer.
+ * 
+ * @details Usage: fuzzer [--runs N] [--seed S] [input files...]. When input files are
+ * given, such as crashing inputs found by libFuzzer, only those are run. Otherwise, the
+ * seed inputs are run, followed by N mutated inputs. Each mutated input is derived from
+ * an earlier one, so that mutations stack up over the runs.
+ */
+int main(int argc, char* argv[]) {
+    auto runs = 10'000ul;
+    auto seed = 0ul;
+    auto files = std::vector<char const*>{};
+    for (auto idx = 1; idx < argc; ++idx) {
+        if (std::strcmp(argv[idx], "--runs") == 0 and idx + 1 < argc) {
+            runs = std::strtoul(argv[++idx], nullptr, 10);
+        } else if (std::strcmp(argv[idx], "--seed") == 0 and idx + 1 < argc) {
+            seed = std::strtoul(argv[++idx], nullptr, 10);
+        } else {
+            files.push_back(argv[idx]);
+        }
+    }
+    logger::enabled = false;
+
+    if (not files.empty()) {
+        for (auto const* file : files) {
+            auto stream = std::ifstream{file, std::ios::binary};
+            run({std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}});
+            std::printf("replayed %s\n", file);
+        }
+        return EXIT_SUCCESS;
+    }
+
+    auto pool = cfg::fuzz::seed_inputs();
+    for (auto const& input : pool) run(input);
+
+    auto generator = std::mt19937{static_cast<std::mt19937::result_type>(seed)};
+    constexpr auto max_pool_size = std::size_t{256};
+    for (auto count = 0ul; count < runs; ++count) {
+        auto input = pool[generator() % pool.size()];
+        auto const& other = pool[generator() % pool.size()];
+        auto const mutations = generator() % 4 + 1;
+        for (auto idx = 0u; idx < mutations; ++idx) mutate(input, other, generator);
+        run(input);
+        if (pool.size() < max_pool_size) {
+            pool.push_back(std::move(input));
+        } else {
+            pool[generator() % pool.size()] = std::move(input);
+        }
+    }
+    std::printf("ran %zu seed inputs and %lu mutated inputs\n",
+        cfg::fuzz::seed_inputs().size(), runs);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,37 @@
+/**
+ * @file xml-fuzzer.cpp
+ * @brief Fuzzer of the XML parser, through the complete processing of config files.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#include "fuzz-targets.h"
+#include "fuzz-seeds.h"
+
+#include <sample-configs.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(std::uint8_t const* data, std::size_t size) {
+    cfg::fuzz::fuzz_xml_parser(data, size);
+    return 0;
+}
+
+auto cfg::fuzz::seed_inputs() -> std::vector<std::string> {
+    return {
+        '\x03' + std::string{cfg::test::full_config},
+        '\x10' + std::string{cfg::test::minimal_config},
+        "\x05<aether><usb detection=\"on\" detection-interval-ms=\"15000\"/></aether>"};
+}
@@ -0,0 +1,152 @@
+/**
+ * @file sample-configs.h
+ * @brief Sample config files that are shared by the tests, benchmarks and fuzzers.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_TESTS_SAMPLE_CONFIGS_H
+#define CFG_TESTS_SAMPLE_CONFIGS_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/**
+ * @namespace cfg::test
+ * 
+ * @brief Contains the test framework of the host build.
+ */
+namespace cfg::test {
+
+/**
+ * @var full_config
+ * 
+ * @brief Config file that sets every setting, with the light trigger disabled.
+ */
+inline constexpr auto full_config = std::string_view{R"(<aether>
+    <properties>
+        <name>test-device</name>
+    </properties>
+    <usb>
+        <detection>interval</detection>
+        <detection-interval-ms>15000</detection-interval-ms>
+    </usb>
+    <trigger>
+        <time>
+            <enabled>1</enabled>
+            <interval-ms>30000</interval-ms>
+            <activate-sensors>
+                <thp>1</thp>
+                <accel-gyro>0</accel-gyro>
+                <magnet>1</magnet>
+                <light>0</light>
+            </activate-sensors>
+            <write-to>
+                <lorawan-priority>2</lorawan-priority>
+                <lora>1</lora>
+                <sd>0</sd>
+            </write-to>
+        </time>
+        <light>
+            <enabled>0</enabled>
+            <low-threshold>500</low-threshold>
+            <high-threshold>9000</high-threshold>
+            <activate-sensors>
+                <thp>1</thp>
+                <accel-gyro>1</accel-gyro>
+                <magnet>1</magnet>
+                <light>1</light>
+            </activate-sensors>
+            <write-to>
+                <lorawan-priority>1</lorawan-priority>
+                <lora>1</lora>
+                <sd>1</sd>
+            </write-to>
+        </light>
+        <acceleration>
+            <enabled>1</enabled>
+            <activate-sensors>
+                <thp>0</thp>
+                <accel-gyro>1</accel-gyro>
+                <magnet>0</magnet>
+                <light>0</light>
+            </activate-sensors>
+            <write-to>
+                <lorawan-priority>3</lorawan-priority>
+                <lora>0</lora>
+                <sd>1</sd>
+            </write-to>
+        </acceleration>
+        <orientation>
+            <enabled>1</enabled>
+            <activate-sensors>
+                <thp>1</thp>
+                <accel-gyro>1</accel-gyro>
+                <magnet>1</magnet>
+                <light>1</light>
+            </activate-sensors>
+            <write-to>
+                <lorawan-priority>0</lorawan-priority>
+                <lora>1</lora>
+                <sd>1</sd>
+            </write-to>
+        </orientation>
+    </trigger>
+</aether>
+)"};
+
+/**
+ * @var minimal_config
+ * 
+ * @brief Config file that disables every trigger, so that only a few settings are set.
+ */
+inline constexpr auto minimal_config = std::string_view{R"(<aether>
+    <usb>
+        <detection>on</detection>
+        <detection-interval-ms>15000</detection-interval-ms>
+    </usb>
+    <trigger>
+        <time><enabled>0</enabled></time>
+        <light><enabled>0</enabled></light>
+        <acceleration><enabled>0</enabled></acceleration>
+        <orientation><enabled>0</enabled></orientation>
+    </trigger>
+</aether>
+)"};
+
+/**
+ * @brief Makes a larger variant of a config file by widening its indentation.
+ * 
+ * @param[in] config Contents of the config file.
+ * @param[in] scale Number of times that each indentation is repeated.
+ * 
+ * @return Contents of the larger config file, which holds the same settings.
+ */
+inline auto widen_indentation(std::string_view config, std::size_t scale)
+-> std::string {
+    auto result = std::string{};
+    auto indenting = false;
+    for (auto const character : config) {
+        if (indenting and character == ' ') {
+            result.append(scale, ' ');
+            continue;
+        }
+        indenting = character == '\n';
+        result.push_back(character);
+    }
+    return result;
+}
+
+} // namespace cfg::test
+
+#endif
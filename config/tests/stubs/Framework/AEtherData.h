@@ -0,0 +1,22 @@
+/**
+ * @file AEtherData.h
+ * @brief Host stand-in for the shared data types of the framework.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_TESTS_STUBS_FRAMEWORK_AETHER_DATA_H
+#define CFG_TESTS_STUBS_FRAMEWORK_AETHER_DATA_H
+
+enum class StatusIndicator { operational, failure };
+
+#endif
@@ -0,0 +1,151 @@
+/**
+ * @file Low_power_framework.hpp
+ * @brief Host stand-in for the configuration types of the low-power framework.
+ * 
+ * @details The types only hold the members that the config library reads and writes.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_TESTS_STUBS_FRAMEWORK_LOW_POWER_FRAMEWORK_HPP
+#define CFG_TESTS_STUBS_FRAMEWORK_LOW_POWER_FRAMEWORK_HPP
+
+#include <Framework/AEtherData.h>
+
+#include <cstdint>
+
+enum class USB_DETECTION { ON, INTERVAL, OFF };
+
+struct BMX160Config {
+    bool measure_accelerometer;
+    bool measure_gyroscope;
+    bool measure_magnetometer;
+    bool low_power;
+    bool detect_shocks;
+};
+
+struct BME280Config {
+    bool measure_pressure;
+    bool measure_temperature;
+    bool measure_humidity;
+    bool low_power;
+};
+
+struct VEML6030Config {
+    bool measure_light;
+    bool low_power;
+};
+
+struct Measure {
+    bool thp;
+    bool accel_gyro;
+    bool magnet;
+    bool light;
+};
+
+struct WriteTo {
+    bool lora;
+    bool sd;
+};
+
+struct TimeTrig {
+    bool enable;
+    std::uint32_t interval_ms;
+    Measure measure;
+    std::int8_t lorawan_priority;
+    WriteTo write_to;
+};
+
+struct LightTrig {
+    bool enable;
+    std::uint16_t low_threshold;
+    std::uint16_t high_threshold;
+    Measure measure;
+    std::int8_t lorawan_priority;
+    WriteTo write_to;
+};
+
+struct Trig {
+    bool enable;
+    Measure measure;
+    std::int8_t lorawan_priority;
+    WriteTo write_to;
+};
+
+struct Triggers {
+    TimeTrig time;
+    LightTrig light;
+    Trig acceleration;
+    Trig orientation;
+};
+
+struct LowPowerFrameworkConfig {
+    StatusIndicator status;
+    USB_DETECTION usb_detection;
+    std::uint32_t usb_detection_interval_ms;
+    BMX160Config bmx160;
+    BME280Config bme280;
+    VEML6030Config veml6030;
+    Triggers trigger;
+};
+
+constexpr bool operator==(Measure const& lhs, Measure const& rhs) {
+    return lhs.thp == rhs.thp and lhs.accel_gyro == rhs.accel_gyro
+        and lhs.magnet == rhs.magnet and lhs.light == rhs.light;
+}
+
+constexpr bool operator==(WriteTo const& lhs, WriteTo const& rhs)
+{ return lhs.lora == rhs.lora and lhs.sd == rhs.sd; }
+
+constexpr bool operator==(TimeTrig const& lhs, TimeTrig const& rhs) {
+    return lhs.enable == rhs.enable and lhs.interval_ms == rhs.interval_ms
+        and lhs.measure == rhs.measure and lhs.lorawan_priority == rhs.lorawan_priority
+        and lhs.write_to == rhs.write_to;
+}
+
+constexpr bool operator==(LightTrig const& lhs, LightTrig const& rhs) {
+    return lhs.enable == rhs.enable and lhs.low_threshold == rhs.low_threshold
+        and lhs.high_threshold == rhs.high_threshold and lhs.measure == rhs.measure
+        and lhs.lorawan_priority == rhs.lorawan_priority
+        and lhs.write_to == rhs.write_to;
+}
+
+constexpr bool operator==(Trig const& lhs, Trig const& rhs) {
+    return lhs.enable == rhs.enable and lhs.measure == rhs.measure
+        and lhs.lorawan_priority == rhs.lorawan_priority
+        and lhs.write_to == rhs.write_to;
+}
+
+constexpr bool operator==(Triggers const& lhs, Triggers const& rhs) {
+    return lhs.time == rhs.time and lhs.light == rhs.light
+        and lhs.acceleration == rhs.acceleration and lhs.orientation == rhs.orientation;
+}
+
+constexpr bool operator!=(Measure const& lhs, Measure const& rhs)
+{ return not (lhs == rhs); }
+
+constexpr bool operator!=(WriteTo const& lhs, WriteTo const& rhs)
+{ return not (lhs == rhs); }
+
+constexpr bool operator!=(TimeTrig const& lhs, TimeTrig const& rhs)
+{ return not (lhs == rhs); }
+
+constexpr bool operator!=(LightTrig const& lhs, LightTrig const& rhs)
+{ return not (lhs == rhs); }
+
+constexpr bool operator!=(Trig const& lhs, Trig const& rhs)
+{ return not (lhs == rhs); }
+
+constexpr bool operator!=(Triggers const& lhs, Triggers const& rhs)
+{ return not (lhs == rhs); }
+
+#endif
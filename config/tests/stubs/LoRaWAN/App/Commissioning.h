@@ -0,0 +1,24 @@
+/**
+ * @file Commissioning.h
+ * @brief Host stand-in for the LoRaWAN commissioning parameters.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_TESTS_STUBS_LORAWAN_APP_COMMISSIONING_H
+#define CFG_TESTS_STUBS_LORAWAN_APP_COMMISSIONING_H
+
+#include <cstdint>
+
+inline constexpr std::uint8_t LORAWAN_DEVICE_EUI_D[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+
+#endif
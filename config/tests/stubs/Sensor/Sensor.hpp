@@ -0,0 +1,18 @@
+/**
+ * @file Sensor.hpp
+ * @brief Host stand-in for the sensor drivers, of which the config library only uses the
+ * configuration types of the low-power framework.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#include <Framework/LowPowerFramework/Low_power_framework.hpp>
@@ -0,0 +1,86 @@
+/**
+ * @file ff.h
+ * @brief Host stand-in for the FatFs API, which reads files from the host file system.
+ * 
+ * @details Only the part of the API that the config library uses is provided.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_TESTS_STUBS_FF_H
+#define CFG_TESTS_STUBS_FF_H
+
+#include <sys/stat.h>
+
+#include <cstdint>
+#include <cstdio>
+
+typedef unsigned int UINT;
+typedef unsigned char BYTE;
+typedef unsigned short WORD;
+typedef std::uint32_t FSIZE_t;
+
+typedef enum {
+    FR_OK = 0,
+    FR_DISK_ERR,
+    FR_INT_ERR,
+    FR_NOT_READY,
+    FR_NO_FILE,
+    FR_NO_PATH,
+    FR_INVALID_NAME
+} FRESULT;
+
+typedef struct {
+    std::FILE* fp;
+    FSIZE_t obj_size;
+} FIL;
+
+typedef struct {
+    FSIZE_t fsize;
+    WORD fdate;
+    WORD ftime;
+} FILINFO;
+
+#define FA_READ 0x01
+
+inline FRESULT f_open(FIL* fp, char const* path, BYTE) {
+    fp->fp = std::fopen(path, "rb");
+    if (fp->fp == nullptr) return FR_NO_FILE;
+    std::fseek(fp->fp, 0, SEEK_END);
+    fp->obj_size = static_cast<FSIZE_t>(std::ftell(fp->fp));
+    std::fseek(fp->fp, 0, SEEK_SET);
+    return FR_OK;
+}
+
+inline FRESULT f_read(FIL* fp, void* buff, UINT btr, UINT* br) {
+    *br = static_cast<UINT>(std::fread(buff, 1, btr, fp->fp));
+    return std::ferror(fp->fp) ? FR_DISK_ERR : FR_OK;
+}
+
+inline FRESULT f_close(FIL* fp) {
+    std::fclose(fp->fp);
+    fp->fp = nullptr;
+    return FR_OK;
+}
+
+#define f_size(fp) ((fp)->obj_size)
+
+inline FRESULT f_stat(char const* path, FILINFO* fno) {
+    struct stat status;
+    if (stat(path, &status) != 0) return FR_NO_FILE;
+    fno->fsize = static_cast<FSIZE_t>(status.st_size);
+    fno->fdate = static_cast<WORD>(status.st_mtime >> 16);
+    fno->ftime = static_cast<WORD>(status.st_mtime);
+    return FR_OK;
+}
+
+#endif
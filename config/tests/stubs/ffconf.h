@@ -0,0 +1,22 @@
+/**
+ * @file ffconf.h
+ * @brief Host stand-in for the configuration of FatFs.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_TESTS_STUBS_FFCONF_H
+#define CFG_TESTS_STUBS_FFCONF_H
+
+#define FF_MAX_LFN 255
+
+#endif
@@ -0,0 +1,42 @@
+/**
+ * @file logger.hpp
+ * @brief Host stand-in for the logger of the framework, which writes to the standard
+ * output instead of a file on the SD-card.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_TESTS_STUBS_LOGGER_HPP
+#define CFG_TESTS_STUBS_LOGGER_HPP
+
+#include <cstddef>
+#include <cstdio>
+
+class logger {
+public:
+    logger() = default;
+    logger(char const*, std::size_t) {}
+
+    logger& operator<<(char const* text) {
+        if (enabled) std::fputs(text, stdout);
+        return *this;
+    }
+
+    template<typename T>
+    logger& operator<<(T const&) { return *this; }
+
+    static inline bool enabled = true; /**< Allows tests to silence the output. */
+};
+
+inline logger aether_log;
+
+#endif
@@ -0,0 +1,32 @@
+/**
+ * @file sdcard.hpp
+ * @brief Host stand-in for the SD-card driver, which counts its power transitions.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_TESTS_STUBS_SDCARD_HPP
+#define CFG_TESTS_STUBS_SDCARD_HPP
+
+inline void SDCard_Clock_Config() {}
+
+namespace sd_card {
+
+inline int init_count = 0;  /**< Number of times the SD-card was woken up. */
+inline int sleep_count = 0; /**< Number of times the SD-card was put to sleep. */
+
+inline void init() { ++init_count; }
+inline void sleep() { ++sleep_count; }
+
+} // namespace sd_card
+
+#endif
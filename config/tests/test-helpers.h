@@ -0,0 +1,128 @@
+/**
+ * @file test-helpers.h
+ * @brief Helpers that are shared by the unit tests of the host build.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_TESTS_TEST_HELPERS_H
+#define CFG_TESTS_TEST_HELPERS_H
+
+#include <config.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * @namespace cfg::test
+ * 
+ * @brief Contains the test framework of the host build.
+ */
+namespace cfg::test {
+
+/**
+ * @struct message_buffer
+ * 
+ * @brief Buffer of a config message that has been written by a test.
+ */
+struct message_buffer {
+    std::array<std::byte, bitspan::byte_boundary> bytes{}; /**< Bytes of the message. */
+    std::size_t size{};                                    /**< Size of the message. */
+
+    /**
+     * @brief Gets the message as message-data, to be processed.
+     */
+    [[nodiscard]]
+    auto data() -> message_data
+    { return {bytes.data(), static_cast<std::uint_least8_t>(size)}; }
+};
+
+/**
+ * @brief Sets the value of a setting in the binary form that a message parser sets it
+ * in, from the integral value that its bitspan holds.
+ * 
+ * @param[in,out] settings Table of the default settings.
+ * @param[in] id Identifier of the setting.
+ * @param[in] value Integral value of the setting.
+ */
+inline auto set_binary_value(
+    default_setting_table& settings, setting_identifier id, std::uint_fast64_t value)
+-> void {
+    auto const setting_obj = settings[default_setting_table::find_index(id)];
+    setting_obj.set_value(value, (setting_obj.config_bits().size() + 7u) / 8u);
+}
+
+/**
+ * @brief Gets the binary form that a message parser sets the value of a setting in.
+ * 
+ * @param[in] id Identifier of the setting.
+ * @param[in] value Integral value of the setting.
+ * 
+ * @return Bytes of the binary value.
+ */
+inline auto binary_value(setting_identifier id, std::uint_fast64_t value) -> std::string {
+    auto settings = default_setting_table{};
+    set_binary_value(settings, id, value);
+    return std::string{settings[default_setting_table::find_index(id)].view_value()};
+}
+
+/**
+ * @brief Writes a delta message that sets the given settings to integral values.
+ * 
+ * @param[in] values Identifiers of the settings, along with their integral values.
+ * 
+ * @return Buffer of the written delta message.
+ */
+template<std::size_t N>
+auto make_delta_message(
+    std::array<std::pair<setting_identifier, std::uint_fast64_t>, N> const& values)
+-> message_buffer {
+    auto settings = default_setting_table{};
+    for (auto const& [id, value] : values) set_binary_value(settings, id, value);
+    auto message = message_buffer{};
+    message.size = write_delta_message(settings, message.bytes.data(), message.bytes.size());
+    return message;
+}
+
+/**
+ * @brief Makes a variant of a config file by replacing the first occurrence of a text.
+ * 
+ * @param[in] config Contents of the config file.
+ * @param[in] text Text to replace, which the config file is expected to contain.
+ * @param[in] replacement Text to replace it with, which may be empty.
+ * 
+ * @return Contents of the variant of the config file.
+ */
+inline auto replace_text(
+    std::string_view config, std::string_view text, std::string_view replacement)
+-> std::string {
+    auto result = std::string{config};
+    result.replace(result.find(text), text.size(), replacement);
+    return result;
+}
+
+/**
+ * @brief Processes a config file with a new config-handler.
+ * 
+ * @param[in] config Contents of the config file.
+ * 
+ * @return Main-config object, which is reset if it did not pass verification.
+ */
+inline auto process_config_text(std::string_view config) -> main_config
+{ return process_config(config_handler<xml_parser>{}, config); }
+
+} // namespace cfg::test
+
+#endif
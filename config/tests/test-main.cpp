@@ -0,0 +1,40 @@
+/**
+ * @file test-main.cpp
+ * @brief Entry point of each unit test executable of the host build.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#include "testing.h"
+
+#include <logger.hpp>
+
+#include <cstdio>
+
+/**
+ * @brief Runs every test case of the test executable.
+ * 
+ * @details The log of the config library is silenced, since the tests check its
+ * outcomes directly.
+ * 
+ * @return Zero if every check passed, one otherwise.
+ */
+int main() {
+    logger::enabled = false;
+    for (auto const& entry : cfg::test::test_cases()) {
+        auto const failed_before = cfg::test::failed_checks;
+        entry.run();
+        std::printf("%s %s\n",
+            cfg::test::failed_checks == failed_before ? "[ OK ]" : "[FAIL]", entry.name);
+    }
+    return cfg::test::failed_checks == 0 ? 0 : 1;
+}
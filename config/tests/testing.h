@@ -0,0 +1,108 @@
+/**
+ * @file testing.h
+ * @brief Minimal test framework of the host build, which needs no other dependencies.
+ * 
+ * @details Each test file defines its test cases with @ref CFG_TEST_CASE and checks its
+ * expectations with @ref CFG_CHECK. Every test executable is linked with test-main.cpp,
+ * which runs each test case and fails if any of the checks failed.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_TESTS_TESTING_H
+#define CFG_TESTS_TESTING_H
+
+#include <cstdio>
+#include <vector>
+
+/**
+ * @namespace cfg::test
+ * 
+ * @brief Contains the test framework of the host build.
+ */
+namespace cfg::test {
+
+/**
+ * @struct test_case
+ * 
+ * @brief Test case that has been registered with @ref CFG_TEST_CASE.
+ */
+struct test_case {
+    char const* name; /**< Name of the test case. */
+    void (*run)();    /**< Function that runs the test case. */
+};
+
+/**
+ * @brief Gets the test cases of the test executable, in order of registration.
+ */
+inline auto test_cases() -> std::vector<test_case>& {
+    static auto cases = std::vector<test_case>{};
+    return cases;
+}
+
+/**
+ * @var failed_checks
+ * 
+ * @brief Number of checks that failed within the current test executable.
+ */
+inline auto failed_checks = 0;
+
+/**
+ * @struct registrar
+ * 
+ * @brief Registers a test case when it is constructed.
+ */
+struct registrar {
+    registrar(char const* name, void (*run)())
+    { test_cases().push_back({name, run}); }
+};
+
+/**
+ * @brief Records the outcome of a single check.
+ * 
+ * @param[in] passed Indicates whether the check passed.
+ * @param[in] expression Text of the checked expression.
+ * @param[in] file Name of the file that contains the check.
+ * @param[in] line Line number of the check.
+ * 
+ * @return The value of passed, so that a test case can stop on a failed check.
+ */
+inline auto check(bool passed, char const* expression, char const* file, int line)
+-> bool {
+    if (not passed) {
+        ++failed_checks;
+        std::printf("%s:%d: check failed: %s\n", file, line, expression);
+    }
+    return passed;
+}
+
+} // namespace cfg::test
+
+/**
+ * @def CFG_TEST_CASE
+ * 
+ * @brief Defines and registers a test case with the given name.
+ */
+#define CFG_TEST_CASE(name)                                                     \
+    static void name();                                                         \
+    static ::cfg::test::registrar const name##_registrar{#name, &name};         \
+    static void name()
+
+/**
+ * @def CFG_CHECK
+ * 
+ * @brief Checks that an expression is true, and continues the test case either way.
+ */
+#define CFG_CHECK(...) \
+    ::cfg::test::check(static_cast<bool>(__VA_ARGS__), #__VA_ARGS__, __FILE__, __LINE__)
+
+#endif
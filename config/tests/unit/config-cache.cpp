@@ -0,0 +1,132 @@
+/**
+ * @file config-cache.cpp
+ * @brief Unit tests of the cache of the main configuration object of a config file.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+// The stages are counted, to tell if a file was parsed. The host has no cycle counter.
+#define CFG_CONFIG_PROFILING 1
+#define CFG_CONFIG_PROFILING_START() ((void)0)
+#define CFG_CONFIG_PROFILING_CYCLES() (std::uint32_t{})
+#define CFG_CONFIG_PROFILING_STACK_WINDOW 256
+
+#include <sample-configs.h>
+#include <test-helpers.h>
+#include <testing.h>
+
+#include <config.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <new>
+#include <string_view>
+
+#include <sys/stat.h>
+#include <utime.h>
+
+namespace {
+
+/**
+ * @var config_filename
+ * 
+ * @brief Name of the config file that the tests write, within the working directory.
+ */
+constexpr auto config_filename = "config-cache-test.xml";
+
+/**
+ * @brief Writes the config file, while keeping the modification time of an earlier one.
+ * 
+ * @param[in] config Contents of the config file.
+ * @param[in] mtime Modification time to give to the file, or zero to keep the new one.
+ */
+auto write_config_file(std::string_view config, time_t mtime = 0) -> void {
+    auto* const file = std::fopen(config_filename, "wb");
+    std::fwrite(config.data(), 1, config.size(), file);
+    std::fclose(file);
+    if (mtime == 0) return;
+
+    auto times = utimbuf{mtime, mtime};
+    utime(config_filename, &times);
+}
+
+/**
+ * @brief Gets the modification time of the config file.
+ */
+auto get_mtime() -> time_t {
+    struct stat status;
+    stat(config_filename, &status);
+    return status.st_mtime;
+}
+
+/**
+ * @brief Gets the number of times a stage was entered while processing the last file.
+ */
+auto stage_entries(cfg::config_stage stage) -> std::uint32_t
+{ return cfg::get_config_profiler().get_profile()[stage].entries; }
+
+} // namespace
+
+CFG_TEST_CASE(unchanged_file_is_restored_from_the_cache) {
+    write_config_file(cfg::test::full_config);
+    auto entry = cfg::config_cache_entry{};
+    auto const processed = cfg::process_config_file(config_filename, cfg::config_cache{entry});
+    CFG_CHECK(processed.framework.status != StatusIndicator::failure);
+    CFG_CHECK(stage_entries(cfg::config_stage::parse) != 0);
+
+    auto stamp = cfg::file_stamp{};
+    CFG_CHECK(not cfg::get_file_stamp(config_filename, stamp));
+    CFG_CHECK(cfg::config_cache{entry}.matches(stamp));
+    CFG_CHECK(cfg::process_config_file(config_filename, cfg::config_cache{entry}) == processed);
+    CFG_CHECK(stage_entries(cfg::config_stage::load) != 0);
+    CFG_CHECK(stage_entries(cfg::config_stage::parse) == 0);
+    CFG_CHECK(stage_entries(cfg::config_stage::apply) == 0);
+    CFG_CHECK(stage_entries(cfg::config_stage::verify) == 0);
+
+    auto const other_schema = cfg::default_config_schema + 1;
+    CFG_CHECK(not cfg::config_cache{entry, other_schema}.matches(stamp));
+    std::remove(config_filename);
+}
+
+CFG_TEST_CASE(changed_file_with_the_same_stamp_is_processed) {
+    write_config_file(cfg::test::full_config);
+    auto entry = cfg::config_cache_entry{};
+    auto const processed = cfg::process_config_file(config_filename, cfg::config_cache{entry});
+    CFG_CHECK(processed.framework.trigger.time.interval_ms == 30'000);
+
+    write_config_file(cfg::test::replace_text(cfg::test::full_config,
+        "<interval-ms>30000", "<interval-ms>40000"), get_mtime());
+    auto const changed = cfg::process_config_file(config_filename, cfg::config_cache{entry});
+    CFG_CHECK(changed.framework.trigger.time.interval_ms == 40'000);
+    std::remove(config_filename);
+}
+
+CFG_TEST_CASE(cache_over_retained_storage_is_restored_after_a_reset) {
+    write_config_file(cfg::test::full_config);
+    auto stamp = cfg::file_stamp{};
+    CFG_CHECK(not cfg::get_file_stamp(config_filename, stamp));
+
+    alignas(cfg::config_cache_entry) std::byte storage[sizeof(cfg::config_cache_entry)];
+    std::memset(storage, 0xA5, sizeof(storage));
+    auto* const garbage = new (storage) cfg::config_cache_entry;
+    CFG_CHECK(not cfg::config_cache{*garbage}.matches(stamp));
+    auto const processed = cfg::process_config_file(config_filename, cfg::config_cache{*garbage});
+
+    // after a reset, a new entry is default-initialized over the retained storage
+    auto* const retained = new (storage) cfg::config_cache_entry;
+    CFG_CHECK(cfg::config_cache{*retained}.matches(stamp));
+    CFG_CHECK(cfg::process_config_file(config_filename, cfg::config_cache{*retained}) == processed);
+    CFG_CHECK(stage_entries(cfg::config_stage::parse) == 0);
+    std::remove(config_filename);
+}
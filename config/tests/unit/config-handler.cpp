@@ -0,0 +1,49 @@
+/**
+ * @file config-handler.cpp
+ * @brief Unit tests of the config-handler.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#include <test-helpers.h>
+#include <testing.h>
+
+#include <config.h>
+
+using cfg::setting_identifier;
+
+CFG_TEST_CASE(message_setting_is_set_in_binary_form) {
+    auto cfg_handler = cfg::config_handler<cfg::message_parser>{};
+    auto const& framework = cfg_handler.get_main_config().framework;
+
+    auto const first = cfg::test::binary_value(setting_identifier::usb_interval_ms, 15'000);
+    CFG_CHECK(not cfg_handler.set_setting(setting_identifier::usb_interval_ms, first).empty());
+    CFG_CHECK(not cfg_handler.has_config_errors());
+    CFG_CHECK(framework.usb_detection_interval_ms == 15'000);
+
+    auto const second = cfg::test::binary_value(setting_identifier::usb_interval_ms, 60'000);
+    CFG_CHECK(not cfg_handler.set_setting(setting_identifier::usb_interval_ms, second).empty());
+    CFG_CHECK(framework.usb_detection_interval_ms == 60'000);
+
+    auto const invalid = cfg::test::binary_value(setting_identifier::usb_interval_ms, 10);
+    CFG_CHECK(cfg_handler.set_setting(setting_identifier::usb_interval_ms, invalid).empty());
+    CFG_CHECK(cfg_handler.has_config_errors());
+    CFG_CHECK(framework.usb_detection_interval_ms == 60'000);
+}
+
+CFG_TEST_CASE(file_setting_is_set_as_text) {
+    auto cfg_handler = cfg::config_handler<cfg::xml_parser>{};
+    cfg_handler.set_setting(setting_identifier::usb_interval_ms, "15000");
+    cfg_handler.set_setting(setting_identifier::usb_interval_ms, "60000");
+    CFG_CHECK(not cfg_handler.has_config_errors());
+    CFG_CHECK(cfg_handler.get_main_config().framework.usb_detection_interval_ms == 60'000);
+}
@@ -0,0 +1,85 @@
+/**
+ * @file device-config.cpp
+ * @brief Unit tests of the configs that are compiled for the devices of a fleet.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#include <testing.h>
+
+#include <config.h>
+
+#include <array>
+#include <cstddef>
+
+using cfg::embedded_value;
+using cfg::setting_identifier;
+
+namespace {
+
+/**
+ * @var fleet_values
+ * 
+ * @brief Values that are shared by the fleet, which only enable the time trigger.
+ */
+constexpr auto fleet_values = std::array{
+    embedded_value{setting_identifier::usb_detection, "on"},
+    embedded_value{setting_identifier::usb_interval_ms, "15000"},
+    embedded_value{setting_identifier::time_trigger_enabled, "1"},
+    embedded_value{setting_identifier::time_trigger_interval, "30000"},
+    embedded_value{setting_identifier::time_trigger_thp, "1"},
+    embedded_value{setting_identifier::time_trigger_acc_gyro, "0"},
+    embedded_value{setting_identifier::time_trigger_magnetometer, "0"},
+    embedded_value{setting_identifier::time_trigger_light_intensity, "0"},
+    embedded_value{setting_identifier::time_trigger_lora_priority, "1"},
+    embedded_value{setting_identifier::time_trigger_write_to_lora, "1"},
+    embedded_value{setting_identifier::time_trigger_write_to_sd, "0"},
+    embedded_value{setting_identifier::light_trigger_enabled, "0"},
+    embedded_value{setting_identifier::acceleration_trigger_enabled, "0"},
+    embedded_value{setting_identifier::orientation_trigger_enabled, "0"}};
+
+static_assert(not cfg::check_embedded_config(fleet_values).error,
+    "The children of a disabled trigger may be left out.");
+
+/**
+ * @brief Makes the base settings of the fleet.
+ */
+auto make_fleet_settings() -> cfg::default_setting_table {
+    auto settings = cfg::default_setting_table{};
+    static_cast<void>(cfg::set_embedded_values(settings, fleet_values));
+    return settings;
+}
+
+} // namespace
+
+CFG_TEST_CASE(device_with_disabled_triggers_is_compiled) {
+    auto image = std::array<std::byte, 512>{};
+    auto const device = cfg::compile_device_config(make_fleet_settings(),
+        std::array{embedded_value{setting_identifier::device_name, "unit-1"}},
+        image.data(), image.size());
+    CFG_CHECK(device.is_compiled());
+    CFG_CHECK(device.main_cfg.framework.trigger.time.enable);
+    CFG_CHECK(not device.main_cfg.framework.trigger.light.enable);
+
+    auto const processed = cfg::process_config_image({image.data(), device.image_size});
+    CFG_CHECK(processed == device.main_cfg);
+}
+
+CFG_TEST_CASE(device_that_enables_a_trigger_needs_its_children) {
+    auto image = std::array<std::byte, 512>{};
+    auto const device = cfg::compile_device_config(make_fleet_settings(),
+        std::array{embedded_value{setting_identifier::light_trigger_enabled, "1"}},
+        image.data(), image.size());
+    CFG_CHECK(not device.is_compiled());
+    CFG_CHECK(device.error == cfg::error::code{cfg::validation_error::setting_unset,
+        cfg::to_underlying(setting_identifier::light_trigger_low_threshold)});
+}
@@ -0,0 +1,142 @@
+/**
+ * @file downlink-planner.cpp
+ * @brief Unit tests of the planning of downlinks that change a device's config.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#include <test-helpers.h>
+#include <testing.h>
+
+#include <config.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+using cfg::setting_identifier;
+
+namespace {
+
+/**
+ * @var max_frame_size
+ * 
+ * @brief Maximum payload size of a single downlink, as at a low data rate.
+ */
+constexpr auto max_frame_size = std::size_t{51};
+
+/**
+ * @brief Makes the settings of a config with both the time and light trigger enabled.
+ * 
+ * @param[in] light_enabled Value of the flag-setting of the light trigger.
+ */
+auto make_settings(bool light_enabled) -> cfg::default_setting_table {
+    auto settings = cfg::default_setting_table{};
+    for (auto [id, value] : std::array{
+        std::pair{setting_identifier::usb_interval_ms, std::uint_fast64_t{15'000}},
+        std::pair{setting_identifier::time_trigger_enabled, std::uint_fast64_t{1}},
+        std::pair{setting_identifier::time_trigger_interval, std::uint_fast64_t{30'000}},
+        std::pair{setting_identifier::time_trigger_thp, std::uint_fast64_t{1}},
+        std::pair{setting_identifier::time_trigger_lora_priority, std::uint_fast64_t{1}},
+        std::pair{setting_identifier::time_trigger_write_to_lora, std::uint_fast64_t{1}},
+        std::pair{setting_identifier::light_trigger_enabled,
+            std::uint_fast64_t{light_enabled}},
+        std::pair{setting_identifier::light_trigger_low_threshold, std::uint_fast64_t{500}},
+        std::pair{setting_identifier::light_trigger_high_threshold,
+            std::uint_fast64_t{9'000}},
+        std::pair{setting_identifier::light_trigger_light_intensity, std::uint_fast64_t{1}},
+        std::pair{setting_identifier::light_trigger_lora_priority, std::uint_fast64_t{2}},
+        std::pair{setting_identifier::light_trigger_write_to_sd, std::uint_fast64_t{1}}})
+    {
+        cfg::test::set_binary_value(settings, id, value);
+    }
+    for (auto&& setting_obj : settings) {
+        if (not setting_obj.is_set() and setting_obj.config_bits().size() != 0) {
+            setting_obj.set_value(0, (setting_obj.config_bits().size() + 7u) / 8u);
+        }
+    }
+    return settings;
+}
+
+/**
+ * @brief Plans the downlink from one config to another and processes it on the device.
+ * 
+ * @param[in] active Main-config object that is currently in use by the device.
+ * @param[in] current Settings of the config that is currently in use by the device.
+ * @param[in] target Settings of the config that the device should change to.
+ * 
+ * @return Main-config object that the device ends up with, or nothing if the planned
+ * downlink is not a message that changes part of the config.
+ */
+auto send_downlink(
+    cfg::main_config const& active,
+    cfg::default_setting_table const& current,
+    cfg::default_setting_table const& target
+) -> std::optional<cfg::main_config> {
+    auto frames = std::array<std::byte, 256>{};
+    auto const plan = cfg::plan_downlink(
+        current, target, max_frame_size, frames.data(), frames.size());
+    if (not plan) return std::nullopt;
+
+    auto const downlink = cfg::message_data{
+        frames.data(), static_cast<std::uint_least8_t>(plan->size)};
+    switch (plan->encoding) {
+    case cfg::downlink_encoding::delta:
+        return cfg::process_config_delta(active, downlink);
+    case cfg::downlink_encoding::packed:
+        return cfg::process_config_packed(active, downlink);
+    default:
+        return std::nullopt;
+    }
+}
+
+} // namespace
+
+CFG_TEST_CASE(trigger_is_disabled_and_enabled_again) {
+    auto const enabled = make_settings(true);
+    auto const disabled = make_settings(false);
+
+    auto initial = enabled;
+    initial[cfg::default_setting_table::find_index(setting_identifier::usb_detection)]
+        .set_value(std::string_view{});
+    auto message = cfg::test::message_buffer{};
+    message.size = cfg::write_delta_message(
+        initial, message.bytes.data(), message.bytes.size());
+    auto const active = cfg::process_config_delta(cfg::main_config{}, message.data());
+    CFG_CHECK(active.framework.status == StatusIndicator::operational);
+    CFG_CHECK(active.framework.trigger.light.enable);
+
+    auto const without_light = send_downlink(active, enabled, disabled);
+    CFG_CHECK(without_light.has_value());
+    if (not without_light) return;
+    CFG_CHECK(without_light->framework.status == StatusIndicator::operational);
+    CFG_CHECK(not without_light->framework.trigger.light.enable);
+    CFG_CHECK(without_light->framework.trigger.light.high_threshold == 9'000);
+
+    auto const with_light = send_downlink(*without_light, disabled, enabled);
+    CFG_CHECK(with_light.has_value());
+    if (not with_light) return;
+    CFG_CHECK(with_light->framework.status == StatusIndicator::operational);
+    CFG_CHECK(*with_light == active);
+}
+
+CFG_TEST_CASE(enabling_a_trigger_only_sends_its_flag) {
+    auto frames = std::array<std::byte, 256>{};
+    auto const plan = cfg::plan_downlink(make_settings(false), make_settings(true),
+        max_frame_size, frames.data(), frames.size());
+    CFG_CHECK(plan.has_value());
+    if (not plan) return;
+    CFG_CHECK(plan->encoding == cfg::downlink_encoding::delta);
+    CFG_CHECK(plan->frame_count == 1);
+}
@@ -0,0 +1,60 @@
+/**
+ * @file image-parser.cpp
+ * @brief Unit tests of the config image parser, through a config-handler that uses it.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#include <testing.h>
+
+#include <config.h>
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+using cfg::embedded_value;
+using cfg::setting_identifier;
+
+CFG_TEST_CASE(removed_record_is_unset_when_parsed_again) {
+    auto settings = cfg::default_setting_table{};
+    static_cast<void>(cfg::set_embedded_values(settings, std::array{
+        embedded_value{setting_identifier::usb_detection, "on"},
+        embedded_value{setting_identifier::usb_interval_ms, "15000"},
+        embedded_value{setting_identifier::time_trigger_enabled, "1"},
+        embedded_value{setting_identifier::time_trigger_interval, "30000"},
+        embedded_value{setting_identifier::time_trigger_thp, "1"},
+        embedded_value{setting_identifier::time_trigger_acc_gyro, "0"},
+        embedded_value{setting_identifier::time_trigger_magnetometer, "0"},
+        embedded_value{setting_identifier::time_trigger_light_intensity, "0"},
+        embedded_value{setting_identifier::time_trigger_lora_priority, "1"},
+        embedded_value{setting_identifier::time_trigger_write_to_lora, "1"},
+        embedded_value{setting_identifier::time_trigger_write_to_sd, "0"},
+        embedded_value{setting_identifier::light_trigger_enabled, "0"},
+        embedded_value{setting_identifier::acceleration_trigger_enabled, "0"},
+        embedded_value{setting_identifier::orientation_trigger_enabled, "0"}}));
+    auto full_image = std::array<std::byte, 512>{};
+    auto const full_size = cfg::write_config_image(
+        settings, full_image.data(), full_image.size());
+
+    settings[cfg::default_setting_table::find_index(setting_identifier::usb_interval_ms)]
+        .set_value(std::string_view{});
+    auto partial_image = std::array<std::byte, 512>{};
+    auto const partial_size = cfg::write_config_image(
+        settings, partial_image.data(), partial_image.size());
+
+    auto cfg_handler = cfg::config_handler<cfg::image_parser>{};
+    cfg_handler.process_config(cfg::image_data{full_image.data(), full_size});
+    CFG_CHECK(not cfg_handler.has_config_errors());
+    cfg_handler.process_config(cfg::image_data{partial_image.data(), partial_size});
+    CFG_CHECK(cfg_handler.has_config_errors());
+}
@@ -0,0 +1,64 @@
+/**
+ * @file message-fragments.cpp
+ * @brief Unit tests of the reassembly of fragmented config messages.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#include <testing.h>
+
+#include <config.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+CFG_TEST_CASE(frames_of_a_large_message_fit_in_message_data) {
+    auto message = std::array<std::byte, 251>{};
+    for (auto idx = std::size_t{}; idx < message.size(); ++idx) {
+        message[idx] = static_cast<std::byte>(idx * 7u);
+    }
+    auto const layout = cfg::make_fragment_layout(message.size(), 1'000);
+    CFG_CHECK(layout.frame_count == 2);
+    CFG_CHECK(layout.frame_size <= UINT8_MAX);
+
+    auto frames = std::array<std::byte, 512>{};
+    auto const size = cfg::write_message_fragments(
+        {message.data(), static_cast<std::uint_least8_t>(message.size())},
+        layout, frames.data(), frames.size());
+    CFG_CHECK(size == layout.size());
+
+    auto fragments = cfg::message_fragments<>{};
+    auto const last_size = size - layout.frame_size;
+    CFG_CHECK(fragments.add_fragment({frames.data() + layout.frame_size,
+        static_cast<std::uint_least8_t>(last_size)}) == cfg::fragment_status::pending);
+    CFG_CHECK(fragments.add_fragment({frames.data(),
+        static_cast<std::uint_least8_t>(layout.frame_size)})
+            == cfg::fragment_status::complete);
+    CFG_CHECK(fragments.size() == message.size());
+    CFG_CHECK(fragments.extract_bits(cfg::bitspan::make<8, 8>)
+        == std::to_integer<unsigned>(message[1]));
+}
+
+CFG_TEST_CASE(frame_of_the_maximum_size_keeps_its_payload) {
+    using fragments_t = cfg::message_fragments<>;
+    auto frame = std::array<std::byte, UINT8_MAX>{};
+    auto const crc = cfg::crc32(frame.data() + fragments_t::header_size,
+        frame.size() - fragments_t::header_size - fragments_t::checksum_size);
+    cfg::detail::write_le(frame.data() + frame.size() - fragments_t::checksum_size, crc);
+
+    auto fragments = fragments_t{};
+    CFG_CHECK(fragments.add_fragment({frame.data(), UINT8_MAX})
+        == cfg::fragment_status::complete);
+    CFG_CHECK(fragments.size()
+        == frame.size() - fragments_t::header_size - fragments_t::checksum_size);
+}
@@ -0,0 +1,103 @@
+/**
+ * @file setting-handler.cpp
+ * @brief Unit tests of the setting-handler, through the config-handlers that use it.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#include <sample-configs.h>
+#include <test-helpers.h>
+#include <testing.h>
+
+#include <config.h>
+
+#include <array>
+#include <string>
+#include <utility>
+
+using cfg::setting_identifier;
+
+CFG_TEST_CASE(disabled_trigger_keeps_its_values) {
+    auto cfg_handler = cfg::config_handler<cfg::xml_parser>{};
+    auto const config = cfg::test::replace_text(
+        cfg::test::full_config, "<enabled>1</enabled>", "<enabled>0</enabled>");
+
+    cfg_handler.process_config(cfg::test::full_config);
+    cfg_handler.process_config(std::string_view{config});
+    auto const& time = cfg_handler.get_main_config().framework.trigger.time;
+    CFG_CHECK(not cfg_handler.has_config_errors());
+    CFG_CHECK(not time.enable);
+    CFG_CHECK(time.interval_ms == 30'000);
+    CFG_CHECK(time.lorawan_priority == 2);
+    CFG_CHECK(time.write_to.lora);
+}
+
+CFG_TEST_CASE(disabled_trigger_needs_no_children) {
+    auto cfg_handler = cfg::config_handler<cfg::xml_parser>{};
+    cfg_handler.process_config(cfg::test::minimal_config);
+    CFG_CHECK(not cfg_handler.has_config_errors());
+}
+
+CFG_TEST_CASE(trigger_is_reenabled_by_delta) {
+    auto const active = cfg::test::process_config_text(cfg::test::full_config);
+    CFG_CHECK(active.framework.trigger.time.enable);
+
+    auto disable = cfg::test::make_delta_message(std::array{
+        std::pair{setting_identifier::time_trigger_enabled, std::uint_fast64_t{0}}});
+    auto const disabled = cfg::process_config_delta(active, disable.data());
+    CFG_CHECK(not disabled.framework.trigger.time.enable);
+    CFG_CHECK(disabled.framework.trigger.time.interval_ms == 30'000);
+    CFG_CHECK(disabled.framework.trigger.time.write_to.lora);
+
+    auto enable = cfg::test::make_delta_message(std::array{
+        std::pair{setting_identifier::time_trigger_enabled, std::uint_fast64_t{1}}});
+    auto const reenabled = cfg::process_config_delta(disabled, enable.data());
+    CFG_CHECK(reenabled.framework.status == StatusIndicator::operational);
+    CFG_CHECK(reenabled == active);
+}
+
+CFG_TEST_CASE(changed_value_is_applied_again) {
+    auto cfg_handler = cfg::config_handler<cfg::xml_parser>{};
+    auto const& framework = cfg_handler.get_main_config().framework;
+
+    // Both intervals have the same 32-bit FNV-1a hash, but not the same CRC-32.
+    for (auto const interval : {"944441", "1062997", "944441"}) {
+        auto const config = cfg::test::replace_text(cfg::test::full_config,
+            "<detection-interval-ms>15000", std::string{"<detection-interval-ms>"} + interval);
+        cfg_handler.process_config(std::string_view{config});
+        CFG_CHECK(not cfg_handler.has_config_errors());
+        CFG_CHECK(framework.usb_detection_interval_ms == std::stoul(interval));
+    }
+}
+
+CFG_TEST_CASE(unchanged_long_value_is_not_applied_again) {
+    auto const config = cfg::test::replace_text(cfg::test::full_config,
+        "<name>test-device</name>", "<name>a-long-test-device-name</name>");
+    auto settings = cfg::default_setting_table{};
+    auto parser = cfg::xml_parser{settings};
+    auto setting_handlr = cfg::setting_handler{settings};
+    auto main_cfg = cfg::main_config{};
+
+    parser.parse_config(std::string_view{config});
+    setting_handlr.apply_valid_settings(main_cfg);
+    CFG_CHECK(std::string_view{main_cfg.device_name.data()} == "a-long-test-device-name");
+
+    // A re-applied name would overwrite the one that is written here.
+    main_cfg.device_name = {'k', 'e', 'p', 't'};
+    parser.parse_config(std::string_view{config});
+    setting_handlr.apply_valid_settings(main_cfg);
+    CFG_CHECK(std::string_view{main_cfg.device_name.data()} == "kept");
+
+    parser.parse_config(cfg::test::full_config);
+    setting_handlr.apply_valid_settings(main_cfg);
+    CFG_CHECK(std::string_view{main_cfg.device_name.data()} == "test-device");
+}
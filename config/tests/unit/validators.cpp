@@ -0,0 +1,83 @@
+/**
+ * @file validators.cpp
+ * @brief Unit tests of the validators and string conversions of setting values.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#include <testing.h>
+
+#include <checking/validators.h>
+#include <strings/string-conversions.h>
+
+#include <cstdint>
+
+// The 32-bit validators are deprecated, but are still tested while they exist.
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+
+using cfg::validation_error;
+
+CFG_TEST_CASE(unsigned_values_convert_around_eight_digits) {
+    constexpr auto max = UINT32_MAX;
+    CFG_CHECK(not cfg::validate_uint32("99999999"));
+    CFG_CHECK(not cfg::validate_uint32("12345678", 0, max));
+    CFG_CHECK(not cfg::validate_uint32("123456789", 0, max));
+    CFG_CHECK(not cfg::validate_uint32("4294967295", 0, max));
+    CFG_CHECK(not cfg::validate_uint32("00000000000000000042", 42, 42));
+    CFG_CHECK(cfg::validate_uint32("100000000") == validation_error::above_max_threshold);
+    CFG_CHECK(cfg::validate_uint32("7", 8) == validation_error::below_min_threshold);
+
+    CFG_CHECK(cfg::uint32_from_zstring("87654321") == 87'654'321u);
+    CFG_CHECK(cfg::uint32_from_zstring("987654321") == 987'654'321u);
+    CFG_CHECK(cfg::uint32_from_zstring("4294967295") == UINT32_MAX);
+}
+
+CFG_TEST_CASE(unsigned_values_report_overflow) {
+    constexpr auto max = UINT32_MAX;
+    CFG_CHECK(cfg::validate_uint32("4294967296", 0, max) == validation_error::above_type_range);
+    CFG_CHECK(cfg::validate_uint32("9999999999", 0, max) == validation_error::above_type_range);
+    CFG_CHECK(cfg::validate_uint32("18446744073709551616", 0, max)
+        == validation_error::above_type_range);
+    CFG_CHECK(cfg::validate_uint32("") == validation_error::missing_value);
+    CFG_CHECK(cfg::validate_uint32("-1") == validation_error::contains_invalid_character);
+    CFG_CHECK(cfg::validate_uint32("123456789x", 0, max)
+        == validation_error::contains_invalid_character);
+    CFG_CHECK(cfg::validate_uint32("4294967296x", 0, max)
+        == validation_error::contains_invalid_character);
+    CFG_CHECK(cfg::uint32_from_zstring("4294967296") == 0);
+}
+
+CFG_TEST_CASE(signed_values_convert_around_eight_digits) {
+    constexpr auto min = INT32_MIN;
+    constexpr auto max = INT32_MAX;
+    CFG_CHECK(not cfg::validate_int32("-99999999"));
+    CFG_CHECK(not cfg::validate_int32("99999999"));
+    CFG_CHECK(not cfg::validate_int32("-123456789", min, max));
+    CFG_CHECK(not cfg::validate_int32("2147483647", min, max));
+    CFG_CHECK(not cfg::validate_int32("-2147483648", min, max));
+    CFG_CHECK(cfg::validate_int32("-100000000") == validation_error::below_min_threshold);
+    CFG_CHECK(cfg::validate_int32("100000000") == validation_error::above_max_threshold);
+
+    CFG_CHECK(cfg::int32_from_zstring("-87654321") == -87'654'321);
+    CFG_CHECK(cfg::int32_from_zstring("-987654321") == -987'654'321);
+    CFG_CHECK(cfg::int32_from_zstring("-2147483648") == INT32_MIN);
+}
+
+CFG_TEST_CASE(signed_values_report_overflow) {
+    constexpr auto min = INT32_MIN;
+    constexpr auto max = INT32_MAX;
+    CFG_CHECK(cfg::validate_int32("2147483648", min, max) == validation_error::above_type_range);
+    CFG_CHECK(cfg::validate_int32("-2147483649", min, max) == validation_error::below_type_range);
+    CFG_CHECK(cfg::validate_int32("-9999999999", min, max) == validation_error::below_type_range);
+    CFG_CHECK(cfg::validate_int32("-") == validation_error::contains_invalid_character);
+    CFG_CHECK(cfg::validate_int32("12 ") == validation_error::contains_invalid_character);
+}
@@ -0,0 +1,94 @@
+/**
+ * @file xml-parser.cpp
+ * @brief Unit tests of the XML parser, through a config-handler that uses it.
+ * 
+ * @version 1.0
+ * @date January 2022
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#include <sample-configs.h>
+#include <test-helpers.h>
+#include <testing.h>
+
+#include <config.h>
+
+#include <string_view>
+
+CFG_TEST_CASE(removed_setting_is_unset_when_parsed_again) {
+    auto cfg_handler = cfg::config_handler<cfg::xml_parser>{};
+    cfg_handler.process_config(cfg::test::full_config);
+    CFG_CHECK(not cfg_handler.has_config_errors());
+
+    auto const config = cfg::test::replace_text(
+        cfg::test::full_config, "<interval-ms>30000</interval-ms>", "");
+    cfg_handler.process_config(std::string_view{config});
+    CFG_CHECK(cfg_handler.has_config_errors());
+}
+
+CFG_TEST_CASE(unbalanced_file_does_not_affect_the_next_one) {
+    auto cfg_handler = cfg::config_handler<cfg::xml_parser>{};
+    cfg_handler.process_config(cfg::test::full_config.substr(0, 40));
+    CFG_CHECK(cfg_handler.has_config_errors());
+
+    cfg_handler.process_config(cfg::test::full_config);
+    CFG_CHECK(not cfg_handler.has_config_errors());
+}
+
+namespace {
+
+/**
+ * @brief Gets two settings that share the exact same path of tag-names.
+ */
+constexpr auto get_duplicate_settings() {
+    using id = cfg::setting_identifier;
+    constexpr auto properties = cfg::node{"aether"} / "properties";
+
+    return cfg::make_settings(
+        cfg::setting{
+            id::device_name,
+            properties / "name",
+            cfg::setting_type::optional,
+            cfg::dispatch_validator<cfg::validate_name>,
+            +[](cfg::setting_data, cfg::main_config&) {}},
+        cfg::setting{
+            id::usb_detection,
+            properties / "name",
+            cfg::setting_type::optional,
+            cfg::dispatch_validator<cfg::validate_name>,
+            +[](cfg::setting_data, cfg::main_config&) {}}
+    );
+}
+
+constexpr auto duplicate_config = std::string_view{
+    "<aether><properties><name>first</name></properties></aether>"};
+
+} // namespace
+
+CFG_TEST_CASE(duplicate_tag_path_is_resolved_to_the_first_setting) {
+    static constexpr auto table = cfg::make_tag_table<
+        cfg::count_tag_nodes(get_duplicate_settings())>(get_duplicate_settings());
+    static_assert(table.lookup().setting_index(table.node_count()) == 0);
+
+    auto settings = get_duplicate_settings();
+    auto parser = cfg::xml_parser{settings};
+    parser.set_tag_lookup(table.lookup());
+    parser.parse_config(duplicate_config);
+    CFG_CHECK(settings[0].view_value() == "first");
+    CFG_CHECK(settings[1].view_value().empty());
+}
+
+CFG_TEST_CASE(duplicate_tag_path_is_searched_up_to_the_first_setting) {
+    auto settings = get_duplicate_settings();
+    auto parser = cfg::xml_parser{settings};
+    parser.parse_config(duplicate_config);
+    CFG_CHECK(settings[0].view_value() == "first");
+    CFG_CHECK(settings[1].view_value().empty());
+}
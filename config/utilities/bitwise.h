@@ -17,6 +17,7 @@
 #ifndef CFG_CONFIG_UTILITIES_BITWISE_H
 #define CFG_CONFIG_UTILITIES_BITWISE_H
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -166,17 +167,113 @@ constexpr auto convert_bits(View value) -> T {
     return result;
 }
 
+namespace detail {
+
+/**
+ * @brief Loads a big-endian word from a range of bytes or characters.
+ * 
+ * @details The bytes are combined with shifts only, so that the function can still be
+ * evaluated in compile time. When the number of bytes is a constant, compilers recognize
+ * this pattern as a single unaligned load, followed by a byte swap on little-endian
+ * targets.
+ * 
+ * @tparam U Unsigned integral type of the word.
+ * @tparam T Element type of the range of characters or bytes.
+ * 
+ * @param[in] source Range of bytes or characters to load the word from.
+ * @param[in] count Number of bytes to load, which should not exceed the size of U. The
+ * loaded bytes end up in the lower bytes of the word.
+ * 
+ * @return Word that consists of the loaded bytes.
+ */
+template<typename U, typename T,
+    typename = std::enable_if_t<std::is_unsigned_v<U>>>
+[[nodiscard]]
+constexpr auto load_big_endian(T const source[], unsigned count = sizeof(U)) -> U {
+    auto word = U{};
+    for (auto idx = 0u; idx < count; ++idx) {
+        word = static_cast<U>(word << 8u)
+            | static_cast<U>(static_cast<unsigned char>(source[idx]));
+    }
+    return word;
+}
+
+/**
+ * @brief Reads a little-endian unsigned integer from a range of bytes.
+ * 
+ * @tparam U Unsigned integral type of the value to read.
+ * 
+ * @param[in] data Pointer to the first byte of the value.
+ */
+template<typename U,
+    typename = std::enable_if_t<std::is_unsigned_v<U>>>
+[[nodiscard]]
+constexpr auto read_le(std::byte const* data) -> U {
+    auto result = U{};
+    for (auto idx = sizeof(U); idx > 0; --idx) {
+        result = static_cast<U>((result << 8) | std::to_integer<U>(data[idx - 1]));
+    }
+    return result;
+}
+
+/**
+ * @brief Writes a little-endian unsigned integer to a range of bytes.
+ * 
+ * @tparam U Unsigned integral type of the value to write.
+ * 
+ * @param[out] data Pointer to the first byte to write the value to.
+ * @param[in] value Value to write.
+ */
+template<typename U,
+    typename = std::enable_if_t<std::is_unsigned_v<U>>>
+constexpr auto write_le(std::byte* data, U value) -> void {
+    for (auto idx = std::size_t{}; idx < sizeof(U); ++idx) {
+        data[idx] = static_cast<std::byte>(value >> (8 * idx));
+    }
+}
+
+/**
+ * @brief Extracts a field of bits from a word with a single shift and mask.
+ * 
+ * @tparam U Unsigned integral type of the word.
+ * 
+ * @param[in] word Word that contains the field.
+ * @param[in] shift Number of bits that follow the field within the word.
+ * @param[in] size Size of the field in number of bits, within the range of 1 to the
+ * number of bits of U.
+ * 
+ * @return Unsigned integral value of at least 64-bits that contains the field.
+ */
+template<typename U,
+    typename = std::enable_if_t<std::is_unsigned_v<U>>>
+[[nodiscard]]
+constexpr auto extract_field(U word, unsigned shift, unsigned size) -> std::uint_fast64_t {
+    auto const width = unsigned{sizeof(U) * 8u};
+    return (word >> shift) & (~U{} >> (width - size));
+}
+
+} // namespace detail
+
 /**
  * @brief Extracts a span of bits from a range of bytes or characters.
  * 
+ * @details Bits are numbered from the most significant bit of the first byte onwards.
+ * The first bit of the span ends up as the most significant bit of the result.
+ * 
+ * Only the bytes that contain the span of bits are loaded, and they are combined into a
+ * single word. The span is then extracted from that word with a single shift and mask.
+ * A span of 64 bits that does not start at a byte boundary covers nine bytes, in which
+ * case the last byte is shifted in separately.
+ * 
  * @warning Ensure that the pointer to the data source is not null and refers to a range
- * of at least N bytes, where N is greater or equal to the byte boundary of a bitspan.
+ * that contains the span of bits, i.e. of at least (pos + size + 7) / 8 bytes.
  * 
  * @tparam T Element type of the range of characters or bytes, which is constrained to
  * the size of a byte.
  * 
  * @param[in] source Range of bytes or characters to extract bits from.
- * @param[in] bits Span of bits to extract.
+ * @param[in] pos Position of the first bit of the span.
+ * @param[in] size Size of the span in number of bits, within the range of 1 to 64.
  * 
  * @return Unsigned integral value of at least 64-bits that contains the span of bits
  * extracted from the range of bytes or characters.
@@ -184,31 +281,308 @@ constexpr auto convert_bits(View value) -> T {
 template<typename T,
     typename = std::enable_if_t<(sizeof(T) == sizeof(std::byte))>>
 [[nodiscard]]
-constexpr auto extract_bits(T const source[], bitspan bits)
+constexpr auto extract_bits(T const source[], unsigned pos, unsigned size)
 -> std::uint_fast64_t {
-    auto const mask = 0b1111'1111u;
-    auto const width = 8u;
-    auto result = std::uint_fast64_t{};
-    unsigned pos{bits.pos()};
-    unsigned size{bits.size()};
-    auto offset = pos % width;
-    auto const count = (size + offset - 1) / width;
-    auto const start = pos / width;
+    auto const start = pos / 8u;
+    auto const end = pos % 8u + size;
 
-    for (auto idx = 0u; idx < count; ++idx) {
-        result |= source[start + idx] & (mask >> offset);
-        auto const diff = width - offset;
-        pos += diff;
-        size -= diff;
-        result <<= std::min(size, width);
-        offset = pos % width;
-    }
-    auto const span = width - (offset + size);
-    auto const last = source[start + count] & (mask >> offset);
-    result |= last >> span;
+    if (end <= 64u) {
+        auto const count = (end + 7u) / 8u;
+        auto const word = detail::load_big_endian<std::uint64_t>(source + start, count);
+        return detail::extract_field(word, count * 8u - end, size);
+    }
+    auto const rest = end - 64u;
+    auto const word = detail::load_big_endian<std::uint64_t>(source + start);
+    auto const last = detail::load_big_endian<std::uint64_t>(source + start + 8u, 1u);
+    return detail::extract_field((word << rest) | (last >> (8u - rest)), 0u, size);
+}
+
+/**
+ * @brief Writes a span of bits to a range of bytes.
+ * 
+ * @details Uses the same bit numbering as @ref extract_bits. The bits outside of the
+ * span are left unaltered.
+ * 
+ * @param[out] dest Range of bytes to write the bits to.
+ * @param[in] pos Position of the first bit of the span.
+ * @param[in] size Size of the span in number of bits, within the range of 1 to 64.
+ * @param[in] value Value of which the lower bits are written.
+ */
+constexpr auto insert_bits(
+    std::byte* dest, unsigned pos, unsigned size, std::uint_fast64_t value) -> void
+{
+    for (auto bit = 0u; bit < size; ++bit) {
+        auto const offset = (pos + bit) % 8u;
+        auto const mask = static_cast<std::byte>(0x80u >> offset);
+        auto& target = dest[(pos + bit) / 8u];
+        if ((value >> (size - 1u - bit)) & 1u) {
+            target |= mask;
+        } else {
+            target &= ~mask;
+        }
+    }
+}
+
+namespace detail {
+
+/**
+ * @brief Extracts a span of bits from a range of bytes or characters that covers the
+ * byte boundary of a bitspan.
+ * 
+ * @details A span that fits in a 32-bit word is extracted from a single 32-bit load,
+ * and any other span that fits in a 64-bit word from a single 64-bit load. Since a word
+ * may extend past the span, words are only loaded when they lie within the byte
+ * boundary. Otherwise, only the bytes that contain the span are loaded.
+ * 
+ * @warning Ensure that the pointer to the data source is not null and refers to a range
+ * of at least N bytes, where N is greater or equal to the byte boundary of a bitspan.
+ * 
+ * @tparam T Element type of the range of characters or bytes.
+ * 
+ * @param[in] source Range of bytes or characters to extract bits from.
+ * @param[in] pos Position of the first bit of the span.
+ * @param[in] size Size of the span in number of bits, within the range of 1 to 64.
+ * 
+ * @return Unsigned integral value of at least 64-bits that contains the span of bits
+ * extracted from the range of bytes or characters.
+ */
+template<typename T>
+[[nodiscard]]
+constexpr auto extract_bits_bounded(T const source[], unsigned pos, unsigned size)
+-> std::uint_fast64_t {
+    auto const start = pos / 8u;
+    auto const end = pos % 8u + size;
+
+    if (end <= 32u and start + 4u <= bitspan::byte_boundary) {
+        auto const word = load_big_endian<std::uint32_t>(source + start);
+        return extract_field(word, 32u - end, size);
+    }
+    if (end <= 64u and start + 8u <= bitspan::byte_boundary) {
+        auto const word = load_big_endian<std::uint64_t>(source + start);
+        return extract_field(word, 64u - end, size);
+    }
+    return extract_bits(source, pos, size);
+}
+
+/**
+ * @brief Extracts a span of bits from a range of bytes one bit at a time.
+ * 
+ * @details This is the most direct implementation of the bit numbering that is used by
+ * the extract_bits functions, against which they are checked in compile time.
+ * 
+ * @tparam T Element type of the range of characters or bytes.
+ * 
+ * @param[in] source Range of bytes or characters to extract bits from.
+ * @param[in] pos Position of the first bit of the span.
+ * @param[in] size Size of the span in number of bits, within the range of 1 to 64.
+ * 
+ * @return Unsigned integral value of at least 64-bits that contains the span of bits.
+ */
+template<typename T>
+[[nodiscard]]
+constexpr auto extract_bits_serially(T const source[], unsigned pos, unsigned size)
+-> std::uint_fast64_t {
+    auto result = std::uint_fast64_t{};
+    for (auto bit = pos; bit < pos + size; ++bit) {
+        auto const byte = static_cast<unsigned char>(source[bit / 8u]);
+        result = (result << 1u) | ((byte >> (7u - bit % 8u)) & 1u);
+    }
     return result;
 }
 
+/**
+ * @brief Checks the extract_bits functions against a serial extraction of bits.
+ * 
+ * @details Every span size is checked at every bit offset, both at the start of a range
+ * and at its byte boundary, where the bounded extraction cannot load whole words.
+ * 
+ * @return True if all extracted spans match, false otherwise.
+ */
+[[nodiscard]]
+constexpr auto check_extract_bits() -> bool {
+    unsigned char source[bitspan::byte_boundary]{};
+    for (auto idx = 0u; idx < bitspan::byte_boundary; ++idx) {
+        source[idx] = static_cast<unsigned char>(idx * 0x9Du + 0x5Bu);
+    }
+    auto const check = [&source](unsigned pos, unsigned size) {
+        auto const expected = extract_bits_serially(source, pos, size);
+        return extract_bits(source, pos, size) == expected
+            and extract_bits_bounded(source, pos, size) == expected;
+    };
+    auto const boundary = bitspan::byte_boundary * 8u;
+    for (auto size = bitspan::min_size; size <= bitspan::max_size; ++size) {
+        for (auto offset = 0u; offset < 16u; ++offset) {
+            if (not check(offset, size) or not check(boundary - size - offset, size)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static_assert(check_extract_bits());
+static_assert(extract_bits_serially("\xA5\x0F", 4, 8) == 0x50);
+
+} // namespace detail
+
+/**
+ * @brief Extracts a span of bits from a range of bytes or characters.
+ * 
+ * @details Since the range is required to cover the byte boundary of a bitspan, the
+ * span is extracted from a whole 32-bit or 64-bit word wherever it fits in one.
+ * 
+ * @warning Ensure that the pointer to the data source is not null and refers to a range
+ * of at least N bytes, where N is greater or equal to the byte boundary of a bitspan.
+ * 
+ * @tparam T Element type of the range of characters or bytes, which is constrained to
+ * the size of a byte.
+ * 
+ * @param[in] source Range of bytes or characters to extract bits from.
+ * @param[in] bits Span of bits to extract.
+ * 
+ * @return Unsigned integral value of at least 64-bits that contains the span of bits
+ * extracted from the range of bytes or characters.
+ */
+template<typename T,
+    typename = std::enable_if_t<(sizeof(T) == sizeof(std::byte))>>
+[[nodiscard]]
+constexpr auto extract_bits(T const source[], bitspan bits) -> std::uint_fast64_t {
+    return detail::extract_bits_bounded(
+        source, unsigned{bits.pos()}, unsigned{bits.size()});
+}
+
+/**
+ * @brief Extracts a span of bits at a fixed position from a range of bytes or
+ * characters.
+ * 
+ * @details Works the same as the bitspan overload of @ref extract_bits, except that the
+ * position and size of the span are template arguments. The size of the loaded word and
+ * the shift and mask that extract the span are therefore all fixed in compile time.
+ * 
+ * @warning Ensure that the pointer to the data source is not null and refers to a range
+ * of at least N bytes, where N is greater or equal to the byte boundary of a bitspan.
+ * 
+ * @tparam Pos Position of the first bit of the span.
+ * @tparam Size Size of the span in number of bits, within the range of 1 to 64.
+ * @tparam T Element type of the range of characters or bytes, which is constrained to
+ * the size of a byte.
+ * 
+ * @param[in] source Range of bytes or characters to extract bits from.
+ * 
+ * @return Unsigned integral value of at least 64-bits that contains the span of bits
+ * extracted from the range of bytes or characters.
+ */
+template<unsigned Pos, unsigned Size, typename T,
+    typename = std::enable_if_t<(Size >= bitspan::min_size and Size <= bitspan::max_size)>,
+    typename = std::enable_if_t<(Pos + Size <= bitspan::byte_boundary * 8)>,
+    typename = std::enable_if_t<(sizeof(T) == sizeof(std::byte))>>
+[[nodiscard]]
+constexpr auto extract_fixed_bits(T const source[]) -> std::uint_fast64_t {
+    constexpr auto start = Pos / 8u;
+    constexpr auto end = Pos % 8u + Size;
+
+    if constexpr (end <= 32u and start + 4u <= bitspan::byte_boundary) {
+        auto const word = detail::load_big_endian<std::uint32_t>(source + start);
+        return detail::extract_field(word, 32u - end, Size);
+    } else if constexpr (end <= 64u and start + 8u <= bitspan::byte_boundary) {
+        auto const word = detail::load_big_endian<std::uint64_t>(source + start);
+        return detail::extract_field(word, 64u - end, Size);
+    } else {
+        return extract_bits(source, Pos, Size);
+    }
+}
+
+/**
+ * @brief Extracts multiple spans of bits from a range of bytes or characters.
+ * 
+ * @details Decodes a sequence of bitspans in a single pass, writing the extracted value
+ * of each bitspan to the output range in the same order. Each span is extracted the same
+ * way as by the bitspan overload of @ref extract_bits.
+ * 
+ * @warning Ensure that the pointer to the data source is not null and refers to a range
+ * of at least N bytes, where N is greater or equal to the byte boundary of a bitspan.
+ * Also ensure that the output range is able to hold a value for each bitspan.
+ * 
+ * @tparam T Element type of the range of characters or bytes, which is constrained to
+ * the size of a byte.
+ * @tparam InputIter Type of the iterators to the bitspans.
+ * @tparam OutputIter Type of the iterator to the extracted values.
+ * 
+ * @param[in] source Range of bytes or characters to extract bits from.
+ * @param[in] first Iterator to the first bitspan to extract.
+ * @param[in] last Iterator past the last bitspan to extract.
+ * @param[out] out Iterator to the beginning of the output range.
+ * 
+ * @return Iterator past the last extracted value in the output range.
+ */
+template<typename T, typename InputIter, typename OutputIter,
+    typename = std::enable_if_t<(sizeof(T) == sizeof(std::byte))>>
+constexpr auto extract_bitspans(
+    T const source[],
+    InputIter first,
+    InputIter last,
+    OutputIter out
+) -> OutputIter {
+    for (; first != last; ++first, ++out) {
+        auto const bits = bitspan{*first};
+        *out = detail::extract_bits_bounded(
+            source, unsigned{bits.pos()}, unsigned{bits.size()});
+    }
+    return out;
+}
+
+namespace detail {
+
+/**
+ * @brief Checks the batch extraction of bitspans against the single extraction.
+ * 
+ * @return True if the values of all bitspans match, false otherwise.
+ */
+[[nodiscard]]
+constexpr auto check_extract_bitspans() -> bool {
+    unsigned char source[bitspan::byte_boundary]{};
+    for (auto idx = 0u; idx < bitspan::byte_boundary; ++idx) {
+        source[idx] = static_cast<unsigned char>(idx * 0x3Bu + 0xC1u);
+    }
+    bitspan const spans[] = {
+        bitspan::make<0>, bitspan::make<3, 13>, bitspan::make<29, 35>,
+        bitspan::make<64, 64>, bitspan::make<101, 64>, bitspan::make<448, 64>};
+    std::uint_fast64_t values[std::size(spans)]{};
+
+    auto const out = extract_bitspans(source, std::begin(spans), std::end(spans), values);
+    if (out != std::end(values)) return false;
+    for (auto idx = std::size_t{}; idx < std::size(spans); ++idx) {
+        if (values[idx] != extract_bits(source, spans[idx])) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Checks the extraction of spans of bits at fixed positions against the
+ * extraction at run-time positions.
+ * 
+ * @return True if all extracted spans match, false otherwise.
+ */
+[[nodiscard]]
+constexpr auto check_extract_fixed_bits() -> bool {
+    unsigned char source[bitspan::byte_boundary]{};
+    for (auto idx = 0u; idx < bitspan::byte_boundary; ++idx) {
+        source[idx] = static_cast<unsigned char>(idx * 0x6Du + 0x2Fu);
+    }
+    return extract_fixed_bits<0, 1>(source) == extract_bits(source, 0, 1)
+        and extract_fixed_bits<3, 13>(source) == extract_bits(source, 3, 13)
+        and extract_fixed_bits<29, 35>(source) == extract_bits(source, 29, 35)
+        and extract_fixed_bits<7, 64>(source) == extract_bits(source, 7, 64)
+        and extract_fixed_bits<448, 64>(source) == extract_bits(source, 448, 64)
+        and extract_fixed_bits<476, 32>(source) == extract_bits(source, 476, 32)
+        and extract_fixed_bits<505, 7>(source) == extract_bits(source, 505, 7);
+}
+
+static_assert(check_extract_bitspans());
+static_assert(check_extract_fixed_bits());
+
+} // namespace detail
+
 /**
  * @brief Makes a bitmask of a given size.
  * 
@@ -225,6 +599,29 @@ template<typename U = std::uint32_t,
 constexpr auto make_bitmask(int size) -> U
 { return ~(~U{} << size); }
 
+/**
+ * @brief Rounds a value up to the nearest power of two.
+ * 
+ * @details Refer to the documentation of std::bit_ceil on cppreference.com for more
+ * information. Unlike std::bit_ceil, this function is available in C++17.
+ * 
+ * @tparam U Unsigned integral type of the value.
+ * 
+ * @param[in] value Value to round up.
+ * 
+ * @return Smallest power of two that is not less than the given value.
+ */
+template<typename U,
+    typename = std::enable_if_t<std::is_unsigned_v<U>>>
+[[nodiscard]]
+constexpr auto bit_ceil(U value) -> U {
+    auto result = U{1};
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
 } // namespace cfg
 
 #endif
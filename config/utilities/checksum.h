@@ -0,0 +1,88 @@
+/**
+ * @file checksum.h
+ * @brief Checksum related utility functions.
+ * 
+ * @version 1.0
+ * @date December 2021
+ * 
+ * @authors INNO Project-group (Semester A+B, 2021)
+ * @author Joeri Kok (joeri.j.kok@student.hu.nl)
+ * @author Rick Horeman (rick.horeman@student.hu.nl)
+ * @author Richard Janssen (richard.janssen@student.hu.nl)
+ * @author Koen Eijkelenboom (koen.eijkelenboom@student.hu.nl)
+ * @author Tim Hardeman (tim.hardeman@student.hu.nl)
+ * 
+ * @copyright GPL-3.0 License
+ */
+#ifndef CFG_CONFIG_UTILITIES_CHECKSUM_H
+#define CFG_CONFIG_UTILITIES_CHECKSUM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @namespace cfg
+ * 
+ * @brief Contains everything related to the processing of configuration files.
+ */
+namespace cfg {
+
+/**
+ * @brief Computes the CRC-32 checksum of a range of bytes.
+ * 
+ * @details Uses the reflected polynomial 0xEDB88320, which is the same CRC-32 variant as
+ * used by zlib and most host tools. The checksum is computed bit by bit, rather than
+ * with a lookup table, to keep its footprint small.
+ * 
+ * @param[in] data Pointer to the first byte of the range.
+ * @param[in] size Number of bytes in the range.
+ * @param[in] crc Checksum of a preceding range of bytes, which allows the checksum to be
+ * computed in multiple steps. Zero to start a new checksum.
+ * 
+ * @return CRC-32 checksum of the range of bytes.
+ */
+[[nodiscard]]
+constexpr auto crc32(
+    std::byte const* data,
+    std::size_t size,
+    std::uint32_t crc = 0
+) -> std::uint32_t {
+    crc = ~crc;
+    for (auto idx = std::size_t{}; idx < size; ++idx) {
+        crc ^= std::to_integer<std::uint32_t>(data[idx]);
+        for (auto bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ (0xEDB8'8320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+/**
+ * @brief Computes the CRC-32 checksum of the characters of a string.
+ * 
+ * @details Gives the same checksum as the other overload does for the bytes of the
+ * string, but can also be computed in compile time.
+ * 
+ * @param[in] data String of which to compute the checksum.
+ * @param[in] crc Checksum of a preceding range of bytes. Zero to start a new checksum.
+ * 
+ * @return CRC-32 checksum of the characters of the string.
+ */
+[[nodiscard]]
+constexpr auto crc32(std::string_view data, std::uint32_t crc = 0) -> std::uint32_t {
+    crc = ~crc;
+    for (auto const character : data) {
+        crc ^= static_cast<std::uint32_t>(static_cast<unsigned char>(character));
+        for (auto bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ (0xEDB8'8320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+static_assert(crc32("123456789") == 0xCBF4'3926u, "check value of CRC-32");
+
+} // namespace cfg
+
+#endif
@@ -18,6 +18,7 @@
 #define CFG_CONFIG_UTILITIES_FILE_IO_H
 
 #include <errors/error-types.h>
+#include <logging/logger.h>
 #include <strings/zstring-view.h>
 #include <traits/class-traits.h>
 
@@ -25,8 +26,12 @@
 #include <sdcard.hpp>
 #include <FatFs/src/ff.h>
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <optional>
+#include <string_view>
 #include <type_traits>
 
 /**
@@ -39,7 +44,8 @@ namespace cfg {
 /**
  * @struct io_result
  * 
- * @brief Data type that is returned by the @ref load_file function.
+ * @brief Data type that is returned by the @ref load_file and @ref stream_file
+ * functions.
  * 
  * @details An I/O result constists of a @p bytes_read data-member and an optional
  * I/O error. Success is indicated by an empty I/O error.
@@ -71,9 +77,73 @@ struct io_result {
     std::optional<io_error> error;  /**< Optional I/O error. */
 };
 
+/**
+ * @class sd_session
+ * 
+ * @brief Keeps the SD-card awake for the lifetime of the session and puts it to sleep
+ * afterwards.
+ * 
+ * @details Sessions can be nested, in which case only the outermost session powers the
+ * card up and down. Every file access within a session thus shares a single power cycle
+ * of the card, which costs far less energy than a power cycle per access. The records
+ * of the default log-buffer are flushed right before the card is put to sleep, so that
+ * the log entries of the session are written while the card is still awake, as in:
+ * 
+ * auto const session = sd_session{};
+ * auto const main_cfg = process_config_file("config.xml");
+ * log_main_config(main_cfg);
+ */
+class sd_session {
+public:
+    /**
+     * @brief Starts a session, which powers the SD-card up if no session is active yet.
+     */
+    sd_session() {
+        if (active_sessions()++ != 0) return;
+        SDCard_Clock_Config();
+        sd_card::init();
+    }
+
+    /**
+     * @brief Ends the session, which flushes the default log-buffer and puts the
+     * SD-card to sleep if it is the outermost session.
+     */
+    ~sd_session() {
+        if (--active_sessions() != 0) return;
+        flush_default_log();
+        sd_card::sleep();
+        SDCard_Clock_Config();
+    }
+
+    sd_session(sd_session const&) = delete;
+    auto operator=(sd_session const&) -> sd_session& = delete;
+
+    /**
+     * @brief Checks if any session is active, which means the SD-card is awake.
+     */
+    [[nodiscard]]
+    static auto is_active() -> bool
+    { return active_sessions() != 0; }
+
+private:
+    /**
+     * @brief Gets the number of sessions that are active at the moment.
+     */
+    [[nodiscard]]
+    static auto active_sessions() -> std::uint_least8_t& {
+        static auto count = std::uint_least8_t{};
+        return count;
+    }
+};
+
 /**
  * @brief Loads a file from the SD-card.
  * 
+ * @details The file is opened once, which also provides its size. As such, the size does
+ * not have to be looked up separately and no more bytes than the file or the buffer
+ * contains are requested. A file that fits in the buffer is read with a single request,
+ * which lets FatFs transfer whole sectors straight into the buffer.
+ * 
  * @tparam Container Container type that stores its contents in a contiguous sequence.
  * 
  * @param[in] filename Name of the file to load.
@@ -87,22 +157,19 @@ template<typename Container,
     typename = std::enable_if_t<is_contiguous_container_v<Container>>>
 auto load_file(zstring_view filename, std::size_t buffer_size, Container& buffer)
 -> io_result {
-    struct perilogue {
-        perilogue()  { SDCard_Clock_Config(); sd_card::init(); }
-        ~perilogue() { sd_card::sleep(); SDCard_Clock_Config(); }
-    } const file_io;
-
-    auto bytes_read = unsigned{};
-    auto status = sd_card::read_chars(
-        std::data(buffer), buffer_size, filename.data(), &bytes_read);
+    auto const file_io = sd_session{};
 
+    auto file = FIL{};
+    auto status = f_open(&file, filename.data(), FA_READ);
     if (status != FR_OK)
-        return {bytes_read, static_cast<io_error>(status)};
-    if (bytes_read < buffer_size)
-        return {bytes_read, std::nullopt};
+        return {0, static_cast<io_error>(status)};
+
+    auto const file_size = static_cast<std::uint32_t>(f_size(&file));
+    auto const read_size = std::min<std::size_t>(file_size, buffer_size);
 
-    auto file_size = std::uint32_t{};
-    status = sd_card::get_filesize(filename.data(), file_size);
+    auto bytes_read = UINT{};
+    status = f_read(&file, std::data(buffer), static_cast<UINT>(read_size), &bytes_read);
+    f_close(&file);
 
     if (status != FR_OK)
         return {bytes_read, static_cast<io_error>(status)};
@@ -112,6 +179,118 @@ auto load_file(zstring_view filename, std::size_t buffer_size, Container& buffer
     return {bytes_read, std::nullopt};
 }
 
+/**
+ * @struct file_stamp
+ * 
+ * @brief Metadata of a file that changes whenever the file is rewritten.
+ * 
+ * @details A file stamp is cheap to obtain, as it does not require the contents of a
+ * file to be read. Matching stamps do not guarantee that the contents are unchanged,
+ * but differing stamps do indicate that a file was changed.
+ */
+struct file_stamp {
+    /**
+     * @brief Compares two file stamps for (in)equality.
+     * 
+     * @param[in] lhs File stamp on the left-hand side of the operator.
+     * @param[in] rhs File stamp on the right-hand side of the operator.
+     * 
+     * @return Two file stamps are considered to be equal when both their size and
+     * modification time matches.
+     * 
+     * @{
+     */
+    [[nodiscard]]
+    friend constexpr auto operator!=(
+        file_stamp const& lhs, file_stamp const& rhs) -> bool
+    { return not (lhs == rhs); }
+
+    [[nodiscard]]
+    friend constexpr auto operator==(
+        file_stamp const& lhs, file_stamp const& rhs) -> bool
+    { return lhs.size == rhs.size and lhs.modified == rhs.modified; }
+    /** @} */
+
+    std::uint32_t size;     /**< Size of the file, in number of bytes. */
+    std::uint32_t modified; /**< FAT date (higher 16 bits) and time of modification. */
+};
+
+/**
+ * @brief Gets the stamp of a file on the SD-card.
+ * 
+ * @param[in] filename Name of the file.
+ * @param[out] stamp File stamp, which is only written if no I/O error occurred.
+ * 
+ * @return Optional I/O error, which is empty on success.
+ */
+inline auto get_file_stamp(zstring_view filename, file_stamp& stamp)
+-> std::optional<io_error> {
+    auto const file_io = sd_session{};
+
+    auto info = FILINFO{};
+    if (auto const status = f_stat(filename.data(), &info); status != FR_OK)
+        return static_cast<io_error>(status);
+
+    stamp.size = static_cast<std::uint32_t>(info.fsize);
+    stamp.modified = (std::uint32_t{info.fdate} << 16) | info.ftime;
+    return std::nullopt;
+}
+
+/**
+ * @var file_block_size
+ * 
+ * @brief Default number of bytes of a block in which a file is streamed.
+ */
+inline constexpr auto file_block_size = std::size_t{256};
+
+/**
+ * @brief Streams a file from the SD-card in blocks of a fixed size.
+ * 
+ * @details Only a single block of the file is kept in memory at any time. Each block is
+ * handed over to the block-handler as soon as it is read, which means that the memory
+ * usage of this function is independent of the size of the file.
+ * 
+ * @tparam BlockSize Size of a block in number of bytes.
+ * @tparam BlockHandler Type of a callable that accepts a std::string_view.
+ * 
+ * @param[in] filename Name of the file to stream.
+ * @param[in] handle_block Callable that is invoked with each block that is read. A
+ * block is only valid for the duration of the call.
+ * 
+ * @return The total number of bytes read and an optional I/O error. If an error occurs
+ * while reading, the blocks handled so far are not undone.
+ */
+template<std::size_t BlockSize = file_block_size, typename BlockHandler,
+    typename = std::enable_if_t<(BlockSize > 0)>,
+    typename = std::enable_if_t<std::is_invocable_v<BlockHandler&, std::string_view>>>
+auto stream_file(zstring_view filename, BlockHandler&& handle_block) -> io_result {
+    auto const file_io = sd_session{};
+
+    auto file = FIL{};
+    auto status = f_open(&file, filename.data(), FA_READ);
+    if (status != FR_OK)
+        return {0, static_cast<io_error>(status)};
+
+    auto block = std::array<char, BlockSize>{};
+    auto total_read = std::uint_least32_t{};
+    auto bytes_read = UINT{};
+    do {
+        status = f_read(&file, block.data(), BlockSize, &bytes_read);
+        if (status != FR_OK) break;
+
+        total_read += bytes_read;
+        if (bytes_read > 0) {
+            handle_block(std::string_view{block.data(), bytes_read});
+        }
+    } while (bytes_read == BlockSize);
+    f_close(&file);
+
+    if (status != FR_OK)
+        return {total_read, static_cast<io_error>(status)};
+
+    return {total_read, std::nullopt};
+}
+
 } // namespace cfg
 
 #endif
@@ -83,8 +83,12 @@ public:
      * @typedef const_reference
      * 
      * @brief Type of the reference to a constant value type.
+     * 
+     * @details If the iterator yields references by value, such as the proxies of a
+     * @ref setting_table, the same type is used to refer to a constant value.
      */
-    using const_reference = value_type const&;
+    using const_reference = std::conditional_t<std::is_reference_v<reference>,
+        value_type const&, reference>;
 
     /**
      * @brief Default-constructs a range.
@@ -242,7 +246,7 @@ private:
      * @return Reference to an element.
      */
     template<typename Range, typename Index>
-    static constexpr auto& access(Range ptr, Index idx) {
+    static constexpr auto access(Range ptr, Index idx) -> decltype(auto) {
         auto iter = ptr->begin();
         std::advance(iter, idx);
         return *iter;